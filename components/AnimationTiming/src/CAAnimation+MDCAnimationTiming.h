@@ -0,0 +1,42 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <QuartzCore/QuartzCore.h>
+
+/** A block that creates the template animation of a key. */
+typedef CAAnimation *_Nonnull (^MDCAnimationTemplateBuilder)(void);
+
+/**
+ Shared animation templates.
+
+ Components that add the same animations over and over, such as ink and ripples on every touch, can
+ register those animations as templates once and add copies of them. Copies share the values and
+ timing functions of their template instead of creating new ones.
+ */
+@interface CAAnimation (MDCAnimationTiming)
+
+/**
+ Returns a new copy of the template animation registered under @c key.
+
+ The first call for a key registers the animation returned by @c builder as the template of that
+ key. Templates are never returned or modified, so every copy starts out identical to the template
+ and can be changed freely. The template must be an instance of the receiving class.
+
+ @param key A process-wide unique key of the template, such as "MDCRippleLayer.fadeIn".
+ @param builder A block that creates the template. Only called when @c key has no template yet.
+ */
++ (nonnull instancetype)mdc_animationWithTemplateKey:(nonnull NSString *)key
+                                             builder:(nonnull MDCAnimationTemplateBuilder)builder;
+
+@end
@@ -0,0 +1,78 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "CAAnimation+MDCAnimationTiming.h"
+#import "private/CAAnimation+MDCAnimationTiming+Private.h"
+
+#import <os/lock.h>
+
+static os_unfair_lock gTemplatesLock = OS_UNFAIR_LOCK_INIT;
+
+/** The number of templates built and copies returned, guarded by gTemplatesLock. */
+static NSUInteger gTemplateBuildCount = 0;
+static NSUInteger gTemplateCopyCount = 0;
+
+@implementation CAAnimation (MDCAnimationTiming)
+
++ (instancetype)mdc_animationWithTemplateKey:(NSString *)key
+                                     builder:(MDCAnimationTemplateBuilder)builder {
+  static NSMutableDictionary<NSString *, CAAnimation *> *templates;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    templates = [NSMutableDictionary dictionary];
+  });
+
+  os_unfair_lock_lock(&gTemplatesLock);
+  ++gTemplateCopyCount;
+  CAAnimation *template = templates[key];
+  os_unfair_lock_unlock(&gTemplatesLock);
+
+  if (!template) {
+    // The builder runs outside of the lock because it may register other templates. If two
+    // threads build the same template, the first one registered is kept.
+    CAAnimation *builtTemplate = builder();
+    os_unfair_lock_lock(&gTemplatesLock);
+    ++gTemplateBuildCount;
+    template = templates[key];
+    if (!template) {
+      template = [builtTemplate copy];
+      templates[key] = template;
+    }
+    os_unfair_lock_unlock(&gTemplatesLock);
+  }
+
+  NSAssert([template isKindOfClass:self], @"The template for %@ is a %@, not a %@.", key,
+           NSStringFromClass([template class]), NSStringFromClass(self));
+  return [template copy];
+}
+
+@end
+
+@implementation CAAnimation (MDCAnimationTimingPrivate)
+
++ (NSUInteger)mdc_animationTemplateBuildCount {
+  os_unfair_lock_lock(&gTemplatesLock);
+  NSUInteger buildCount = gTemplateBuildCount;
+  os_unfair_lock_unlock(&gTemplatesLock);
+  return buildCount;
+}
+
++ (NSUInteger)mdc_animationTemplateCopyCount {
+  os_unfair_lock_lock(&gTemplatesLock);
+  NSUInteger copyCount = gTemplateCopyCount;
+  os_unfair_lock_unlock(&gTemplatesLock);
+  return copyCount;
+}
+
+@end
@@ -75,6 +75,8 @@ typedef NS_ENUM(NSUInteger, MDCAnimationTimingFunction) {
  Returns the corresponding CAMediaTimingFunction for the given curve specified by an enum. The most
  common curve is MDCAnimationTimingFunctionEaseInOut.
 
+ Every call with the same curve returns the same timing function.
+
  @param type A Material Design media timing function.
  */
 + (nullable CAMediaTimingFunction *)mdc_functionWithType:(MDCAnimationTimingFunction)type;
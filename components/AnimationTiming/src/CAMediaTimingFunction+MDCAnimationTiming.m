@@ -14,20 +14,31 @@
 
 #import "CAMediaTimingFunction+MDCAnimationTiming.h"
 
+#import "private/MDCAnimationTimingControlPoints.h"
+
+static CAMediaTimingFunction *MakeTimingFunction(MDCAnimationTimingFunction type) {
+  const float *controlPoints = MDCAnimationTimingControlPoints[type];
+  // clang-format off
+  return [[CAMediaTimingFunction alloc] initWithControlPoints:controlPoints[0]
+                                                             :controlPoints[1]
+                                                             :controlPoints[2]
+                                                             :controlPoints[3]];
+  // clang-format on
+}
+
 @implementation CAMediaTimingFunction (MDCAnimationTiming)
 
 + (CAMediaTimingFunction *)mdc_functionWithType:(MDCAnimationTimingFunction)type {
-  switch (type) {
-    // clang-format off
-    case MDCAnimationTimingFunctionStandard:
-      return [[CAMediaTimingFunction alloc] initWithControlPoints:(float)0.4:0:(float)0.2:1];
-    case MDCAnimationTimingFunctionDeceleration:
-      return [[CAMediaTimingFunction alloc] initWithControlPoints:0:0:(float)0.2:1];
-    case MDCAnimationTimingFunctionAcceleration:
-      return [[CAMediaTimingFunction alloc] initWithControlPoints:(float)0.4:0:1:1];
-    case MDCAnimationTimingFunctionSharp:
-      return [[CAMediaTimingFunction alloc] initWithControlPoints:(float)0.4:0:(float)0.6:1];
-      // clang-format on
+  // Timing functions are immutable, so one instance of each is shared by all callers.
+  static CAMediaTimingFunction *timingFunctions[MDCAnimationTimingCurveCount];
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    for (NSUInteger i = 0; i < MDCAnimationTimingCurveCount; ++i) {
+      timingFunctions[i] = MakeTimingFunction(i);
+    }
+  });
+  if (type < MDCAnimationTimingCurveCount) {
+    return timingFunctions[type];
   }
   NSAssert(NO, @"Invalid MDCAnimationTimingFunction value %i.", (int)type);
   // Reasonable default to use in Release mode for garbage input.
@@ -0,0 +1,49 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+#import "CAMediaTimingFunction+MDCAnimationTiming.h"
+
+/**
+ Evaluates Material Design easing curves without Core Animation.
+
+ Code that drives its own animations, for example from a display link or a gesture, can use these
+ functions to ease progress with the same curves as @c +mdc_functionWithType:.
+
+ Each curve is evaluated with a lookup table built once per process, refined with Newton's method,
+ so the results are within 1e-6 of the exact cubic bezier. These functions are safe to call from
+ any thread.
+ */
+
+/**
+ Returns the eased value of @c progress for the curve @c type.
+
+ @param type A Material Design timing function.
+ @param progress The fraction of time elapsed, clamped to [0, 1].
+ @return The fraction of the animated change at @c progress.
+ */
+FOUNDATION_EXTERN CGFloat MDCAnimationTimingFunctionValue(MDCAnimationTimingFunction type,
+                                                          CGFloat progress);
+
+/**
+ Evaluates the curve @c type for @c count progress values at once.
+
+ @c values receives one eased value per element of @c progress, and may be the same array.
+ */
+FOUNDATION_EXTERN void MDCAnimationTimingFunctionValues(MDCAnimationTimingFunction type,
+                                                        const CGFloat *_Nonnull progress,
+                                                        CGFloat *_Nonnull values,
+                                                        NSUInteger count);
@@ -0,0 +1,153 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCAnimationTimingCurve.h"
+
+#import "private/MDCAnimationTimingControlPoints.h"
+
+/** The number of evenly spaced progress values each lookup table holds a bezier parameter for. */
+#define kAnimationTimingCurveSampleCount 65
+
+/** The largest error in x that the bezier parameter of a progress value may have. */
+static const double kAnimationTimingCurveEpsilon = 1e-7;
+
+/** The maximum number of Newton iterations before falling back to bisection. */
+static const NSInteger kAnimationTimingCurveNewtonIterations = 4;
+
+/**
+ The polynomial coefficients of a cubic bezier from (0, 0) to (1, 1), and the bezier parameter t at
+ each of kAnimationTimingCurveSampleCount evenly spaced values of x.
+ */
+typedef struct {
+  double ax, bx, cx;
+  double ay, by, cy;
+  double parameters[kAnimationTimingCurveSampleCount];
+} AnimationTimingCurve;
+
+static AnimationTimingCurve gCurves[MDCAnimationTimingCurveCount];
+
+static inline double CurveX(const AnimationTimingCurve *curve, double t) {
+  return ((curve->ax * t + curve->bx) * t + curve->cx) * t;
+}
+
+static inline double CurveY(const AnimationTimingCurve *curve, double t) {
+  return ((curve->ay * t + curve->by) * t + curve->cy) * t;
+}
+
+static inline double CurveDerivativeX(const AnimationTimingCurve *curve, double t) {
+  return (3 * curve->ax * t + 2 * curve->bx) * t + curve->cx;
+}
+
+/** Returns the bezier parameter in [lower, upper] whose x is @c x. x(t) must be increasing. */
+static double BisectParameter(const AnimationTimingCurve *curve,
+                              double x,
+                              double lower,
+                              double upper) {
+  double t = (lower + upper) / 2;
+  while (upper - lower > kAnimationTimingCurveEpsilon) {
+    double error = CurveX(curve, t) - x;
+    if (fabs(error) < kAnimationTimingCurveEpsilon) {
+      break;
+    }
+    if (error < 0) {
+      lower = t;
+    } else {
+      upper = t;
+    }
+    t = (lower + upper) / 2;
+  }
+  return t;
+}
+
+static void BuildCurve(AnimationTimingCurve *curve, const float *controlPoints) {
+  curve->cx = 3 * controlPoints[0];
+  curve->bx = 3 * (controlPoints[2] - controlPoints[0]) - curve->cx;
+  curve->ax = 1 - curve->cx - curve->bx;
+  curve->cy = 3 * controlPoints[1];
+  curve->by = 3 * (controlPoints[3] - controlPoints[1]) - curve->cy;
+  curve->ay = 1 - curve->cy - curve->by;
+
+  for (NSInteger i = 0; i < kAnimationTimingCurveSampleCount; ++i) {
+    double x = (double)i / (kAnimationTimingCurveSampleCount - 1);
+    curve->parameters[i] = BisectParameter(curve, x, 0, 1);
+  }
+}
+
+static const AnimationTimingCurve *CurveForType(MDCAnimationTimingFunction type) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    for (NSUInteger i = 0; i < MDCAnimationTimingCurveCount; ++i) {
+      BuildCurve(&gCurves[i], MDCAnimationTimingControlPoints[i]);
+    }
+  });
+  if (type < MDCAnimationTimingCurveCount) {
+    return &gCurves[type];
+  }
+  NSCAssert(NO, @"Invalid MDCAnimationTimingFunction value %i.", (int)type);
+  return NULL;
+}
+
+static double EvaluateCurve(const AnimationTimingCurve *curve, double x) {
+  if (!(x > 0)) {
+    return 0;
+  }
+  if (x >= 1) {
+    return 1;
+  }
+
+  // x(t) is increasing, so the parameter lies between the parameters of the surrounding samples.
+  double position = x * (kAnimationTimingCurveSampleCount - 1);
+  NSInteger index = (NSInteger)position;
+  double lower = curve->parameters[index];
+  double upper = curve->parameters[index + 1];
+  double t = lower + (upper - lower) * (position - index);
+
+  for (NSInteger i = 0; i < kAnimationTimingCurveNewtonIterations; ++i) {
+    double error = CurveX(curve, t) - x;
+    if (fabs(error) < kAnimationTimingCurveEpsilon) {
+      return CurveY(curve, t);
+    }
+    double derivative = CurveDerivativeX(curve, t);
+    if (fabs(derivative) < 1e-6) {
+      break;
+    }
+    t -= error / derivative;
+    if (t < lower || t > upper) {
+      break;
+    }
+  }
+
+  // Newton's method converges poorly where the curve is nearly vertical, such as the start of
+  // Deceleration, so fall back to bisection between the samples.
+  return CurveY(curve, BisectParameter(curve, x, lower, upper));
+}
+
+CGFloat MDCAnimationTimingFunctionValue(MDCAnimationTimingFunction type, CGFloat progress) {
+  const AnimationTimingCurve *curve = CurveForType(type);
+  if (curve == NULL) {
+    // Reasonable default to use in Release mode for garbage input.
+    return progress;
+  }
+  return (CGFloat)EvaluateCurve(curve, progress);
+}
+
+void MDCAnimationTimingFunctionValues(MDCAnimationTimingFunction type,
+                                      const CGFloat *progress,
+                                      CGFloat *values,
+                                      NSUInteger count) {
+  const AnimationTimingCurve *curve = CurveForType(type);
+  for (NSUInteger i = 0; i < count; ++i) {
+    values[i] = curve ? (CGFloat)EvaluateCurve(curve, progress[i]) : progress[i];
+  }
+}
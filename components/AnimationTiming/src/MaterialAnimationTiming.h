@@ -12,5 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "CAAnimation+MDCAnimationTiming.h"
 #import "CAMediaTimingFunction+MDCAnimationTiming.h"
+#import "MDCAnimationTimingCurve.h"
 #import "UIView+MDCTimingFunction.h"
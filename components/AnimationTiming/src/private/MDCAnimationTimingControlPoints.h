@@ -0,0 +1,27 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+#import "CAMediaTimingFunction+MDCAnimationTiming.h"
+
+/** The number of MDCAnimationTimingFunction values that aren't aliases. */
+#define MDCAnimationTimingCurveCount (MDCAnimationTimingFunctionSharp + 1)
+
+/**
+ The bezier control points (x1, y1, x2, y2) of each Material Design easing curve, indexed by
+ MDCAnimationTimingFunction. Shared by the Core Animation timing functions and the curves evaluated
+ without Core Animation, so the two can't drift apart.
+ */
+FOUNDATION_EXTERN const float MDCAnimationTimingControlPoints[MDCAnimationTimingCurveCount][4];
@@ -13,8 +13,34 @@
 // limitations under the License.
 
 #import <XCTest/XCTest.h>
+#import "../../src/private/CAAnimation+MDCAnimationTiming+Private.h"
 #import "MaterialAnimationTiming.h"
 
+/** Returns the point at @c t of the one-dimensional cubic bezier from 0 to 1. */
+static double BezierValue(double controlPoint1, double controlPoint2, double t) {
+  double s = 1 - t;
+  return 3 * controlPoint1 * s * s * t + 3 * controlPoint2 * s * t * t + t * t * t;
+}
+
+/** Returns y(x) of @c function, solving for the bezier parameter of @c x by bisection. */
+static double ExactTimingFunctionValue(CAMediaTimingFunction *function, double x) {
+  float controlPoint1[2];
+  float controlPoint2[2];
+  [function getControlPointAtIndex:1 values:controlPoint1];
+  [function getControlPointAtIndex:2 values:controlPoint2];
+  double lower = 0;
+  double upper = 1;
+  for (NSInteger i = 0; i < 100; ++i) {
+    double t = (lower + upper) / 2;
+    if (BezierValue(controlPoint1[0], controlPoint2[0], t) < x) {
+      lower = t;
+    } else {
+      upper = t;
+    }
+  }
+  return BezierValue(controlPoint1[1], controlPoint2[1], (lower + upper) / 2);
+}
+
 @interface AnimationTimingTests : XCTestCase
 
 @end
@@ -25,4 +51,143 @@
   XCTAssertTrue(YES);
 }
 
+- (void)testTimingFunctionsAreShared {
+  // Given
+  MDCAnimationTimingFunction types[] = {
+      MDCAnimationTimingFunctionStandard,
+      MDCAnimationTimingFunctionDeceleration,
+      MDCAnimationTimingFunctionAcceleration,
+      MDCAnimationTimingFunctionSharp,
+  };
+
+  for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+    // When
+    CAMediaTimingFunction *function1 = [CAMediaTimingFunction mdc_functionWithType:types[i]];
+    CAMediaTimingFunction *function2 = [CAMediaTimingFunction mdc_functionWithType:types[i]];
+
+    // Then
+    XCTAssertNotNil(function1);
+    XCTAssertEqual(function1, function2);
+  }
+}
+
+- (void)testStandardTimingFunctionControlPoints {
+  // When
+  CAMediaTimingFunction *function =
+      [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+
+  // Then
+  float controlPoint1[2];
+  float controlPoint2[2];
+  [function getControlPointAtIndex:1 values:controlPoint1];
+  [function getControlPointAtIndex:2 values:controlPoint2];
+  XCTAssertEqualWithAccuracy(controlPoint1[0], 0.4, 0.0001);
+  XCTAssertEqualWithAccuracy(controlPoint1[1], 0, 0.0001);
+  XCTAssertEqualWithAccuracy(controlPoint2[0], 0.2, 0.0001);
+  XCTAssertEqualWithAccuracy(controlPoint2[1], 1, 0.0001);
+}
+
+- (void)testAnimationTemplateIsBuiltOnceAndCopied {
+  // Given
+  __block NSUInteger buildCount = 0;
+  MDCAnimationTemplateBuilder builder = ^CAAnimation * {
+    buildCount += 1;
+    CABasicAnimation *animation = [[CABasicAnimation alloc] init];
+    animation.keyPath = @"opacity";
+    animation.duration = 2;
+    return animation;
+  };
+  NSUInteger registryBuildCount = CAAnimation.mdc_animationTemplateBuildCount;
+  NSUInteger registryCopyCount = CAAnimation.mdc_animationTemplateCopyCount;
+
+  // When
+  CABasicAnimation *animation1 =
+      [CABasicAnimation mdc_animationWithTemplateKey:@"AnimationTimingTests.opacity"
+                                             builder:builder];
+  animation1.duration = 5;
+  CABasicAnimation *animation2 =
+      [CABasicAnimation mdc_animationWithTemplateKey:@"AnimationTimingTests.opacity"
+                                             builder:builder];
+
+  // Then
+  XCTAssertEqual(buildCount, 1U);
+  XCTAssertEqual(CAAnimation.mdc_animationTemplateBuildCount - registryBuildCount, 1U);
+  XCTAssertEqual(CAAnimation.mdc_animationTemplateCopyCount - registryCopyCount, 2U);
+  XCTAssertNotEqual(animation1, animation2);
+  XCTAssertEqualObjects(animation2.keyPath, @"opacity");
+  XCTAssertEqualWithAccuracy(animation2.duration, 2, 0.0001);
+}
+
+- (void)testTimingFunctionValuesMatchTimingFunctions {
+  // Given
+  MDCAnimationTimingFunction types[] = {
+      MDCAnimationTimingFunctionStandard,
+      MDCAnimationTimingFunctionDeceleration,
+      MDCAnimationTimingFunctionAcceleration,
+      MDCAnimationTimingFunctionSharp,
+  };
+
+  for (size_t i = 0; i < sizeof(types) / sizeof(types[0]); ++i) {
+    CAMediaTimingFunction *function = [CAMediaTimingFunction mdc_functionWithType:types[i]];
+    for (NSInteger step = 0; step <= 1000; ++step) {
+      CGFloat progress = (CGFloat)step / 1000;
+
+      // When
+      CGFloat value = MDCAnimationTimingFunctionValue(types[i], progress);
+
+      // Then
+      XCTAssertEqualWithAccuracy(value, ExactTimingFunctionValue(function, progress), 1e-6,
+                                 @"Curve %@ at %@", @(types[i]), @(progress));
+    }
+  }
+}
+
+- (void)testTimingFunctionValueClampsProgress {
+  // When
+  CGFloat valueBeforeStart =
+      MDCAnimationTimingFunctionValue(MDCAnimationTimingFunctionStandard, (CGFloat)-0.5);
+  CGFloat valueAfterEnd =
+      MDCAnimationTimingFunctionValue(MDCAnimationTimingFunctionStandard, (CGFloat)1.5);
+
+  // Then
+  XCTAssertEqual(valueBeforeStart, 0);
+  XCTAssertEqual(valueAfterEnd, 1);
+}
+
+- (void)testTimingFunctionValuesMatchSingleValues {
+  // Given
+  CGFloat progress[101];
+  for (NSInteger i = 0; i < 101; ++i) {
+    progress[i] = (CGFloat)i / 100;
+  }
+  CGFloat values[101];
+
+  // When
+  MDCAnimationTimingFunctionValues(MDCAnimationTimingFunctionDeceleration, progress, values, 101);
+
+  // Then
+  for (NSInteger i = 0; i < 101; ++i) {
+    XCTAssertEqual(values[i], MDCAnimationTimingFunctionValue(
+                                  MDCAnimationTimingFunctionDeceleration, progress[i]));
+  }
+}
+
+- (void)testTimingFunctionValuesPerformance {
+  // Given
+  static const NSUInteger count = 100000;
+  CGFloat *progress = malloc(count * sizeof(CGFloat));
+  CGFloat *values = malloc(count * sizeof(CGFloat));
+  for (NSUInteger i = 0; i < count; ++i) {
+    progress[i] = (CGFloat)i / (count - 1);
+  }
+
+  // When
+  [self measureBlock:^{
+    MDCAnimationTimingFunctionValues(MDCAnimationTimingFunctionStandard, progress, values, count);
+  }];
+
+  free(progress);
+  free(values);
+}
+
 @end
@@ -1591,6 +1591,21 @@ static NSString *controlStateDescription(UIControlState controlState) {
   XCTAssertNil(self.button.shapeGenerator);
 }
 
+- (void)testSettingSameShapeGeneratorAgainKeepsTheShadowPath {
+  // Given
+  MDCRectangleShapeGenerator *shapeGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  [shapeGenerator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:4]];
+  self.button.frame = CGRectMake(0, 0, 100, 40);
+  self.button.shapeGenerator = shapeGenerator;
+
+  // When
+  self.button.shapeGenerator = shapeGenerator;
+
+  // Then
+  CGPathRef expectedPath = [shapeGenerator pathForSize:CGSizeMake(100, 40)];
+  XCTAssertTrue(CGPathEqualToPath(self.button.layer.shadowPath, expectedPath));
+}
+
 - (void)testSettingVisibleAreaInsetCreatesCorrectShape {
   // Given
   CGFloat cornerRadius = 5;
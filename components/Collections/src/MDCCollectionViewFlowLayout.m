@@ -21,6 +21,8 @@
 #import "private/MDCCollectionGridBackgroundView.h"
 #import "private/MDCCollectionInfoBarView.h"
 #import "private/MDCCollectionViewEditor.h"
+#import "private/MDCCollectionViewSectionOrdinals.h"
+#import "private/MDCCollectionViewStyler.h"
 
 #include <tgmath.h>
 
@@ -37,6 +39,17 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   NSMutableIndexSet *_headerSections;
   NSMutableIndexSet *_footerSections;
   NSMutableDictionary *_decorationViewAttributeCache;
+
+  // Decorated attributes, reused across queries until the layout, the editing state or the styler
+  // is invalidated.
+  NSMutableDictionary<NSIndexPath *, MDCCollectionViewLayoutAttributes *> *_itemAttributeCache;
+  NSMutableDictionary<NSString *, NSMutableDictionary *> *_supplementaryAttributeCache;
+  BOOL _cachedAttributesEditing;
+  NSUInteger _cachedAttributesStyleGeneration;
+
+  // An array of MDCCollectionViewSectionOrdinals, one per section, built on first use after each
+  // invalidation.
+  NSMutableData *_sectionOrdinals;
 }
 
 - (instancetype)init {
@@ -65,6 +78,10 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
   // Register decoration view for grid background.
   _decorationViewAttributeCache = [NSMutableDictionary dictionary];
+  _itemAttributeCache = [NSMutableDictionary dictionary];
+  _supplementaryAttributeCache = [NSMutableDictionary dictionary];
+  _headerSections = [NSMutableIndexSet indexSet];
+  _footerSections = [NSMutableIndexSet indexSet];
   [self registerClass:[MDCCollectionGridBackgroundView class]
       forDecorationViewOfKind:kCollectionGridDecorationView];
 }
@@ -94,16 +111,27 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   // If performing appearance animation, increase bounds height in order to retrieve additional
   // offscreen attributes needed during animation.
   rect = [self boundsForAppearanceAnimationWithInitialBounds:rect];
-  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes =
-      [[NSMutableArray alloc] initWithArray:[super layoutAttributesForElementsInRect:rect]
-                                  copyItems:YES];
+  NSArray<__kindof UICollectionViewLayoutAttributes *> *superAttributes =
+      [super layoutAttributesForElementsInRect:rect];
+  NSMutableArray<__kindof UICollectionViewLayoutAttributes *> *attributes;
+  [self validateAttributeCache];
 
   // Store index path sections of any headers/footers within these attributes.
-  [self storeSupplementaryViewsWithAttributes:attributes];
+  [self storeSupplementaryViewsWithAttributes:superAttributes];
 
-  // Set layout attributes.
-  for (MDCCollectionViewLayoutAttributes *attr in attributes) {
-    [self updateAttribute:attr];
+  if (self.styler.shouldAnimateCellsOnAppearance && self.styler.willAnimateCellsOnAppearance) {
+    // The appearance animation offsets the frames of the returned attributes, so it must operate
+    // on copies rather than on cached attributes.
+    attributes = [[NSMutableArray alloc] initWithArray:superAttributes copyItems:YES];
+    for (MDCCollectionViewLayoutAttributes *attr in attributes) {
+      [self updateAttribute:attr];
+    }
+  } else {
+    // Scrolling only changes which elements are in the rect, so reuse their decorated attributes.
+    attributes = [[NSMutableArray alloc] initWithCapacity:superAttributes.count];
+    for (UICollectionViewLayoutAttributes *superAttr in superAttributes) {
+      [attributes addObject:[self cachedAttributeForAttribute:superAttr]];
+    }
   }
 
   // Add info bar header/footer supplementary view if necessary.
@@ -135,6 +163,18 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
   // Clear decoration attribute cache.
   [_decorationViewAttributeCache removeAllObjects];
+  [self removeAllCachedAttributes];
+  [_headerSections removeAllIndexes];
+  [_footerSections removeAllIndexes];
+}
+
+- (void)invalidateLayoutWithContext:(UICollectionViewLayoutInvalidationContext *)context {
+  [super invalidateLayoutWithContext:context];
+
+  // Data source changes and self-sizing invalidate through a context rather than -invalidateLayout.
+  [self removeAllCachedAttributes];
+  [_headerSections removeAllIndexes];
+  [_footerSections removeAllIndexes];
 }
 
 #pragma mark - UICollectionViewLayout (UISubclassingHooks)
@@ -144,6 +184,13 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 }
 
 - (UICollectionViewLayoutAttributes *)layoutAttributesForItemAtIndexPath:(NSIndexPath *)indexPath {
+  // Only -layoutAttributesForElementsInRect: populates the cache: the flow layout delegate queries
+  // this method while the layout is being prepared, before frames are final.
+  [self validateAttributeCache];
+  MDCCollectionViewLayoutAttributes *cachedAttr = _itemAttributeCache[indexPath];
+  if (cachedAttr) {
+    return cachedAttr;
+  }
   UICollectionViewLayoutAttributes *attr =
       [[super layoutAttributesForItemAtIndexPath:indexPath] copy];
   return [self updateAttribute:(MDCCollectionViewLayoutAttributes *)attr];
@@ -157,6 +204,11 @@ static const NSInteger kSupplementaryViewZIndex = 99;
   if ([kind isEqualToString:UICollectionElementKindSectionHeader] ||
       [kind isEqualToString:UICollectionElementKindSectionFooter]) {
     // Update section headers/Footers attributes.
+    [self validateAttributeCache];
+    attr = _supplementaryAttributeCache[kind][indexPath];
+    if (attr) {
+      return attr;
+    }
     attr = [[super layoutAttributesForSupplementaryViewOfKind:kind atIndexPath:indexPath] copy];
     if (!attr) {
       attr =
@@ -340,19 +392,157 @@ static const NSInteger kSupplementaryViewZIndex = 99;
 
 - (void)storeSupplementaryViewsWithAttributes:
     (NSArray<__kindof UICollectionViewLayoutAttributes *> *)attributes {
-  _headerSections = [NSMutableIndexSet indexSet];
-  _footerSections = [NSMutableIndexSet indexSet];
-
-  // Store index path sections for headers/footers.
+  // Store index path sections for headers/footers. Sections accumulate until the layout is
+  // invalidated. Ordinal positions depend on them, so discovering a header or footer discards the
+  // cached attributes of its section.
   for (MDCCollectionViewLayoutAttributes *attr in attributes) {
+    NSInteger section = attr.indexPath.section;
     if ([attr.representedElementKind isEqualToString:UICollectionElementKindSectionHeader]) {
-      [_headerSections addIndex:attr.indexPath.section];
+      if (![_headerSections containsIndex:section]) {
+        [_headerSections addIndex:section];
+        [self removeCachedAttributesInSection:section];
+        [self updateOrdinalsForSection:section];
+      }
     } else if ([attr.representedElementKind isEqualToString:UICollectionElementKindSectionFooter]) {
-      [_footerSections addIndex:attr.indexPath.section];
+      if (![_footerSections containsIndex:section]) {
+        [_footerSections addIndex:section];
+        [self removeCachedAttributesInSection:section];
+        [self updateOrdinalsForSection:section];
+      }
     }
   }
 }
 
+#pragma mark - Attribute Caching
+
+- (void)validateAttributeCache {
+  // Decorated attributes embed the editing state and the styler's properties. The styler counts
+  // the style changes that invalidate the layout.
+  id<MDCCollectionViewStyling> styler = self.styler;
+  NSUInteger styleGeneration = 0;
+  if ([styler isKindOfClass:[MDCCollectionViewStyler class]]) {
+    styleGeneration = ((MDCCollectionViewStyler *)styler).layoutInvalidationGeneration;
+  } else if (styler.shouldInvalidateLayout) {
+    // Other stylers can't tell when their style last changed.
+    styleGeneration = _cachedAttributesStyleGeneration + 1;
+  }
+  BOOL isEditing = self.editor.isEditing;
+  if (styleGeneration != _cachedAttributesStyleGeneration ||
+      isEditing != _cachedAttributesEditing) {
+    [self removeAllCachedAttributes];
+    _cachedAttributesStyleGeneration = styleGeneration;
+    _cachedAttributesEditing = isEditing;
+  }
+}
+
+- (MDCCollectionViewLayoutAttributes *)cachedAttributeForAttribute:
+    (UICollectionViewLayoutAttributes *)superAttr {
+  NSIndexPath *indexPath = superAttr.indexPath;
+  MDCCollectionViewLayoutAttributes *attr;
+  if (superAttr.representedElementCategory == UICollectionElementCategoryCell) {
+    attr = _itemAttributeCache[indexPath];
+    if (!attr) {
+      attr = [self updateAttribute:[superAttr copy]];
+      _itemAttributeCache[indexPath] = attr;
+    }
+  } else if (superAttr.representedElementCategory ==
+             UICollectionElementCategorySupplementaryView) {
+    attr = _supplementaryAttributeCache[superAttr.representedElementKind][indexPath];
+    if (!attr) {
+      attr = [self updateAttribute:[superAttr copy]];
+      [self cacheSupplementaryAttribute:attr];
+    }
+  } else {
+    attr = [self updateAttribute:[superAttr copy]];
+  }
+  return attr;
+}
+
+- (void)cacheSupplementaryAttribute:(MDCCollectionViewLayoutAttributes *)attr {
+  NSString *kind = attr.representedElementKind;
+  NSMutableDictionary *kindCache = _supplementaryAttributeCache[kind];
+  if (!kindCache) {
+    kindCache = [NSMutableDictionary dictionary];
+    _supplementaryAttributeCache[kind] = kindCache;
+  }
+  kindCache[attr.indexPath] = attr;
+}
+
+- (void)removeCachedAttributesInSection:(NSInteger)section {
+  NSMutableArray<NSIndexPath *> *indexPaths = [NSMutableArray array];
+  for (NSIndexPath *indexPath in _itemAttributeCache) {
+    if (indexPath.section == section) {
+      [indexPaths addObject:indexPath];
+    }
+  }
+  [_itemAttributeCache removeObjectsForKeys:indexPaths];
+  for (NSMutableDictionary *kindCache in _supplementaryAttributeCache.allValues) {
+    [indexPaths removeAllObjects];
+    for (NSIndexPath *indexPath in kindCache) {
+      if (indexPath.section == section) {
+        [indexPaths addObject:indexPath];
+      }
+    }
+    [kindCache removeObjectsForKeys:indexPaths];
+  }
+}
+
+- (void)removeAllCachedAttributes {
+  [_itemAttributeCache removeAllObjects];
+  [_supplementaryAttributeCache removeAllObjects];
+  _sectionOrdinals = nil;
+}
+
+#pragma mark - Section Ordinals
+
+- (MDCCollectionViewSectionOrdinals)computeOrdinalsForSection:(NSInteger)section {
+  BOOL hidesHeaderBackground = NO;
+  if ([self.styler.delegate respondsToSelector:@selector(collectionView:
+                                                   shouldHideHeaderBackgroundForSection:)]) {
+    hidesHeaderBackground = [self.styler.delegate collectionView:self.styler.collectionView
+                            shouldHideHeaderBackgroundForSection:section];
+  }
+
+  BOOL hidesFooterBackground = NO;
+  if ([self.styler.delegate respondsToSelector:@selector(collectionView:
+                                                   shouldHideFooterBackgroundForSection:)]) {
+    hidesFooterBackground = [self.styler.delegate collectionView:self.styler.collectionView
+                            shouldHideFooterBackgroundForSection:section];
+  }
+
+  return MDCCollectionViewSectionOrdinalsMake([self numberOfItemsInSection:section],
+                                              self.styler.gridColumnCount,
+                                              [_headerSections containsIndex:section],
+                                              [_footerSections containsIndex:section],
+                                              hidesHeaderBackground, hidesFooterBackground);
+}
+
+- (MDCCollectionViewSectionOrdinals)ordinalsForSection:(NSInteger)section {
+  if (!_sectionOrdinals) {
+    NSInteger numberOfSections = self.collectionView.numberOfSections;
+    _sectionOrdinals = [NSMutableData
+        dataWithLength:(NSUInteger)numberOfSections * sizeof(MDCCollectionViewSectionOrdinals)];
+    MDCCollectionViewSectionOrdinals *ordinals = _sectionOrdinals.mutableBytes;
+    for (NSInteger i = 0; i < numberOfSections; ++i) {
+      ordinals[i] = [self computeOrdinalsForSection:i];
+    }
+  }
+  NSUInteger count = _sectionOrdinals.length / sizeof(MDCCollectionViewSectionOrdinals);
+  if (section < 0 || (NSUInteger)section >= count) {
+    // The data source changed without invalidating the layout.
+    return [self computeOrdinalsForSection:section];
+  }
+  return ((MDCCollectionViewSectionOrdinals *)_sectionOrdinals.mutableBytes)[section];
+}
+
+- (void)updateOrdinalsForSection:(NSInteger)section {
+  NSUInteger count = _sectionOrdinals.length / sizeof(MDCCollectionViewSectionOrdinals);
+  if (section >= 0 && (NSUInteger)section < count) {
+    MDCCollectionViewSectionOrdinals *ordinals = _sectionOrdinals.mutableBytes;
+    ordinals[section] = [self computeOrdinalsForSection:section];
+  }
+}
+
 #pragma mark - Private
 
 - (MDCCollectionViewLayoutAttributes *)updateAttribute:(MDCCollectionViewLayoutAttributes *)attr {
@@ -454,90 +644,30 @@ static const NSInteger kSupplementaryViewZIndex = 99;
     (MDCCollectionViewLayoutAttributes *)attr {
   // Returns the ordinal position of cells and supplementary views within a list layout. This is
   // used to determine the layout attributes applied to their styling.
-  MDCCollectionViewOrdinalPosition position = 0;
-  NSIndexPath *indexPath = attr.indexPath;
-  NSInteger numberOfItemsInSection = [self numberOfItemsInSection:indexPath.section];
-  BOOL isTop = NO;
-  BOOL isBottom = NO;
-  BOOL hasSectionHeader = [_headerSections containsIndex:indexPath.section];
-  BOOL hasSectionFooter = [_footerSections containsIndex:indexPath.section];
-  BOOL hasSectionItems = [self numberOfItemsInSection:indexPath.section] > 0;
-
-  BOOL hidesHeaderBackground = NO;
-  if ([self.styler.delegate respondsToSelector:@selector(collectionView:
-                                                   shouldHideHeaderBackgroundForSection:)]) {
-    hidesHeaderBackground = [self.styler.delegate collectionView:self.styler.collectionView
-                            shouldHideHeaderBackgroundForSection:indexPath.section];
-  }
-
-  BOOL hidesFooterBackground = NO;
-  if ([self.styler.delegate respondsToSelector:@selector(collectionView:
-                                                   shouldHideFooterBackgroundForSection:)]) {
-    hidesFooterBackground = [self.styler.delegate collectionView:self.styler.collectionView
-                            shouldHideFooterBackgroundForSection:indexPath.section];
+  if (attr.editing || [self.styler isItemInlaidAtIndexPath:attr.indexPath]) {
+    return MDCCollectionViewOrdinalPositionVerticalTopBottom;
   }
 
+  MDCCollectionViewSectionOrdinals ordinals = [self ordinalsForSection:attr.indexPath.section];
   if (attr.representedElementCategory == UICollectionElementCategoryCell) {
-    isTop = (indexPath.item == 0) && (!hasSectionHeader || hidesHeaderBackground);
-    isBottom = (indexPath.item == numberOfItemsInSection - 1) &&
-               (!hasSectionFooter || hidesFooterBackground);
+    return MDCCollectionViewSectionOrdinalsListItemPosition(&ordinals, attr.indexPath.item);
   } else if (attr.representedElementCategory == UICollectionElementCategorySupplementaryView) {
     NSString *kind = attr.representedElementKind;
-    BOOL isElementHeader = ([kind isEqualToString:UICollectionElementKindSectionHeader]);
-    BOOL isElementFooter = ([kind isEqualToString:UICollectionElementKindSectionFooter]);
-    isTop = (isElementFooter && !hasSectionItems && !hasSectionHeader) || isElementHeader;
-    isBottom = (isElementHeader && !hasSectionItems && !hasSectionFooter) || isElementFooter;
-  }
-
-  if (attr.editing || [self.styler isItemInlaidAtIndexPath:attr.indexPath]) {
-    isTop = YES;
-    isBottom = YES;
-  }
-
-  if (!isTop && !isBottom) {
-    position |= MDCCollectionViewOrdinalPositionVerticalCenter;
-  } else {
-    position |= isTop ? MDCCollectionViewOrdinalPositionVerticalTop : position;
-    position |= isBottom ? MDCCollectionViewOrdinalPositionVerticalBottom : position;
+    if ([kind isEqualToString:UICollectionElementKindSectionHeader]) {
+      return MDCCollectionViewSectionOrdinalsHeaderPosition(&ordinals);
+    } else if ([kind isEqualToString:UICollectionElementKindSectionFooter]) {
+      return MDCCollectionViewSectionOrdinalsFooterPosition(&ordinals);
+    }
   }
-  return position;
+  return MDCCollectionViewOrdinalPositionVerticalCenter;
 }
 
 - (MDCCollectionViewOrdinalPosition)ordinalPositionForGridElementWithAttribute:
     (MDCCollectionViewLayoutAttributes *)attr {
   // Returns the ordinal position of cells and supplementary views within a grid layout. This is
   // used to determine the layout attributes applied to their styling.
-  MDCCollectionViewOrdinalPosition position = 0;
-  NSIndexPath *indexPath = attr.indexPath;
-  NSInteger numberOfItemsInSection = [self numberOfItemsInSection:indexPath.section];
-  NSInteger gridColumnCount = self.styler.gridColumnCount;
-  NSInteger maxRowIndex = (NSInteger)(floor(numberOfItemsInSection / gridColumnCount) - 1);
-  NSInteger maxColumnIndex = gridColumnCount - 1;
-  NSInteger ordinalRow = (NSInteger)(floor(indexPath.item / gridColumnCount));
-  NSInteger ordinalColumn = (NSInteger)(floor(indexPath.item % gridColumnCount));
-
-  // Set vertical ordinal position.
-  if (ordinalRow > 0 && ordinalRow < maxRowIndex) {
-    position = position | MDCCollectionViewOrdinalPositionVerticalCenter;
-  } else {
-    position =
-        (ordinalRow == 0) ? position | MDCCollectionViewOrdinalPositionVerticalTop : position;
-    position = (ordinalRow == maxRowIndex)
-                   ? position | MDCCollectionViewOrdinalPositionVerticalBottom
-                   : position;
-  }
-
-  // Set horizontal ordinal position.
-  if (ordinalColumn > 0 && ordinalColumn < maxColumnIndex) {
-    position = position | MDCCollectionViewOrdinalPositionHorizontalCenter;
-  } else {
-    position =
-        (ordinalColumn == 0) ? position | MDCCollectionViewOrdinalPositionHorizontalLeft : position;
-    position = (ordinalColumn == maxColumnIndex)
-                   ? position | MDCCollectionViewOrdinalPositionHorizontalRight
-                   : position;
-  }
-  return position;
+  MDCCollectionViewSectionOrdinals ordinals = [self ordinalsForSection:attr.indexPath.section];
+  return MDCCollectionViewSectionOrdinalsGridPosition(&ordinals, attr.indexPath.item);
 }
 
 - (void)updateCellStateMaskWithAttribute:(MDCCollectionViewLayoutAttributes *)attr {
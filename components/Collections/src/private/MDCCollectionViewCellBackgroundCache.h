@@ -0,0 +1,61 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/**
+ A process-wide cache of the resizable cell background images drawn by MDCCollectionViewStyler.
+
+ Images are keyed by every input that varies between stylers: the background options (card or
+ grouped style, top/bottom position and highlight), the cell background color, the card border
+ radius and the screen scale. Border color and width, shadow and separator metrics are constants of
+ the styler and therefore identical for every image. Stylers of different collection view
+ controllers that draw identical backgrounds share one rasterized image.
+
+ The cache is memory-pressure aware: it is backed by NSCache and emptied when the application
+ receives a memory warning.
+ */
+@interface MDCCollectionViewCellBackgroundCache : NSObject
+
+@property(class, nonatomic, readonly, nonnull) MDCCollectionViewCellBackgroundCache *sharedCache;
+
+/** The number of lookups that found a cached image. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of lookups that did not find a cached image. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/** The number of images evicted, either by NSCache or because of a memory warning. */
+@property(nonatomic, readonly) NSUInteger evictionCount;
+
+/** Returns the cached image for the given inputs, or nil, and updates the hit/miss counters. */
+- (nullable UIImage *)imageForBackgroundOptions:(NSUInteger)backgroundOptions
+                                backgroundColor:(nonnull UIColor *)backgroundColor
+                                   borderRadius:(CGFloat)borderRadius
+                                          scale:(CGFloat)scale;
+
+/** Stores @c image for the given inputs. */
+- (void)setImage:(nonnull UIImage *)image
+    forBackgroundOptions:(NSUInteger)backgroundOptions
+         backgroundColor:(nonnull UIColor *)backgroundColor
+            borderRadius:(CGFloat)borderRadius
+                   scale:(CGFloat)scale;
+
+/** Removes every cached image. */
+- (void)removeAllImages;
+
+/** Resets the hit, miss and eviction counters to zero. */
+- (void)resetStatistics;
+
+@end
@@ -0,0 +1,180 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCCollectionViewCellBackgroundCache.h"
+
+/** The inputs that identify a cell background image. */
+@interface MDCCollectionViewCellBackgroundKey : NSObject <NSCopying>
+@property(nonatomic, readonly) NSUInteger backgroundOptions;
+@property(nonatomic, readonly, nonnull) UIColor *backgroundColor;
+@property(nonatomic, readonly) CGFloat borderRadius;
+@property(nonatomic, readonly) CGFloat scale;
+@end
+
+@implementation MDCCollectionViewCellBackgroundKey
+
+- (instancetype)initWithBackgroundOptions:(NSUInteger)backgroundOptions
+                          backgroundColor:(UIColor *)backgroundColor
+                             borderRadius:(CGFloat)borderRadius
+                                    scale:(CGFloat)scale {
+  self = [super init];
+  if (self) {
+    _backgroundOptions = backgroundOptions;
+    _backgroundColor = backgroundColor;
+    _borderRadius = borderRadius;
+    _scale = scale;
+  }
+  return self;
+}
+
+- (id)copyWithZone:(__unused NSZone *)zone {
+  // Immutable.
+  return self;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCCollectionViewCellBackgroundKey class]]) {
+    return NO;
+  }
+  MDCCollectionViewCellBackgroundKey *otherKey = (MDCCollectionViewCellBackgroundKey *)object;
+  return _backgroundOptions == otherKey.backgroundOptions &&
+         _borderRadius == otherKey.borderRadius && _scale == otherKey.scale &&
+         [_backgroundColor isEqual:otherKey.backgroundColor];
+}
+
+- (NSUInteger)hash {
+  return _backgroundOptions ^ _backgroundColor.hash ^ @(_borderRadius).hash ^ @(_scale).hash;
+}
+
+@end
+
+@interface MDCCollectionViewCellBackgroundCache () <NSCacheDelegate>
+@end
+
+@implementation MDCCollectionViewCellBackgroundCache {
+  NSCache<MDCCollectionViewCellBackgroundKey *, UIImage *> *_images;
+  NSUInteger _hitCount;
+  NSUInteger _missCount;
+  NSUInteger _evictionCount;
+}
+
++ (MDCCollectionViewCellBackgroundCache *)sharedCache {
+  static MDCCollectionViewCellBackgroundCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCCollectionViewCellBackgroundCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _images = [[NSCache alloc] init];
+    _images.name = @"com.google.MaterialComponents.CollectionViewCellBackgroundCache";
+    _images.delegate = self;
+    [[NSNotificationCenter defaultCenter]
+        addObserver:self
+           selector:@selector(didReceiveMemoryWarning:)
+               name:UIApplicationDidReceiveMemoryWarningNotification
+             object:nil];
+  }
+  return self;
+}
+
+- (void)dealloc {
+  [[NSNotificationCenter defaultCenter] removeObserver:self];
+}
+
+- (NSUInteger)hitCount {
+  @synchronized(self) {
+    return _hitCount;
+  }
+}
+
+- (NSUInteger)missCount {
+  @synchronized(self) {
+    return _missCount;
+  }
+}
+
+- (NSUInteger)evictionCount {
+  @synchronized(self) {
+    return _evictionCount;
+  }
+}
+
+- (UIImage *)imageForBackgroundOptions:(NSUInteger)backgroundOptions
+                       backgroundColor:(UIColor *)backgroundColor
+                          borderRadius:(CGFloat)borderRadius
+                                 scale:(CGFloat)scale {
+  MDCCollectionViewCellBackgroundKey *key =
+      [[MDCCollectionViewCellBackgroundKey alloc] initWithBackgroundOptions:backgroundOptions
+                                                            backgroundColor:backgroundColor
+                                                               borderRadius:borderRadius
+                                                                      scale:scale];
+  UIImage *image = [_images objectForKey:key];
+  @synchronized(self) {
+    if (image) {
+      _hitCount++;
+    } else {
+      _missCount++;
+    }
+  }
+  return image;
+}
+
+- (void)setImage:(UIImage *)image
+    forBackgroundOptions:(NSUInteger)backgroundOptions
+         backgroundColor:(UIColor *)backgroundColor
+            borderRadius:(CGFloat)borderRadius
+                   scale:(CGFloat)scale {
+  MDCCollectionViewCellBackgroundKey *key =
+      [[MDCCollectionViewCellBackgroundKey alloc] initWithBackgroundOptions:backgroundOptions
+                                                            backgroundColor:backgroundColor
+                                                               borderRadius:borderRadius
+                                                                      scale:scale];
+  [_images setObject:image forKey:key];
+}
+
+- (void)removeAllImages {
+  [_images removeAllObjects];
+}
+
+- (void)resetStatistics {
+  @synchronized(self) {
+    _hitCount = 0;
+    _missCount = 0;
+    _evictionCount = 0;
+  }
+}
+
+#pragma mark - NSCacheDelegate
+
+- (void)cache:(__unused NSCache *)cache willEvictObject:(__unused id)obj {
+  @synchronized(self) {
+    _evictionCount++;
+  }
+}
+
+#pragma mark - Notifications
+
+- (void)didReceiveMemoryWarning:(__unused NSNotification *)notification {
+  [self removeAllImages];
+}
+
+@end
@@ -0,0 +1,76 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <Foundation/Foundation.h>
+
+#import "MaterialCollectionLayoutAttributes.h"
+
+/**
+ The per-section inputs of MDCCollectionViewFlowLayout's ordinal positions, with the values that
+ only depend on the section precomputed so every element's position is answered in O(1).
+
+ Create with MDCCollectionViewSectionOrdinalsMake once per layout invalidation.
+ */
+typedef struct MDCCollectionViewSectionOrdinals {
+  NSInteger numberOfItems;
+  NSInteger gridColumnCount;
+  BOOL hasHeader;
+  BOOL hasFooter;
+
+  /** Whether the first item draws the section's top edge in a list. */
+  BOOL firstItemIsTop;
+
+  /** Whether the last item draws the section's bottom edge in a list. */
+  BOOL lastItemIsBottom;
+
+  /** The index of the last full grid row. */
+  NSInteger maxGridRowIndex;
+} MDCCollectionViewSectionOrdinals;
+
+/**
+ Returns the ordinals of a section.
+
+ @param numberOfItems The number of items in the section.
+ @param gridColumnCount The styler's grid column count. Values below 1 are treated as 1.
+ @param hasHeader Whether the section has a header.
+ @param hasFooter Whether the section has a footer.
+ @param hidesHeaderBackground Whether the styling delegate hides the header background.
+ @param hidesFooterBackground Whether the styling delegate hides the footer background.
+ */
+FOUNDATION_EXTERN MDCCollectionViewSectionOrdinals
+MDCCollectionViewSectionOrdinalsMake(NSInteger numberOfItems,
+                                     NSInteger gridColumnCount,
+                                     BOOL hasHeader,
+                                     BOOL hasFooter,
+                                     BOOL hidesHeaderBackground,
+                                     BOOL hidesFooterBackground);
+
+/** Returns the list ordinal position of the item at @c item. */
+FOUNDATION_EXTERN MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsListItemPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals, NSInteger item);
+
+/** Returns the list ordinal position of the section header. */
+FOUNDATION_EXTERN MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsHeaderPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals);
+
+/** Returns the list ordinal position of the section footer. */
+FOUNDATION_EXTERN MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsFooterPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals);
+
+/**
+ Returns the grid ordinal position, both vertical and horizontal, of the element at @c item.
+ Supplementary views use their index path's item.
+ */
+FOUNDATION_EXTERN MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsGridPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals, NSInteger item);
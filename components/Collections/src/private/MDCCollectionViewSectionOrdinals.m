@@ -0,0 +1,88 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCCollectionViewSectionOrdinals.h"
+
+static MDCCollectionViewOrdinalPosition VerticalPosition(BOOL isTop, BOOL isBottom) {
+  if (!isTop && !isBottom) {
+    return MDCCollectionViewOrdinalPositionVerticalCenter;
+  }
+  MDCCollectionViewOrdinalPosition position = 0;
+  position |= isTop ? MDCCollectionViewOrdinalPositionVerticalTop : 0;
+  position |= isBottom ? MDCCollectionViewOrdinalPositionVerticalBottom : 0;
+  return position;
+}
+
+MDCCollectionViewSectionOrdinals MDCCollectionViewSectionOrdinalsMake(NSInteger numberOfItems,
+                                                                      NSInteger gridColumnCount,
+                                                                      BOOL hasHeader,
+                                                                      BOOL hasFooter,
+                                                                      BOOL hidesHeaderBackground,
+                                                                      BOOL hidesFooterBackground) {
+  MDCCollectionViewSectionOrdinals ordinals;
+  ordinals.numberOfItems = numberOfItems;
+  ordinals.gridColumnCount = MAX(gridColumnCount, 1);
+  ordinals.hasHeader = hasHeader;
+  ordinals.hasFooter = hasFooter;
+  ordinals.firstItemIsTop = !hasHeader || hidesHeaderBackground;
+  ordinals.lastItemIsBottom = !hasFooter || hidesFooterBackground;
+  // Only full rows count, so the items of a partial last row are not marked as bottom.
+  ordinals.maxGridRowIndex = numberOfItems / ordinals.gridColumnCount - 1;
+  return ordinals;
+}
+
+MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsListItemPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals, NSInteger item) {
+  BOOL isTop = item == 0 && ordinals->firstItemIsTop;
+  BOOL isBottom = item == ordinals->numberOfItems - 1 && ordinals->lastItemIsBottom;
+  return VerticalPosition(isTop, isBottom);
+}
+
+MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsHeaderPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals) {
+  BOOL isBottom = ordinals->numberOfItems <= 0 && !ordinals->hasFooter;
+  return VerticalPosition(YES, isBottom);
+}
+
+MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsFooterPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals) {
+  BOOL isTop = ordinals->numberOfItems <= 0 && !ordinals->hasHeader;
+  return VerticalPosition(isTop, YES);
+}
+
+MDCCollectionViewOrdinalPosition MDCCollectionViewSectionOrdinalsGridPosition(
+    const MDCCollectionViewSectionOrdinals *ordinals, NSInteger item) {
+  NSInteger maxRowIndex = ordinals->maxGridRowIndex;
+  NSInteger maxColumnIndex = ordinals->gridColumnCount - 1;
+  NSInteger row = item / ordinals->gridColumnCount;
+  NSInteger column = item % ordinals->gridColumnCount;
+  MDCCollectionViewOrdinalPosition position = 0;
+
+  // Set vertical ordinal position.
+  if (row > 0 && row < maxRowIndex) {
+    position |= MDCCollectionViewOrdinalPositionVerticalCenter;
+  } else {
+    position |= (row == 0) ? MDCCollectionViewOrdinalPositionVerticalTop : 0;
+    position |= (row == maxRowIndex) ? MDCCollectionViewOrdinalPositionVerticalBottom : 0;
+  }
+
+  // Set horizontal ordinal position.
+  if (column > 0 && column < maxColumnIndex) {
+    position |= MDCCollectionViewOrdinalPositionHorizontalCenter;
+  } else {
+    position |= (column == 0) ? MDCCollectionViewOrdinalPositionHorizontalLeft : 0;
+    position |= (column == maxColumnIndex) ? MDCCollectionViewOrdinalPositionHorizontalRight : 0;
+  }
+  return position;
+}
@@ -32,4 +32,10 @@
 - (nonnull instancetype)initWithCollectionView:(nonnull UICollectionView *)collectionView
     NS_DESIGNATED_INITIALIZER;
 
+/**
+ Incremented whenever a style change invalidates the layout. MDCCollectionViewFlowLayout compares
+ it with the value its cached attributes were decorated at.
+ */
+@property(nonatomic, readonly) NSUInteger layoutInvalidationGeneration;
+
 @end
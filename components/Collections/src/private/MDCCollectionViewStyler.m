@@ -14,6 +14,7 @@
 
 #import "MDCCollectionViewStyler.h"
 
+#import "MDCCollectionViewCellBackgroundCache.h"
 #import "MaterialCollectionLayoutAttributes.h"
 #import "MDCCollectionViewStylingDelegate.h"
 #import "MaterialPalettes.h"
@@ -81,13 +82,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 
 @interface MDCCollectionViewStyler ()
 
-/**
- A dictionary of NSPointerArray caches, keyed by UIColor, for cached cell background images
- using that background color. Index into the NSPointerArray using the results of
- backgroundCacheKeyForCardStyle:isGroupedStyle:isTop:isBottom:isHighlighted:
- */
-@property(nonatomic, readonly) NSMutableDictionary *cellBackgroundCaches;
-
 /** An set of index paths for items that are inlaid. */
 @property(nonatomic, strong) NSMutableSet *inlaidIndexPathSet;
 
@@ -143,9 +137,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
     // Animate cell on appearance settings.
     _animateCellsOnAppearancePadding = kCollectionViewAnimatedAppearancePadding;
     _animateCellsOnAppearanceDuration = kCollectionViewAnimatedAppearanceDuration;
-
-    // Caching.
-    _cellBackgroundCaches = [NSMutableDictionary dictionary];
   }
   return self;
 }
@@ -197,12 +188,6 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   return options;
 }
 
-- (NSPointerArray *)cellBackgroundCache {
-  NSPointerArray *cache = [NSPointerArray strongObjectsPointerArray];
-  cache.count = BackgroundCacheKeyMax;
-  return cache;
-}
-
 #pragma mark - Separators
 
 - (void)setSeparatorColor:(UIColor *)separatorColor {
@@ -241,11 +226,50 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   if (_cellStyle == cellStyle) {
     return;
   }
-  [_cellBackgroundCaches removeAllObjects];
   [self invalidateLayoutForStyleChange];
   _cellStyle = cellStyle;
 }
 
+- (void)setCellBackgroundColor:(UIColor *)cellBackgroundColor {
+  if (_cellBackgroundColor == cellBackgroundColor) {
+    return;
+  }
+  [self invalidateLayoutForStyleChange];
+  _cellBackgroundColor = cellBackgroundColor;
+}
+
+- (void)setCardBorderRadius:(CGFloat)cardBorderRadius {
+  if (_cardBorderRadius == cardBorderRadius) {
+    return;
+  }
+  [self invalidateLayoutForStyleChange];
+  _cardBorderRadius = cardBorderRadius;
+}
+
+- (void)setCellLayoutType:(MDCCollectionViewCellLayoutType)cellLayoutType {
+  if (_cellLayoutType == cellLayoutType) {
+    return;
+  }
+  [self invalidateLayoutForStyleChange];
+  _cellLayoutType = cellLayoutType;
+}
+
+- (void)setGridColumnCount:(NSInteger)gridColumnCount {
+  if (_gridColumnCount == gridColumnCount) {
+    return;
+  }
+  [self invalidateLayoutForStyleChange];
+  _gridColumnCount = gridColumnCount;
+}
+
+- (void)setGridPadding:(CGFloat)gridPadding {
+  if (_gridPadding == gridPadding) {
+    return;
+  }
+  [self invalidateLayoutForStyleChange];
+  _gridPadding = gridPadding;
+}
+
 - (BOOL)shouldHideSeparatorForCellLayoutAttributes:(MDCCollectionViewLayoutAttributes *)attr {
   BOOL shouldHideSeparator = self.shouldHideSeparators;
   if (!self.delegate) {
@@ -450,7 +474,7 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
           }
         }];
   } else {
-    _shouldInvalidateLayout = YES;
+    self.shouldInvalidateLayout = YES;
 
     // Create new layout with existing layout properties.
     NSData *data =
@@ -467,7 +491,14 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
 }
 
 - (void)invalidateLayoutForStyleChange {
-  _shouldInvalidateLayout = YES;
+  self.shouldInvalidateLayout = YES;
+}
+
+- (void)setShouldInvalidateLayout:(BOOL)shouldInvalidateLayout {
+  _shouldInvalidateLayout = shouldInvalidateLayout;
+  if (shouldInvalidateLayout) {
+    _layoutInvalidationGeneration++;
+  }
 }
 
 - (BOOL)shouldInvalidateLayoutForStyleChange {
@@ -573,16 +604,21 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
     }
   }
 
-  NSPointerArray *cellBackgroundCache = _cellBackgroundCaches[backgroundColor];
-  if (!cellBackgroundCache) {
-    cellBackgroundCache = [self cellBackgroundCache];
-    _cellBackgroundCaches[backgroundColor] = cellBackgroundCache;
-  } else if ([cellBackgroundCache pointerAtIndex:backgroundCacheKey]) {
-    return (__bridge UIImage *)[cellBackgroundCache pointerAtIndex:backgroundCacheKey];
+  // Background images are shared by every styler in the process, so the key must include all of
+  // the inputs that can differ between stylers.
+  MDCCollectionViewCellBackgroundCache *cellBackgroundCache =
+      MDCCollectionViewCellBackgroundCache.sharedCache;
+  CGFloat scale = [[UIScreen mainScreen] scale];
+  UIImage *cachedImage = [cellBackgroundCache imageForBackgroundOptions:backgroundCacheKey
+                                                        backgroundColor:backgroundColor
+                                                           borderRadius:borderRadius
+                                                                  scale:scale];
+  if (cachedImage) {
+    return cachedImage;
   }
 
   CGRect imageRect = CGRectMake(0, 0, kCellImageSize.width, kCellImageSize.height);
-  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, 0);
+  UIGraphicsBeginImageContextWithOptions(imageRect.size, NO, scale);
 
   CGContextRef cx = UIGraphicsGetCurrentContext();
 
@@ -663,8 +699,11 @@ NS_INLINE CGRect RectShift(CGRect rect, CGFloat dx, CGFloat dy) {
   UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
   UIGraphicsEndImageContext();
   UIImage *resizableImage = [self resizableImage:image];
-  [cellBackgroundCache replacePointerAtIndex:backgroundCacheKey
-                                 withPointer:(__bridge void *)(resizableImage)];
+  [cellBackgroundCache setImage:resizableImage
+           forBackgroundOptions:backgroundCacheKey
+                backgroundColor:backgroundColor
+                   borderRadius:borderRadius
+                          scale:scale];
   return resizableImage;
 }
 
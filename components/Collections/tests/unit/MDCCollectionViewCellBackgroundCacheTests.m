@@ -0,0 +1,135 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCCollectionViewCellBackgroundCache.h"
+#import "MDCCollectionViewStyler.h"
+#import "MaterialCollectionLayoutAttributes.h"
+#import "MaterialCollections.h"
+
+static MDCCollectionViewLayoutAttributes *CellAttributes(void) {
+  MDCCollectionViewLayoutAttributes *attributes = [MDCCollectionViewLayoutAttributes
+      layoutAttributesForCellWithIndexPath:[NSIndexPath indexPathForItem:0 inSection:0]];
+  attributes.sectionOrdinalPosition =
+      MDCCollectionViewOrdinalPositionVerticalTop | MDCCollectionViewOrdinalPositionVerticalBottom;
+  return attributes;
+}
+
+@interface MDCCollectionViewCellBackgroundCacheTests : XCTestCase
+@end
+
+@implementation MDCCollectionViewCellBackgroundCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  [MDCCollectionViewCellBackgroundCache.sharedCache removeAllImages];
+  [MDCCollectionViewCellBackgroundCache.sharedCache resetStatistics];
+}
+
+- (void)tearDown {
+  [MDCCollectionViewCellBackgroundCache.sharedCache removeAllImages];
+  [MDCCollectionViewCellBackgroundCache.sharedCache resetStatistics];
+
+  [super tearDown];
+}
+
+- (MDCCollectionViewStyler *)cardStyler {
+  UICollectionView *collectionView =
+      [[UICollectionView alloc] initWithFrame:CGRectZero
+                         collectionViewLayout:[[UICollectionViewFlowLayout alloc] init]];
+  MDCCollectionViewStyler *styler =
+      [[MDCCollectionViewStyler alloc] initWithCollectionView:collectionView];
+  styler.cellStyle = MDCCollectionViewCellStyleCard;
+  return styler;
+}
+
+- (void)testStylersShareBackgroundImages {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  MDCCollectionViewStyler *otherStyler = [self cardStyler];
+
+  // When
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+  UIImage *otherImage = [otherStyler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotNil(image);
+  XCTAssertEqual(image, otherImage);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.missCount, 1U);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.hitCount, 1U);
+}
+
+- (void)testBorderRadiusIsPartOfKey {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  MDCCollectionViewStyler *otherStyler = [self cardStyler];
+  otherStyler.cardBorderRadius = styler.cardBorderRadius + 4;
+
+  // When
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+  UIImage *otherImage = [otherStyler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotEqual(image, otherImage);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.missCount, 2U);
+}
+
+- (void)testBackgroundColorIsPartOfKey {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  MDCCollectionViewStyler *otherStyler = [self cardStyler];
+  otherStyler.cellBackgroundColor = UIColor.redColor;
+
+  // When
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+  UIImage *otherImage = [otherStyler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotEqual(image, otherImage);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.missCount, 2U);
+}
+
+- (void)testCellStyleChangeDoesNotReturnStaleImage {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  UIImage *cardImage = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // When
+  styler.cellStyle = MDCCollectionViewCellStyleGrouped;
+  UIImage *groupedImage = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotEqual(cardImage, groupedImage);
+}
+
+- (void)testMemoryWarningEvictsImages {
+  // Given
+  MDCCollectionViewStyler *styler = [self cardStyler];
+  UIImage *image = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIApplicationDidReceiveMemoryWarningNotification
+                    object:nil];
+  UIImage *redrawnImage = [styler backgroundImageForCellLayoutAttributes:CellAttributes()];
+
+  // Then
+  XCTAssertNotEqual(image, redrawnImage);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.evictionCount, 1U);
+  XCTAssertEqual(MDCCollectionViewCellBackgroundCache.sharedCache.missCount, 2U);
+}
+
+@end
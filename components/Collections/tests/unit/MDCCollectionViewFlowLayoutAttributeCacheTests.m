@@ -0,0 +1,223 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialCollectionCells.h"
+#import "MaterialCollectionLayoutAttributes.h"
+#import "MaterialCollections.h"
+
+static NSString *const kReuseIdentifier = @"Cell";
+static const NSInteger kItemCount = 10000;
+static const CGFloat kViewportHeight = 640;
+static const CGFloat kScrollStep = 16;
+
+/** A collection view controller with a single section of kItemCount items. */
+@interface MDCCollectionViewFlowLayoutAttributeCacheTestsController : MDCCollectionViewController
+@end
+
+@implementation MDCCollectionViewFlowLayoutAttributeCacheTestsController
+
+- (void)viewDidLoad {
+  [super viewDidLoad];
+
+  [self.collectionView registerClass:[MDCCollectionViewTextCell class]
+          forCellWithReuseIdentifier:kReuseIdentifier];
+}
+
+- (NSInteger)collectionView:(__unused UICollectionView *)collectionView
+     numberOfItemsInSection:(__unused NSInteger)section {
+  return kItemCount;
+}
+
+- (UICollectionViewCell *)collectionView:(UICollectionView *)collectionView
+                  cellForItemAtIndexPath:(NSIndexPath *)indexPath {
+  return [collectionView dequeueReusableCellWithReuseIdentifier:kReuseIdentifier
+                                                   forIndexPath:indexPath];
+}
+
+@end
+
+@interface MDCCollectionViewFlowLayoutAttributeCacheTests : XCTestCase
+@property(nonatomic, strong) MDCCollectionViewFlowLayoutAttributeCacheTestsController *controller;
+@property(nonatomic, strong) UICollectionViewLayout *layout;
+@end
+
+@implementation MDCCollectionViewFlowLayoutAttributeCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.controller = [[MDCCollectionViewFlowLayoutAttributeCacheTestsController alloc] init];
+  self.controller.view.frame = CGRectMake(0, 0, 360, kViewportHeight);
+  self.controller.styler.cellStyle = MDCCollectionViewCellStyleCard;
+  [self.controller.view layoutIfNeeded];
+  self.layout = self.controller.collectionView.collectionViewLayout;
+}
+
+- (void)tearDown {
+  self.layout = nil;
+  self.controller = nil;
+
+  [super tearDown];
+}
+
+- (CGRect)viewportAtOffset:(CGFloat)offset {
+  return CGRectMake(0, offset, 360, kViewportHeight);
+}
+
+- (void)assertAttributes:(NSArray<UICollectionViewLayoutAttributes *> *)attributes
+    areIdenticalToAttributes:(NSArray<UICollectionViewLayoutAttributes *> *)otherAttributes {
+  XCTAssertGreaterThan(attributes.count, 0U);
+  XCTAssertEqual(attributes.count, otherAttributes.count);
+  for (NSUInteger i = 0; i < MIN(attributes.count, otherAttributes.count); ++i) {
+    XCTAssertEqual(attributes[i], otherAttributes[i]);
+  }
+}
+
+#pragma mark - Tests
+
+- (void)testRepeatedQueriesReturnCachedAttributes {
+  // When
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  [self assertAttributes:attributes areIdenticalToAttributes:otherAttributes];
+}
+
+- (void)testCachedAttributesAreDecorated {
+  // When
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  for (NSUInteger i = 0; i < attributes.count; ++i) {
+    MDCCollectionViewLayoutAttributes *attr = attributes[i];
+    MDCCollectionViewLayoutAttributes *otherAttr = otherAttributes[i];
+    XCTAssertNotNil(otherAttr.backgroundImage);
+    XCTAssertEqual(attr.sectionOrdinalPosition, otherAttr.sectionOrdinalPosition);
+  }
+  MDCCollectionViewLayoutAttributes *firstAttr = attributes.firstObject;
+  XCTAssertTrue(firstAttr.sectionOrdinalPosition & MDCCollectionViewOrdinalPositionVerticalTop);
+}
+
+- (void)testItemQueryReturnsCachedAttributes {
+  // Given
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+  UICollectionViewLayoutAttributes *attr = attributes.firstObject;
+
+  // When
+  UICollectionViewLayoutAttributes *itemAttr =
+      [self.layout layoutAttributesForItemAtIndexPath:attr.indexPath];
+
+  // Then
+  XCTAssertEqual(attr, itemAttr);
+}
+
+- (void)testInvalidateLayoutDiscardsCachedAttributes {
+  // Given
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // When
+  [self.layout invalidateLayout];
+  [self.controller.view layoutIfNeeded];
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  XCTAssertNotEqual(attributes.firstObject, otherAttributes.firstObject);
+  XCTAssertEqualObjects(attributes.firstObject, otherAttributes.firstObject);
+}
+
+- (void)testStyleChangeDiscardsCachedAttributes {
+  // Given
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // When
+  self.controller.styler.separatorColor = UIColor.redColor;
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  MDCCollectionViewLayoutAttributes *otherAttr = otherAttributes.firstObject;
+  XCTAssertNotEqual(attributes.firstObject, otherAttr);
+  XCTAssertEqualObjects(otherAttr.separatorColor, UIColor.redColor);
+  XCTAssertTrue(self.controller.styler.shouldInvalidateLayout);
+}
+
+- (void)testStyleChangeIsPickedUpOnceWithoutResettingTheStylerFlag {
+  // Given
+  self.controller.styler.separatorColor = UIColor.redColor;
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // When
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  XCTAssertTrue(self.controller.styler.shouldInvalidateLayout);
+  XCTAssertEqual(attributes.firstObject, otherAttributes.firstObject);
+}
+
+- (void)testEditingChangeDiscardsCachedAttributes {
+  // Given
+  NSArray *attributes = [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // When
+  self.controller.editor.editing = YES;
+  NSArray *otherAttributes =
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:0]];
+
+  // Then
+  MDCCollectionViewLayoutAttributes *otherAttr = otherAttributes.firstObject;
+  XCTAssertNotEqual(attributes.firstObject, otherAttr);
+  XCTAssertTrue(otherAttr.editing);
+}
+
+#pragma mark - Performance
+
+- (void)scrollThroughList {
+  CGFloat contentHeight = self.layout.collectionViewContentSize.height;
+  for (CGFloat offset = 0; offset + kViewportHeight < contentHeight; offset += kScrollStep) {
+    @autoreleasepool {
+      [self.layout layoutAttributesForElementsInRect:[self viewportAtOffset:offset]];
+    }
+  }
+}
+
+- (void)testScrollingPerformance {
+  // Populate the cache, so that the measured passes only scroll.
+  [self scrollThroughList];
+
+  [self measureBlock:^{
+    [self scrollThroughList];
+  }];
+}
+
+- (void)testScrollingMemoryPerFrame {
+  if (@available(iOS 13.0, *)) {
+    // Populate the cache, so that the measured passes only scroll.
+    [self scrollThroughList];
+
+    [self measureWithMetrics:@[ [[XCTMemoryMetric alloc] init] ]
+                       block:^{
+                         [self scrollThroughList];
+                       }];
+  }
+}
+
+@end
@@ -0,0 +1,183 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#include <tgmath.h>
+
+#import "MDCCollectionViewSectionOrdinals.h"
+#import "MaterialCollectionLayoutAttributes.h"
+
+/**
+ The section sizes the parity test covers: every size up to a few rows of the widest grid, sizes
+ around full rows, and one long section.
+ */
+static const NSInteger kNumbersOfItems[] = {0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 13, 199};
+
+/** The largest grid column count the parity test covers. */
+static const NSInteger kMaximumGridColumnCount = 5;
+
+/** The element kinds whose ordinal positions are compared. */
+typedef NS_ENUM(NSInteger, ElementKind) {
+  ElementKindItem,
+  ElementKindHeader,
+  ElementKindFooter,
+};
+
+/** The shape of a section. */
+typedef struct {
+  NSInteger numberOfItems;
+  NSInteger gridColumnCount;
+  BOOL hasHeader;
+  BOOL hasFooter;
+  BOOL hidesHeaderBackground;
+  BOOL hidesFooterBackground;
+} SectionShape;
+
+/** The per-attribute list logic that MDCCollectionViewFlowLayout used before section ordinals. */
+static MDCCollectionViewOrdinalPosition ReferenceListPosition(SectionShape shape,
+                                                              ElementKind kind,
+                                                              NSInteger item) {
+  MDCCollectionViewOrdinalPosition position = 0;
+  NSInteger numberOfItemsInSection = shape.numberOfItems;
+  BOOL isTop = NO;
+  BOOL isBottom = NO;
+  BOOL hasSectionHeader = shape.hasHeader;
+  BOOL hasSectionFooter = shape.hasFooter;
+  BOOL hasSectionItems = shape.numberOfItems > 0;
+  BOOL hidesHeaderBackground = shape.hidesHeaderBackground;
+  BOOL hidesFooterBackground = shape.hidesFooterBackground;
+
+  if (kind == ElementKindItem) {
+    isTop = (item == 0) && (!hasSectionHeader || hidesHeaderBackground);
+    isBottom = (item == numberOfItemsInSection - 1) &&
+               (!hasSectionFooter || hidesFooterBackground);
+  } else {
+    BOOL isElementHeader = kind == ElementKindHeader;
+    BOOL isElementFooter = kind == ElementKindFooter;
+    isTop = (isElementFooter && !hasSectionItems && !hasSectionHeader) || isElementHeader;
+    isBottom = (isElementHeader && !hasSectionItems && !hasSectionFooter) || isElementFooter;
+  }
+
+  if (!isTop && !isBottom) {
+    position |= MDCCollectionViewOrdinalPositionVerticalCenter;
+  } else {
+    position |= isTop ? MDCCollectionViewOrdinalPositionVerticalTop : position;
+    position |= isBottom ? MDCCollectionViewOrdinalPositionVerticalBottom : position;
+  }
+  return position;
+}
+
+/** The per-attribute grid logic that MDCCollectionViewFlowLayout used before section ordinals. */
+static MDCCollectionViewOrdinalPosition ReferenceGridPosition(SectionShape shape, NSInteger item) {
+  MDCCollectionViewOrdinalPosition position = 0;
+  NSInteger numberOfItemsInSection = shape.numberOfItems;
+  NSInteger gridColumnCount = shape.gridColumnCount;
+  NSInteger maxRowIndex = (NSInteger)(floor(numberOfItemsInSection / gridColumnCount) - 1);
+  NSInteger maxColumnIndex = gridColumnCount - 1;
+  NSInteger ordinalRow = (NSInteger)(floor(item / gridColumnCount));
+  NSInteger ordinalColumn = (NSInteger)(floor(item % gridColumnCount));
+
+  if (ordinalRow > 0 && ordinalRow < maxRowIndex) {
+    position = position | MDCCollectionViewOrdinalPositionVerticalCenter;
+  } else {
+    position =
+        (ordinalRow == 0) ? position | MDCCollectionViewOrdinalPositionVerticalTop : position;
+    position = (ordinalRow == maxRowIndex)
+                   ? position | MDCCollectionViewOrdinalPositionVerticalBottom
+                   : position;
+  }
+
+  if (ordinalColumn > 0 && ordinalColumn < maxColumnIndex) {
+    position = position | MDCCollectionViewOrdinalPositionHorizontalCenter;
+  } else {
+    position =
+        (ordinalColumn == 0) ? position | MDCCollectionViewOrdinalPositionHorizontalLeft : position;
+    position = (ordinalColumn == maxColumnIndex)
+                   ? position | MDCCollectionViewOrdinalPositionHorizontalRight
+                   : position;
+  }
+  return position;
+}
+
+@interface MDCCollectionViewSectionOrdinalsTests : XCTestCase
+@end
+
+@implementation MDCCollectionViewSectionOrdinalsTests
+
+- (void)assertParityWithPerAttributeLogicForShape:(SectionShape)shape {
+  // When
+  MDCCollectionViewSectionOrdinals ordinals = MDCCollectionViewSectionOrdinalsMake(
+      shape.numberOfItems, shape.gridColumnCount, shape.hasHeader, shape.hasFooter,
+      shape.hidesHeaderBackground, shape.hidesFooterBackground);
+
+  // Then
+  for (NSInteger item = 0; item < shape.numberOfItems; ++item) {
+    XCTAssertEqual(MDCCollectionViewSectionOrdinalsListItemPosition(&ordinals, item),
+                   ReferenceListPosition(shape, ElementKindItem, item), @"item %@ of %@",
+                   @(item), @(shape.numberOfItems));
+    XCTAssertEqual(MDCCollectionViewSectionOrdinalsGridPosition(&ordinals, item),
+                   ReferenceGridPosition(shape, item), @"item %@ of %@, %@ columns", @(item),
+                   @(shape.numberOfItems), @(shape.gridColumnCount));
+  }
+  XCTAssertEqual(MDCCollectionViewSectionOrdinalsHeaderPosition(&ordinals),
+                 ReferenceListPosition(shape, ElementKindHeader, 0));
+  XCTAssertEqual(MDCCollectionViewSectionOrdinalsFooterPosition(&ordinals),
+                 ReferenceListPosition(shape, ElementKindFooter, 0));
+}
+
+- (void)testParityWithPerAttributeLogicForAllSectionShapes {
+  size_t sizeCount = sizeof(kNumbersOfItems) / sizeof(kNumbersOfItems[0]);
+  for (size_t size = 0; size < sizeCount; ++size) {
+    for (NSInteger columns = 1; columns <= kMaximumGridColumnCount; ++columns) {
+      // Every combination of header, footer and hidden backgrounds.
+      for (NSUInteger flags = 0; flags < 16; ++flags) {
+        // Given
+        SectionShape shape;
+        shape.numberOfItems = kNumbersOfItems[size];
+        shape.gridColumnCount = columns;
+        shape.hasHeader = (flags & 1) != 0;
+        shape.hasFooter = (flags & 2) != 0;
+        shape.hidesHeaderBackground = (flags & 4) != 0;
+        shape.hidesFooterBackground = (flags & 8) != 0;
+
+        [self assertParityWithPerAttributeLogicForShape:shape];
+      }
+    }
+  }
+}
+
+- (void)testSingleItemWithoutHeaderOrFooterIsTopAndBottom {
+  // When
+  MDCCollectionViewSectionOrdinals ordinals =
+      MDCCollectionViewSectionOrdinalsMake(1, 1, NO, NO, NO, NO);
+
+  // Then
+  XCTAssertEqual(MDCCollectionViewSectionOrdinalsListItemPosition(&ordinals, 0),
+                 MDCCollectionViewOrdinalPositionVerticalTopBottom);
+}
+
+- (void)testInvalidGridColumnCountIsTreatedAsOneColumn {
+  // When
+  MDCCollectionViewSectionOrdinals ordinals =
+      MDCCollectionViewSectionOrdinalsMake(3, 0, NO, NO, NO, NO);
+
+  // Then
+  XCTAssertEqual(MDCCollectionViewSectionOrdinalsGridPosition(&ordinals, 1),
+                 MDCCollectionViewOrdinalPositionVerticalCenter |
+                     MDCCollectionViewOrdinalPositionHorizontalLeft |
+                     MDCCollectionViewOrdinalPositionHorizontalRight);
+}
+
+@end
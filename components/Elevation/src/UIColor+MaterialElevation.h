@@ -15,6 +15,14 @@
 #import <CoreGraphics/CoreGraphics.h>
 #import <UIKit/UIKit.h>
 
+/**
+ The granularity, in points, to which elevations are rounded before their overlay is computed.
+
+ The overlay's opacity changes fastest just below an elevation of 1, by about 0.1 per point, so a
+ 1/64 point step changes it by less than half of an 8-bit color channel step.
+ */
+FOUNDATION_EXTERN const CGFloat MDCElevationOverlayElevationQuantum;
+
 /**
  Provides extension to UIColor for Material Elevation usage.
  */
@@ -24,7 +32,10 @@
  Returns a color that takes the specified elevation value into account.
  The color is the blended color of Surface and Elevation Overlay in
  https://material.io/design/color/dark-theme.html#properties
- Negative elevation is treated as 0.
+ Negative elevation is treated as 0, and elevation is rounded to 1/64 of a point, finer than the
+ overlay can change an 8-bit color channel. Recently resolved colors are cached, so resolving equal
+ colors at the same elevation again is usually cheap. The cache is bounded, so the returned instance
+ may differ between calls.
  Pattern-based UIColor is not supported.
  @param elevation The @c mdc_absoluteElevation value to use when resolving the color.
  */
@@ -15,10 +15,55 @@
 #import "UIColor+MaterialElevation.h"
 
 #import <CoreGraphics/CoreGraphics.h>
+#import <os/lock.h>
 
 #import "MaterialAvailability.h"
-#import "MaterialMath.h"
-#import "UIColor+MaterialBlending.h"
+#import "private/MDCElevationOverlay.h"
+
+/** The number of entries of the resolved color cache. Must be a power of 2. */
+enum { kResolvedColorCacheSize = 512 };
+
+/** Elevations above this bypass the resolved color cache, so that their key can't overflow. */
+static const CGFloat kResolvedColorCacheMaxElevation = 1 << 20;
+
+/** The key of an entry of the resolved color cache. */
+typedef struct ResolvedColorKey {
+  CGFloat rgba[4];
+  int64_t quantizedElevation;
+} ResolvedColorKey;
+
+/**
+ A process-wide, direct-mapped cache of resolved colors keyed by the components of the surface color
+ and its quantized elevation. A lookup neither allocates nor retains more than the returned color,
+ and a colliding entry simply replaces the previous one.
+ */
+static ResolvedColorKey gResolvedColorKeys[kResolvedColorCacheSize];
+static UIColor *gResolvedColors[kResolvedColorCacheSize];
+static os_unfair_lock gResolvedColorLock = OS_UNFAIR_LOCK_INIT;
+
+static NSUInteger ResolvedColorSlot(const ResolvedColorKey *key) {
+  // FNV-1a over the key's bytes.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  const uint8_t *bytes = (const uint8_t *)key;
+  for (size_t i = 0; i < sizeof(*key); ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+  }
+  return (NSUInteger)(hash ^ (hash >> 32)) & (kResolvedColorCacheSize - 1);
+}
+
+static BOOL ResolvedColorKeyEqual(const ResolvedColorKey *key, const ResolvedColorKey *otherKey) {
+  return key->quantizedElevation == otherKey->quantizedElevation &&
+         key->rgba[0] == otherKey->rgba[0] && key->rgba[1] == otherKey->rgba[1] &&
+         key->rgba[2] == otherKey->rgba[2] && key->rgba[3] == otherKey->rgba[3];
+}
+
+static UIColor *ResolvedColor(const CGFloat rgba[4], CGFloat elevation) {
+  CGFloat blended[4];
+  MDCElevationOverlayBlend(rgba, MDCElevationOverlayAlpha(elevation), blended);
+  // TODO (https://github.com/material-components/material-components-ios/issues/8096):
+  // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
+  return [UIColor colorWithRed:blended[0] green:blended[1] blue:blended[2] alpha:blended[3]];
+}
 
 @implementation UIColor (MaterialElevation)
 
@@ -57,29 +102,34 @@
                 format:@"Pattern-based colors are not supported by %@", NSStringFromSelector(_cmd)];
   }
 
-  UIColor *overlayColor = UIColor.whiteColor;
-  elevation = MAX(elevation, 0);
-  CGFloat alphaValue = 0;
-  if (!MDCCGFloatEqual(elevation, 0)) {
-    if (elevation < 1) {
-      // A formula for values between 0 to 1 is used here to simulate the alpha percentage
-      // as in the main formula below there is a jump between any number larger than 0 to an
-      // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
-      // of the alpha value between lower numbers to be smaller than the higher numbers.
-      // AlphaValue = 5.11916 * elevationValue ^ 2
-      alphaValue = (CGFloat)5.11916 * pow((CGFloat)elevation, 2);
-    } else {
-      // A formula is used here to simulate the alpha percentage stated on
-      // https://material.io/design/color/dark-theme.html#properties
-      // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
-      // Note: Both formulas meet at the transition point of (1, 5.11916).
-      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
-    }
+  CGFloat rgba[4] = {0, 0, 0, 0};
+  [self getRed:&rgba[0] green:&rgba[1] blue:&rgba[2] alpha:&rgba[3]];
+  elevation = MDCElevationOverlayQuantizedElevation(MAX(elevation, 0));
+  if (!(elevation <= kResolvedColorCacheMaxElevation)) {
+    return ResolvedColor(rgba, elevation);
   }
-  // TODO (https://github.com/material-components/material-components-ios/issues/8096):
-  // Grayscale color should be returned if color space is UIExtendedGrayColorSpace.
-  return [UIColor mdc_blendColor:[overlayColor colorWithAlphaComponent:alphaValue * (CGFloat)0.01]
-             withBackgroundColor:self];
+
+  ResolvedColorKey key = {
+      .rgba = {rgba[0], rgba[1], rgba[2], rgba[3]},
+      .quantizedElevation = (int64_t)(elevation / MDCElevationOverlayElevationQuantum),
+  };
+  NSUInteger slot = ResolvedColorSlot(&key);
+  UIColor *color = nil;
+  os_unfair_lock_lock(&gResolvedColorLock);
+  if (ResolvedColorKeyEqual(&gResolvedColorKeys[slot], &key)) {
+    color = gResolvedColors[slot];
+  }
+  os_unfair_lock_unlock(&gResolvedColorLock);
+  if (color) {
+    return color;
+  }
+
+  color = ResolvedColor(rgba, elevation);
+  os_unfair_lock_lock(&gResolvedColorLock);
+  gResolvedColorKeys[slot] = key;
+  gResolvedColors[slot] = color;
+  os_unfair_lock_unlock(&gResolvedColorLock);
+  return color;
 }
 
 @end
@@ -31,6 +31,11 @@
 
  If a @c UIViewController conforms to @c MDCElevatable or @c MDCElevationOveriding then its @c view
  will report the view controllers base elevation.
+
+ The value is cached per view. The cache is invalidated when the view or one of its superviews moves
+ to a new superview, and top-down through the subviews whenever @c mdc_elevationDidChange is
+ called, so call it after changing the @c mdc_currentElevation or @c mdc_overrideBaseElevation of a
+ view.
  */
 @property(nonatomic, assign, readonly) CGFloat mdc_baseElevation;
 
@@ -43,8 +48,9 @@
 @property(nonatomic, assign, readonly) CGFloat mdc_absoluteElevation;
 
 /**
- Should be called when the view's @c mdc_currentElevation has changed. Will be called on the
- receiver's @c subviews.
+ Should be called when the view's @c mdc_currentElevation or @c mdc_overrideBaseElevation has
+ changed. Invalidates the cached @c mdc_baseElevation of the receiver and its subviews, and will be
+ called on the receiver's @c subviews.
 
  If a @c UIView views conform to @c MDCElevation then @c mdc_elevationDidChangeBlock: is called.
  */
@@ -14,17 +14,52 @@
 
 #import "UIView+MaterialElevationResponding.h"
 
+#import <objc/runtime.h>
+
 #import "MDCElevatable.h"
 #import "MDCElevationOverriding.h"
+#import "private/UIView+MaterialElevationResponding+Private.h"
+
+static char kBaseElevationKey;
+
+/** The number of base elevations resolved from the hierarchy rather than read from a cache. */
+static NSUInteger gBaseElevationComputationCount = 0;
+
+/**
+ A view's cached base elevation, along with the superview and the superview's cache entry it was
+ computed from.
+
+ A view's base elevation only depends on its superview's base elevation, so an entry stays valid for
+ as long as the view has the same superview and the superview's entry is still valid. Replacing or
+ removing an entry therefore invalidates the entries of the whole subtree below it.
+ */
+@interface MDCBaseElevationCacheEntry : NSObject {
+ @public
+  CGFloat _baseElevation;
+  BOOL _resolvedFromOverride;
+  __weak UIView *_superview;
+  MDCBaseElevationCacheEntry *_superviewEntry;
+}
+@end
+
+@implementation MDCBaseElevationCacheEntry
+@end
 
 @implementation UIView (MaterialElevationResponding)
 
 - (void)mdc_elevationDidChange {
+  // The receiver's own base elevation depends on its mdc_overrideBaseElevation.
+  objc_setAssociatedObject(self, &kBaseElevationKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
   CGFloat baseElevation = self.mdc_baseElevation;
   [self mdc_elevationDidChangeWithBaseElevation:baseElevation];
 }
 
 - (void)mdc_elevationDidChangeWithBaseElevation:(CGFloat)baseElevation {
+  // Invalidate the subtree top-down so that every subview picks up the new elevations.
+  for (UIView *subview in self.subviews) {
+    objc_setAssociatedObject(subview, &kBaseElevationKey, nil, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  }
+
   CGFloat elevation = baseElevation;
   id<MDCElevatable> elevatableSelf = [self objectConformingToElevationInResponderChain];
   if (elevatableSelf.mdc_elevationDidChangeBlock) {
@@ -38,24 +73,7 @@
 }
 
 - (CGFloat)mdc_baseElevation {
-  CGFloat totalElevation = 0;
-  UIView *current = self;
-
-  while (current != nil) {
-    id<MDCElevatable> elevatableCurrent = [current objectConformingToElevationInResponderChain];
-    if (current != self) {
-      totalElevation += elevatableCurrent.mdc_currentElevation;
-    }
-    id<MDCElevationOverriding> elevatableCurrentOverride =
-        [current objectConformingToOverrideInResponderChain];
-    if (elevatableCurrentOverride != nil &&
-        elevatableCurrentOverride.mdc_overrideBaseElevation >= 0) {
-      totalElevation += elevatableCurrentOverride.mdc_overrideBaseElevation;
-      break;
-    }
-    current = current.superview;
-  }
-  return totalElevation;
+  return [self mdc_baseElevationCacheEntry]->_baseElevation;
 }
 
 - (CGFloat)mdc_absoluteElevation {
@@ -65,6 +83,60 @@
   return elevation;
 }
 
+/**
+ Returns the receiver's cached base elevation, resolving it from the receiver and its superview's
+ cache entry if the cached one is missing or stale.
+ */
+- (MDCBaseElevationCacheEntry *)mdc_baseElevationCacheEntry {
+  MDCBaseElevationCacheEntry *entry = objc_getAssociatedObject(self, &kBaseElevationKey);
+  if (entry != nil && [self mdc_isBaseElevationCacheEntryValid:entry]) {
+    return entry;
+  }
+
+  ++gBaseElevationComputationCount;
+  entry = [[MDCBaseElevationCacheEntry alloc] init];
+  id<MDCElevationOverriding> overridingSelf = [self objectConformingToOverrideInResponderChain];
+  if (overridingSelf != nil && overridingSelf.mdc_overrideBaseElevation >= 0) {
+    entry->_baseElevation = overridingSelf.mdc_overrideBaseElevation;
+    entry->_resolvedFromOverride = YES;
+  } else {
+    UIView *superview = self.superview;
+    if (superview != nil) {
+      MDCBaseElevationCacheEntry *superviewEntry = [superview mdc_baseElevationCacheEntry];
+      id<MDCElevatable> elevatableSuperview =
+          [superview objectConformingToElevationInResponderChain];
+      entry->_baseElevation =
+          superviewEntry->_baseElevation + elevatableSuperview.mdc_currentElevation;
+      entry->_superview = superview;
+      entry->_superviewEntry = superviewEntry;
+    }
+  }
+  objc_setAssociatedObject(self, &kBaseElevationKey, entry, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+  return entry;
+}
+
+/**
+ Checks whether @c entry was computed for the receiver's current superview chain.
+
+ Each entry must still belong to the same superview, and the superview must still hold the entry it
+ was computed from. This only follows @c superview pointers, which is much cheaper than resolving
+ each ancestor's elevation, and it catches any ancestor having moved to a new superview or having
+ had its cache invalidated by @c mdc_elevationDidChange.
+ */
+- (BOOL)mdc_isBaseElevationCacheEntryValid:(MDCBaseElevationCacheEntry *)entry {
+  UIView *current = self;
+  while (entry->_superviewEntry != nil) {
+    UIView *superview = current.superview;
+    if (superview == nil || superview != entry->_superview ||
+        objc_getAssociatedObject(superview, &kBaseElevationKey) != entry->_superviewEntry) {
+      return NO;
+    }
+    current = superview;
+    entry = entry->_superviewEntry;
+  }
+  return entry->_resolvedFromOverride || current.superview == nil;
+}
+
 /**
  Checks whether a @c UIView or it's managing @c UIViewController conform to @c
  MDCOverrideElevation.
@@ -106,3 +178,11 @@
 }
 
 @end
+
+@implementation UIView (MaterialElevationRespondingPrivate)
+
++ (NSUInteger)mdc_baseElevationComputationCount {
+  return gBaseElevationComputationCount;
+}
+
+@end
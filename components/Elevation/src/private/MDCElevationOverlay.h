@@ -0,0 +1,41 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+#import "../UIColor+MaterialElevation.h"
+
+/** Returns @c elevation rounded to a multiple of MDCElevationOverlayElevationQuantum. */
+FOUNDATION_EXTERN CGFloat MDCElevationOverlayQuantizedElevation(CGFloat elevation);
+
+/**
+ Returns the opacity, in [0, 1], of the white overlay of a dark theme surface at @c elevation, as
+ described in https://material.io/design/color/dark-theme.html#properties
+
+ Negative elevation is treated as 0.
+ */
+FOUNDATION_EXTERN CGFloat MDCElevationOverlayAlpha(CGFloat elevation);
+
+/**
+ Composites a white overlay with opacity @c overlayAlpha over a color.
+
+ @param rgba The red, green, blue and alpha components of the surface color.
+ @param overlayAlpha The opacity of the overlay, in [0, 1].
+ @param result Receives the red, green, blue and alpha components of the blended color. May be the
+               same array as @c rgba.
+ */
+FOUNDATION_EXTERN void MDCElevationOverlayBlend(const CGFloat rgba[_Nonnull 4],
+                                                CGFloat overlayAlpha,
+                                                CGFloat result[_Nonnull 4]);
@@ -0,0 +1,52 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCElevationOverlay.h"
+
+#include <math.h>
+
+#import "MDCColorBlending.h"
+
+const CGFloat MDCElevationOverlayElevationQuantum = (CGFloat)1 / 64;
+
+CGFloat MDCElevationOverlayQuantizedElevation(CGFloat elevation) {
+  return round(elevation / MDCElevationOverlayElevationQuantum) *
+         MDCElevationOverlayElevationQuantum;
+}
+
+CGFloat MDCElevationOverlayAlpha(CGFloat elevation) {
+  CGFloat alphaValue = 0;
+  if (elevation > 0) {
+    if (elevation < 1) {
+      // A formula for values between 0 to 1 is used here to simulate the alpha percentage
+      // as in the main formula below there is a jump between any number larger than 0 to an
+      // alpha value of 2. This formula provides a gradual polynomial curve that makes the delta
+      // of the alpha value between lower numbers to be smaller than the higher numbers.
+      // AlphaValue = 5.11916 * elevationValue ^ 2
+      alphaValue = (CGFloat)5.11916 * pow((CGFloat)elevation, 2);
+    } else {
+      // A formula is used here to simulate the alpha percentage stated on
+      // https://material.io/design/color/dark-theme.html#properties
+      // AlphaValue = 4.5 * ln (elevationValue + 1) + 2
+      // Note: Both formulas meet at the transition point of (1, 5.11916).
+      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
+    }
+  }
+  return MIN(alphaValue * (CGFloat)0.01, 1);
+}
+
+void MDCElevationOverlayBlend(const CGFloat rgba[4], CGFloat overlayAlpha, CGFloat result[4]) {
+  const CGFloat overlay[4] = {1, 1, 1, overlayAlpha};
+  MDCColorBlend(overlay, rgba, result);
+}
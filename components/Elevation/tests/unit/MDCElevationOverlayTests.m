@@ -0,0 +1,93 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCElevationOverlay.h"
+
+/** The largest change of the overlay's opacity that can't change an 8-bit color channel. */
+static const CGFloat kHalfChannelStep = (CGFloat)0.5 / 255;
+
+@interface MDCElevationOverlayTests : XCTestCase
+@end
+
+@implementation MDCElevationOverlayTests
+
+- (void)testAlphaIsZeroForNonPositiveElevation {
+  XCTAssertEqual(MDCElevationOverlayAlpha(0), 0);
+  XCTAssertEqual(MDCElevationOverlayAlpha(-10), 0);
+}
+
+- (void)testAlphaIsContinuousAtElevationOne {
+  // Given
+  CGFloat below = MDCElevationOverlayAlpha(nextafter((CGFloat)1, 0));
+  CGFloat at = MDCElevationOverlayAlpha(1);
+  CGFloat above = MDCElevationOverlayAlpha(nextafter((CGFloat)1, 2));
+
+  // Then
+  XCTAssertEqualWithAccuracy(below, at, (CGFloat)1e-6);
+  XCTAssertEqualWithAccuracy(above, at, (CGFloat)1e-6);
+  XCTAssertEqualWithAccuracy(at, (CGFloat)0.0511916, (CGFloat)1e-6);
+}
+
+- (void)testAlphaIsContinuousAroundElevationOneAtQuantumSteps {
+  CGFloat quantum = MDCElevationOverlayElevationQuantum;
+  for (CGFloat elevation = (CGFloat)0.5; elevation < (CGFloat)1.5; elevation += quantum) {
+    CGFloat delta =
+        MDCElevationOverlayAlpha(elevation + quantum) - MDCElevationOverlayAlpha(elevation);
+    XCTAssertGreaterThanOrEqual(delta, 0, @"elevation %f", elevation);
+    XCTAssertLessThan(delta, kHalfChannelStep, @"elevation %f", elevation);
+  }
+}
+
+- (void)testQuantizedElevationIsWithinHalfAQuantum {
+  for (CGFloat elevation = 0; elevation < 4; elevation += (CGFloat)0.001) {
+    CGFloat quantized = MDCElevationOverlayQuantizedElevation(elevation);
+    XCTAssertLessThanOrEqual(fabs(quantized - elevation), MDCElevationOverlayElevationQuantum / 2);
+    XCTAssertEqual(MDCElevationOverlayQuantizedElevation(quantized), quantized);
+  }
+}
+
+- (void)testBlendMatchesAlphaCompositing {
+  // Given
+  CGFloat rgba[4] = {(CGFloat)0.9, (CGFloat)0.8, (CGFloat)0.6, (CGFloat)0.6};
+  CGFloat overlayAlpha = (CGFloat)0.2;
+  CGFloat result[4];
+
+  // When
+  MDCElevationOverlayBlend(rgba, overlayAlpha, result);
+
+  // Then
+  CGFloat alpha = overlayAlpha + rgba[3] * (1 - overlayAlpha);
+  for (int i = 0; i < 3; ++i) {
+    CGFloat expected = ((1 - overlayAlpha) * rgba[i] * rgba[3] + overlayAlpha * 1) / alpha;
+    XCTAssertEqual(result[i], expected);
+  }
+  XCTAssertEqual(result[3], alpha);
+}
+
+- (void)testBlendWithOpaqueOverlayIsWhite {
+  // Given
+  CGFloat rgba[4] = {(CGFloat)0.1, (CGFloat)0.2, (CGFloat)0.3, 1};
+
+  // When
+  MDCElevationOverlayBlend(rgba, 1, rgba);
+
+  // Then
+  for (int i = 0; i < 4; ++i) {
+    XCTAssertEqual(rgba[i], 1);
+  }
+}
+
+@end
@@ -16,6 +16,8 @@
 
 #import <XCTest/XCTest.h>
 
+#import "../../src/private/UIView+MaterialElevationResponding+Private.h"
+
 /**
  Used for testing @c UIViews that conform to @c MDCElevatable and do not conform to @c
  MDCElevatableOverride.
@@ -592,4 +594,213 @@
   XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, self.view.mdc_absoluteElevation, 0.001);
 }
 
+#pragma mark - Base elevation in changing hierarchies
+
+// + self.elevationView
+//   - self.view
+- (void)testBaseElevationUpdatesAfterElevationDidChange {
+  // Given
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  self.elevationView.elevation = 5;
+  [self.elevationView mdc_elevationDidChange];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 5, 0.001);
+}
+
+// + self.elevationView
+//   - self.view
+// + otherElevationView
+- (void)testBaseElevationUpdatesWhenMovedToNewSuperview {
+  // Given
+  MDCConformingMDCElevatableView *otherElevationView =
+      [[MDCConformingMDCElevatableView alloc] init];
+  otherElevationView.elevation = 7;
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  [otherElevationView addSubview:self.view];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 7, 0.001);
+}
+
+// + self.elevationView
+//   + middleView
+//     - self.view
+// + self.elevationOverrideView
+- (void)testBaseElevationUpdatesWhenAncestorMovesToNewSuperview {
+  // Given
+  UIView *middleView = [[UIView alloc] init];
+  self.elevationView.elevation = 3;
+  self.elevationOverrideView.elevation = 2;
+  self.elevationOverrideView.mdc_overrideBaseElevation = 10;
+  [self.elevationView addSubview:middleView];
+  [middleView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  [self.elevationOverrideView addSubview:middleView];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 12, 0.001);
+}
+
+// + self.elevationView
+//   - self.view
+- (void)testBaseElevationUpdatesWhenRemovedFromSuperview {
+  // Given
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  [self.view removeFromSuperview];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 0, 0.001);
+}
+
+// + self.elevationOverrideView
+//   - self.view
+- (void)testBaseElevationUpdatesAfterAncestorOverrideChanges {
+  // Given
+  self.elevationOverrideView.mdc_overrideBaseElevation = 4;
+  [self.elevationOverrideView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 4, 0.001);
+
+  // When
+  self.elevationOverrideView.mdc_overrideBaseElevation = 9;
+  [self.elevationOverrideView mdc_elevationDidChange];
+
+  // Then
+  XCTAssertEqualWithAccuracy(self.elevationOverrideView.mdc_baseElevation, 9, 0.001);
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 9, 0.001);
+}
+
+// + self.elevationView
+//   + middleView
+//     - self.view
+- (void)testElevationDidChangeInvalidatesTheWholeSubtree {
+  // Given
+  UIView *middleView = [[UIView alloc] init];
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:middleView];
+  [middleView addSubview:self.view];
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 3, 0.001);
+
+  // When
+  self.elevationView.elevation = 5;
+  [self.elevationView mdc_elevationDidChange];
+
+  // Then
+  XCTAssertEqualWithAccuracy(middleView.mdc_baseElevation, 5, 0.001);
+  XCTAssertEqualWithAccuracy(self.view.mdc_baseElevation, 5, 0.001);
+}
+
+// + self.elevationView
+//   + middleView
+//     - self.view
+- (void)testRepeatedBaseElevationReadsDoNotResolveTheHierarchy {
+  // Given
+  UIView *middleView = [[UIView alloc] init];
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:middleView];
+  [middleView addSubview:self.view];
+  (void)self.view.mdc_baseElevation;
+  NSUInteger computationCount = UIView.mdc_baseElevationComputationCount;
+
+  // When
+  for (NSUInteger i = 0; i < 10; ++i) {
+    (void)self.view.mdc_baseElevation;
+    (void)self.view.mdc_absoluteElevation;
+    (void)middleView.mdc_baseElevation;
+  }
+
+  // Then
+  XCTAssertEqual(UIView.mdc_baseElevationComputationCount, computationCount);
+}
+
+// + self.elevationView
+//   + middleView
+//     - self.view
+//     - otherView
+- (void)testSiblingsShareTheCachedBaseElevationOfTheirSuperview {
+  // Given
+  UIView *middleView = [[UIView alloc] init];
+  UIView *otherView = [[UIView alloc] init];
+  self.elevationView.elevation = 3;
+  [self.elevationView addSubview:middleView];
+  [middleView addSubview:self.view];
+  [middleView addSubview:otherView];
+  (void)self.view.mdc_baseElevation;
+  NSUInteger computationCount = UIView.mdc_baseElevationComputationCount;
+
+  // When
+  CGFloat baseElevation = otherView.mdc_baseElevation;
+
+  // Then
+  XCTAssertEqualWithAccuracy(baseElevation, 3, 0.001);
+  XCTAssertEqual(UIView.mdc_baseElevationComputationCount, computationCount + 1);
+}
+
+- (void)testPerformanceOfBaseElevationInDeepHierarchy {
+  // Given
+  NSMutableArray<MDCConformingMDCElevatableView *> *ancestors = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 4; ++i) {
+    MDCConformingMDCElevatableView *ancestor = [[MDCConformingMDCElevatableView alloc] init];
+    ancestor.elevation = 1;
+    [ancestors addObject:ancestor];
+  }
+  NSArray<UIView *> *leaves = [self leavesOfHierarchyWithElevatedAncestors:ancestors
+                                                                     depth:16
+                                                                 leafCount:200];
+  NSUInteger computationCount = UIView.mdc_baseElevationComputationCount;
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger pass = 0; pass < 20; ++pass) {
+      for (UIView *leaf in leaves) {
+        (void)leaf.mdc_absoluteElevation;
+      }
+    }
+  }];
+
+  // Each of the 4 ancestors and 200 * 16 plain views resolves its base elevation once, after which
+  // every read is served from the cache.
+  XCTAssertEqual(UIView.mdc_baseElevationComputationCount - computationCount, 4U + 200U * 16U);
+}
+
+#pragma mark - Helpers
+
+/**
+ Builds @c leafCount chains of @c depth plain views under a stack of @c elevatedAncestors, mirroring
+ a collection view of cells that contain cards that contain chips.
+ */
+- (NSArray<UIView *> *)leavesOfHierarchyWithElevatedAncestors:
+                           (NSArray<MDCConformingMDCElevatableView *> *)elevatedAncestors
+                                                         depth:(NSUInteger)depth
+                                                     leafCount:(NSUInteger)leafCount {
+  for (NSUInteger i = 1; i < elevatedAncestors.count; ++i) {
+    [elevatedAncestors[i - 1] addSubview:elevatedAncestors[i]];
+  }
+  NSMutableArray<UIView *> *leaves = [NSMutableArray arrayWithCapacity:leafCount];
+  for (NSUInteger i = 0; i < leafCount; ++i) {
+    UIView *parent = elevatedAncestors.lastObject;
+    for (NSUInteger level = 0; level < depth; ++level) {
+      UIView *child = [[UIView alloc] init];
+      [parent addSubview:child];
+      parent = child;
+    }
+    [leaves addObject:parent];
+  }
+  return leaves;
+}
+
 @end
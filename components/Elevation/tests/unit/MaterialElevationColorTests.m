@@ -16,6 +16,7 @@
 
 #import "MaterialAvailability.h"
 #import "MaterialElevation.h"
+#import "UIColor+MaterialBlending.h"
 #import "UIColor+MaterialDynamic.h"
 
 /** Returns a generated image of the given color and bounds. */
@@ -252,6 +253,76 @@ static UIImage *fakeImageWithColorAndSize(UIColor *color, CGRect bounds) {
       @"Expected exception when resolving a Pattern-Based color with elevation");
 }
 
+- (void)testResolvedColorIsCachedForEqualColors {
+  // Given
+  CGFloat elevation = (CGFloat)8;
+  UIColor *equalColor = [UIColor colorWithRed:(CGFloat)0.9
+                                        green:(CGFloat)0.8
+                                         blue:(CGFloat)0.6
+                                        alpha:(CGFloat)0.6];
+
+  // When
+  UIColor *resolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:elevation];
+  UIColor *otherResolvedColor = [equalColor mdc_resolvedColorWithElevation:elevation];
+
+  // Then
+  XCTAssertEqual(resolvedColor, otherResolvedColor);
+}
+
+- (void)testResolvedColorWithinElevationQuantumIsShared {
+  // When
+  UIColor *resolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)4];
+  UIColor *otherResolvedColor =
+      [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)4 + (CGFloat)1 / 256];
+
+  // Then
+  XCTAssertEqual(resolvedColor, otherResolvedColor);
+}
+
+- (void)testResolvedColorDiffersAcrossElevations {
+  // When
+  UIColor *resolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)4];
+  UIColor *otherResolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:(CGFloat)5];
+
+  // Then
+  XCTAssertNotEqualObjects(resolvedColor, otherResolvedColor);
+}
+
+- (void)testResolvedColorMatchesBlendedOverlay {
+  for (CGFloat elevation = 0; elevation < 30; elevation += (CGFloat)0.25) {
+    // When
+    UIColor *resolvedColor = [self.rgbColor mdc_resolvedColorWithElevation:elevation];
+
+    // Then
+    CGFloat alphaValue = 0;
+    if (elevation > 0 && elevation < 1) {
+      alphaValue = (CGFloat)5.11916 * pow(elevation, 2);
+    } else if (elevation >= 1) {
+      alphaValue = (CGFloat)4.5 * (CGFloat)log(elevation + 1) + 2;
+    }
+    UIColor *overlayColor = [UIColor.whiteColor colorWithAlphaComponent:alphaValue * (CGFloat)0.01];
+    UIColor *expectedColor = [UIColor mdc_blendColor:overlayColor
+                                 withBackgroundColor:self.rgbColor];
+    [self assertEqualColorsWithFloatPrecisionFirstColor:resolvedColor secondColor:expectedColor];
+  }
+}
+
+- (void)testResolvedColorPerformance {
+  NSArray<UIColor *> *surfaceColors = @[
+    self.rgbColor, self.greyScaleColor, UIColor.blackColor,
+    [UIColor colorWithRed:(CGFloat)0.07 green:(CGFloat)0.07 blue:(CGFloat)0.07 alpha:1]
+  ];
+
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 10000; ++i) {
+      @autoreleasepool {
+        UIColor *surfaceColor = surfaceColors[i % surfaceColors.count];
+        [surfaceColor mdc_resolvedColorWithElevation:(CGFloat)(i % 24)];
+      }
+    }
+  }];
+}
+
 - (void)assertEqualColorsWithFloatPrecisionFirstColor:(UIColor *)firstColor
                                           secondColor:(UIColor *)secondColor {
   CGFloat fRed = 0.0, fGreen = 0.0, fBlue = 0.0, fAlpha = 0.0;
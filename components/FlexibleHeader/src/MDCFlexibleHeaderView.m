@@ -15,6 +15,7 @@
 #import "MDCFlexibleHeaderView.h"
 
 #import "private/MDCFlexibleHeaderMinMaxHeight.h"
+#import "private/MDCFlexibleHeaderShiftCore.h"
 #import "private/MDCFlexibleHeaderShifter.h"
 #import "private/MDCFlexibleHeaderTopSafeArea.h"
 #import "private/MDCFlexibleHeaderView+Private.h"
@@ -25,6 +26,7 @@
 #import "MaterialFlexibleHeader+ShiftBehaviorEnabledWithStatusBar.h"
 #import "MaterialShadowElevations.h"
 #import "MaterialApplication.h"
+#import "MaterialDisplayLink.h"
 #import "MaterialMath.h"
 #import "MaterialUIMetrics.h"
 
@@ -61,11 +63,9 @@ static const CGFloat kHeightEpsilon = (CGFloat)0.001;
 // The epsilon used when comparing content offset values.
 static const CGFloat kContentOffsetEpsilon = (CGFloat)0.001;
 
-// The minimum delta y before we change the scroll direction.
-static const CGFloat kDeltaYSlop = 5;
-
 // Affects how fast the header shifts on/off-screen while animating. Bigger value = faster.
-static const CGFloat kAttachmentCoefficient = 12;
+// Each 60 Hz frame closes 20% of the distance to the destination.
+static const CGFloat kAttachmentCoefficient = (CGFloat)13.39;
 
 // The amount the user needs to scroll back before the header starts shifting back on-screen.
 static const CGFloat kMaxAnchorLengthFullSwipe = 175;
@@ -80,7 +80,8 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 
 @interface MDCFlexibleHeaderView () <MDCStatusBarShifterDelegate,
                                      MDCFlexibleHeaderTopSafeAreaDelegate,
-                                     MDCFlexibleHeaderMinMaxHeightDelegate>
+                                     MDCFlexibleHeaderMinMaxHeightDelegate,
+                                     MDCDisplayLinkSubscriber>
 
 // The intensity strength of the shadow being displayed under the flexible header. Use this property
 // to check what the intensity of a custom shadow should be depending on a scroll position. Valid
@@ -164,7 +165,6 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   CGFloat _shiftAccumulator;
   CGPoint _shiftAccumulatorLastContentOffset;  // Stores our last delta'd content offset.
   CGFloat _shiftAccumulatorDeltaY;
-  CADisplayLink *_shiftAccumulatorDisplayLink;
 
   BOOL _interfaceOrientationIsChanging;
   BOOL _contentInsetsAreChanging;
@@ -271,6 +271,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   _wkWebViewClass = NSClassFromString(@"WKWebView");
 
   _shifter = [[MDCFlexibleHeaderShifter alloc] init];
+  _displayLinkScheduler = [MDCDisplayLinkScheduler sharedScheduler];
   _statusBarShifter = [[MDCStatusBarShifter alloc] init];
   _statusBarShifter.delegate = self;
   _statusBarShifter.enabled = [self fhv_shouldAllowShifting];
@@ -522,7 +523,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
 
   if (_shifter.behavior == MDCFlexibleHeaderShiftBehaviorHideable && _wantsToBeHidden &&
-      !_shiftAccumulatorDisplayLink) {
+      ![self fhv_isDisplayLinkRunning]) {
     // Using the new safe area information, immediately shift the header such that it is off-screen.
     _shiftAccumulator = self.fhv_accumulatorMax;
     [self fhv_commitAccumulatorToFrame];
@@ -887,23 +888,33 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 }
 #endif
 
-- (void)fhv_startDisplayLink {
+- (void)setDisplayLinkScheduler:(MDCDisplayLinkScheduler *)displayLinkScheduler {
+  if (_displayLinkScheduler == displayLinkScheduler) {
+    return;
+  }
+  BOOL displayLinkWasRunning = [self fhv_isDisplayLinkRunning];
   [self fhv_stopDisplayLink];
+  _displayLinkScheduler = displayLinkScheduler;
+  if (displayLinkWasRunning) {
+    [self fhv_startDisplayLink];
+  }
+}
 
-  // Because CADisplayLink retains its target, this may cause a retain cycle.
-  // See cl/129917749
-  _shiftAccumulatorDisplayLink =
-      [CADisplayLink displayLinkWithTarget:self
-                                  selector:@selector(fhv_shiftAccumulatorDisplayLinkDidFire:)];
-  [_shiftAccumulatorDisplayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+- (BOOL)fhv_isDisplayLinkRunning {
+  return [_displayLinkScheduler hasSubscriber:self];
+}
+
+- (void)fhv_startDisplayLink {
+  // The scheduler holds its subscribers weakly, so subscribing doesn't retain the header.
+  [_displayLinkScheduler addSubscriber:self];
 }
 
 - (void)fhv_stopDisplayLink {
-  [_shiftAccumulatorDisplayLink invalidate];
-  _shiftAccumulatorDisplayLink = nil;
+  [_displayLinkScheduler removeSubscriber:self];
 }
 
-- (void)fhv_shiftAccumulatorDisplayLinkDidFire:(CADisplayLink *)displayLink {
+- (void)displayLinkScheduler:(__unused MDCDisplayLinkScheduler *)scheduler
+        didAdvanceByDuration:(NSTimeInterval)duration {
   // Erase any scrollback that was injected into the accumulator by capping it back down.
   _shiftAccumulator = MIN([self fhv_accumulatorMax], _shiftAccumulator);
 
@@ -923,16 +934,14 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
     destination = _wantsToBeHidden ? [self fhv_accumulatorMax] : 0;
   }
 
-  CGFloat distanceToDestination = destination - _shiftAccumulator;
-
-  NSTimeInterval duration = displayLink.duration;
-
 #if TARGET_IPHONE_SIMULATOR
   duration /= [self fhv_dragCoefficient];
 #endif
 
-  // This is a simple "force" that's stronger the further we are from the destination.
-  _shiftAccumulator += (CGFloat)(kAttachmentCoefficient * distanceToDestination * duration);
+  // This is a simple "force" that's stronger the further we are from the destination. Solving it
+  // exactly for the frame's duration makes the motion independent of the frame rate.
+  _shiftAccumulator = MDCAttachedValueAfterDuration(_shiftAccumulator, destination,
+                                                    kAttachmentCoefficient, duration);
 
   if (self.canAlwaysExpandToMaximumHeight) {
     _shiftAccumulator =
@@ -1037,26 +1046,33 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 #pragma mark Layout
 
 - (CGFloat)fhv_accumulatorMin {
-  CGFloat headerHeight = -[self fhv_contentOffsetWithoutInjectedTopInset];
-
-  CGFloat lowerBound;
-
-  if (self.canAlwaysExpandToMaximumHeight) {
-    CGFloat maxExpansion;
-    if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-      // The header is detached from the content and able to fully expand.
-      maxExpansion = self.maximumHeight - self.minimumHeight;
-    } else {
-      // We're now attached to the content and need to constrain our possible expansion.
-      maxExpansion = self.minMaxHeight.maximumHeightWithTopSafeArea - headerHeight;
-    }
-    // Expansion is tracked via negative accumulation.
-    lowerBound = MIN(0, -maxExpansion);
-  } else {
-    lowerBound = 0;
+  if (!self.canAlwaysExpandToMaximumHeight) {
+    return 0;
   }
-
-  return lowerBound;
+  // The lower bound only depends on the header's heights, so skip the rest of the geometry.
+  MDCFlexibleHeaderShiftGeometry geometry = {0};
+  geometry.minimumHeight = self.minMaxHeight.minimumHeightWithTopSafeArea;
+  geometry.maximumHeight = self.minMaxHeight.maximumHeightWithTopSafeArea;
+  geometry.maximumExpansion = self.maximumHeight - self.minimumHeight;
+  geometry.canAlwaysExpandToMaximumHeight = YES;
+  return MDCFlexibleHeaderShiftLowerBound(&geometry,
+                                          -[self fhv_contentOffsetWithoutInjectedTopInset]);
+}
+
+// Captures the configuration that bounds the shift accumulator.
+- (MDCFlexibleHeaderShiftGeometry)fhv_shiftGeometry {
+  MDCFlexibleHeaderShiftGeometry geometry;
+  geometry.minimumHeight = self.minMaxHeight.minimumHeightWithTopSafeArea;
+  geometry.maximumHeight = self.minMaxHeight.maximumHeightWithTopSafeArea;
+  geometry.maximumHeightWithoutTopSafeArea = self.minMaxHeight.maximumHeightWithoutTopSafeArea;
+  geometry.maximumExpansion = self.maximumHeight - self.minimumHeight;
+  geometry.accumulatorMax = [self fhv_accumulatorMax];
+  geometry.anchorLength = [self fhv_anchorLength];
+  geometry.minimumHeaderViewHeight = self.minimumHeaderViewHeight;
+  geometry.canAlwaysExpandToMaximumHeight = self.canAlwaysExpandToMaximumHeight;
+  geometry.canShiftOffscreen = [self fhv_canShiftOffscreen];
+  geometry.canOverExtend = _canOverExtend && !UIAccessibilityIsVoiceOverRunning();
+  return geometry;
 }
 
 - (void)fhv_updateLayout {
@@ -1089,128 +1105,41 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   // invocations to -shiftHeaderOnScreenAnimated: and shiftHeaderOffScreenAnimated:
   BOOL allowsInteractiveShift = _shifter.behavior != MDCFlexibleHeaderShiftBehaviorHideable;
 
+  MDCFlexibleHeaderShiftGeometry geometry = [self fhv_shiftGeometry];
+
   if (_shiftAccumulatorLastContentOffsetIsValid && allowsInteractiveShift) {
+    MDCFlexibleHeaderScrollSample sample;
+    sample.headerHeight = headerHeight;
     // We track the last direction for our target offset behavior.
-    CGFloat deltaY = [self fhv_boundedContentOffset].y - _shiftAccumulatorLastContentOffset.y;
-
-    if (_shiftAccumulatorDeltaY * deltaY < 0) {
-      // Direction has changed.
-      _shiftAccumulatorDeltaY = 0;
-    }
-    _shiftAccumulatorDeltaY += deltaY;
-
-    // Keeps track of the last direction the user moved their finger in.
-    if (_trackingScrollView.isTracking) {
-      if (_shiftAccumulatorDeltaY > kDeltaYSlop) {
-        _wantsToBeHidden = YES;
-      } else if (_shiftAccumulatorDeltaY < -kDeltaYSlop) {
-        _wantsToBeHidden = NO;
-      }
-    }
-
-    if (![self fhv_isOverExtendingBottom] && !_shiftAccumulatorDisplayLink) {
-      if (!self.canAlwaysExpandToMaximumHeight) {
-        // When we're not allowed to shift offscreen, only allow the header to shift further
-        // on-screen in case it was previously off-screen due to a behavior change.
-        if (![self fhv_canShiftOffscreen]) {
-          deltaY = MIN(0, deltaY);
-        }
-      }
-
-      // When scrubbing we only allow the header to shrink and shift off-screen.
-      if (self.trackingScrollViewIsBeingScrubbed) {
-        deltaY = MAX(0, deltaY);
-      }
-
-      if (self.canAlwaysExpandToMaximumHeight) {
-        // When still attached to the top content, don't accumulate negatively.
-        if (headerHeight >= self.minMaxHeight.minimumHeightWithTopSafeArea) {
-          deltaY = MAX(0, deltaY);
-        }
-      }
-
-      // Check if our delta y will cause us to cross the boundary from shrinking to shifting and,
-      // if so, cap the deltaY to only the overshoot, otherwise the header will overshift.
-
-      // headerHeight and deltaY are in inverted coordinate spaces, so when we do
-      // headerHeight + deltaY we're calculating where the headerHeight was _before_ this update.
-
-      CGFloat previousHeaderHeight = headerHeight + deltaY;
-
-      // Overshoot coming in
-      if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea &&
-          previousHeaderHeight > self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = self.minMaxHeight.minimumHeightWithTopSafeArea - headerHeight;
-
-        // Overshoot going out
-      } else if (headerHeight > self.minMaxHeight.minimumHeightWithTopSafeArea &&
-                 previousHeaderHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-        deltaY = (headerHeight + deltaY) - self.minMaxHeight.minimumHeightWithTopSafeArea;
-      }
-
-      // Calculate the upper bound of the accumulator based on what phase we're in.
-      CGFloat upperBound = [self upperBoundWithHeaderHeight:headerHeight];
-
-      // Ensure that we don't lose any deltaY by first capping the accumulator within its valid
-      // range.
-      _shiftAccumulator = MIN(upperBound, _shiftAccumulator);
-
-      // Accumulate the deltaY.
-      if (self.canAlwaysExpandToMaximumHeight) {
-        CGFloat lowerBound = [self fhv_accumulatorMin];
-        _shiftAccumulator = MAX(lowerBound, MIN(upperBound, _shiftAccumulator + deltaY));
-      } else {
-        _shiftAccumulator = MAX(0, MIN(upperBound, _shiftAccumulator + deltaY));
-      }
-    }
+    sample.deltaY = [self fhv_boundedContentOffset].y - _shiftAccumulatorLastContentOffset.y;
+    sample.isTracking = _trackingScrollView.isTracking;
+    sample.isScrubbing = self.trackingScrollViewIsBeingScrubbed;
+    sample.isOverExtendingBottom = [self fhv_isOverExtendingBottom];
+    sample.isAnimating = [self fhv_isDisplayLinkRunning];
+
+    MDCFlexibleHeaderShiftState state;
+    state.accumulator = _shiftAccumulator;
+    state.accumulatedDeltaY = _shiftAccumulatorDeltaY;
+    state.wantsToBeHidden = _wantsToBeHidden;
+    MDCFlexibleHeaderShiftStateAccumulateScroll(&state, &geometry, &sample);
+    _shiftAccumulator = state.accumulator;
+    _shiftAccumulatorDeltaY = state.accumulatedDeltaY;
+    _wantsToBeHidden = state.wantsToBeHidden;
   }
 
   if (!self.canAlwaysExpandToMaximumHeight) {
     CGRect bounds = self.bounds;
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight);
-    } else {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                               MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight));
-    }
+    bounds.size.height = MDCFlexibleHeaderShiftBoundsHeight(&geometry, _shiftAccumulator,
+                                                            headerHeight);
     self.bounds = bounds;
   }
 
-  [self fhv_commitAccumulatorToFrame];
+  [self fhv_commitAccumulatorToFrameWithGeometry:&geometry];
 
   _shiftAccumulatorLastContentOffset = [self fhv_boundedContentOffset];
   _shiftAccumulatorLastContentOffsetIsValid = YES;
 }
 
-- (CGFloat)upperBoundWithHeaderHeight:(CGFloat)headerHeight {
-  CGFloat upperBound;
-  if (self.canAlwaysExpandToMaximumHeight && ![self fhv_canShiftOffscreen]) {
-    // Don't allow any shifting.
-    upperBound = 0;
-  } else if (headerHeight < 0) {
-    if (self.minimumHeaderViewHeight != 0.0) {
-      // Set upperBound distance to be between
-      // |maximum height| and |remaining minimum height after shifting|.
-      upperBound = self.minMaxHeight.maximumHeightWithoutTopSafeArea - self.minimumHeaderViewHeight;
-    } else {
-      upperBound = [self fhv_accumulatorMax] + [self fhv_anchorLength];
-    }
-  } else if (headerHeight < self.minMaxHeight.minimumHeightWithTopSafeArea) {
-    if (self.minimumHeaderViewHeight != 0.0) {
-      // Set upperBound distance to be between
-      // |maximum height| and |remaining minimum height after shifting|.
-      upperBound = self.minMaxHeight.maximumHeightWithoutTopSafeArea - self.minimumHeaderViewHeight;
-    } else {
-      upperBound = [self fhv_accumulatorMax];
-    }
-
-  } else {
-    // Header is not shifting.
-    upperBound = 0;
-  }
-  return upperBound;
-}
-
 - (CGFloat)fhv_anchorLength {
   switch (_headerContentImportance) {
     case MDCFlexibleHeaderContentImportanceDefault:
@@ -1223,21 +1152,18 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
 
 // Commit the current shiftOffscreenAccumulator value to the view's position.
 - (void)fhv_commitAccumulatorToFrame {
+  MDCFlexibleHeaderShiftGeometry geometry = [self fhv_shiftGeometry];
+  [self fhv_commitAccumulatorToFrameWithGeometry:&geometry];
+}
+
+// Commits the accumulator with a geometry the caller already captured for this change.
+- (void)fhv_commitAccumulatorToFrameWithGeometry:(const MDCFlexibleHeaderShiftGeometry *)geometry {
   if (self.canAlwaysExpandToMaximumHeight) {
     CGFloat offsetWithoutInset = [self fhv_contentOffsetWithoutInjectedTopInset];
     CGFloat headerHeight = -offsetWithoutInset;
     CGRect bounds = self.bounds;
-
-    CGFloat additionalHeightInjection = MAX(0, -_shiftAccumulator);
-
-    if (_canOverExtend && !UIAccessibilityIsVoiceOverRunning()) {
-      bounds.size.height = MAX(self.minMaxHeight.minimumHeightWithTopSafeArea, headerHeight) +
-                           additionalHeightInjection;
-    } else {
-      bounds.size.height = (MAX(self.minMaxHeight.minimumHeightWithTopSafeArea,
-                                MIN(self.minMaxHeight.maximumHeightWithTopSafeArea, headerHeight)) +
-                            additionalHeightInjection);
-    }
+    bounds.size.height = MDCFlexibleHeaderShiftBoundsHeight(geometry, _shiftAccumulator,
+                                                            headerHeight);
 
     // Avoid excessive writes - the default behavior of the flexible header has minimal height
     // adjustment behavior (basically only when over-extending).
@@ -1247,12 +1173,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   }
 
   CGPoint position = self.center;
-  CGFloat shiftOffset;
-  if (self.canAlwaysExpandToMaximumHeight) {
-    shiftOffset = MAX(0, MIN([self fhv_accumulatorMax], _shiftAccumulator));
-  } else {
-    shiftOffset = MIN([self fhv_accumulatorMax], _shiftAccumulator);
-  }
+  CGFloat shiftOffset = MDCFlexibleHeaderShiftOffset(geometry, _shiftAccumulator);
   // Offset the frame.
   position.y = -shiftOffset;
   position.y += self.bounds.size.height / 2;
@@ -1262,7 +1183,7 @@ static char *const kKVOContextMDCFlexibleHeaderView = "kKVOContextMDCFlexibleHea
   [self fhv_accumulatorDidChange];
   [self fhv_recalculatePhase];
 
-  CGFloat opacityShiftThreshold = [self fhv_accumulatorMax] * kContentHidingThreshold;
+  CGFloat opacityShiftThreshold = geometry->accumulatorMax * kContentHidingThreshold;
   // 0% means not shifted at all, 100% means shifted up to our threshold amount.
   CGFloat percentShiftedAlongThreshold = MIN(1, MAX(0, shiftOffset / opacityShiftThreshold));
   for (UIView *view in _viewsToHideWhenShifted) {
@@ -0,0 +1,109 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/*
+ The shift and expansion state machine of MDCFlexibleHeaderView, as plain data.
+
+ The header derives a geometry and a scroll sample from its views on every content offset change
+ and feeds them through these functions. Because they only read and write the structs below, they
+ can also be driven by recorded content offsets without any views.
+ */
+
+/** The header configuration that bounds the shift accumulator. */
+typedef struct {
+  /** The minimum height of the header, including the top safe area. */
+  CGFloat minimumHeight;
+
+  /** The maximum height of the header, including the top safe area. */
+  CGFloat maximumHeight;
+
+  /** The maximum height of the header, excluding the top safe area. */
+  CGFloat maximumHeightWithoutTopSafeArea;
+
+  /** How far the header expands beyond its minimum height when it can always expand. */
+  CGFloat maximumExpansion;
+
+  /** The accumulator value at which the header is fully shifted off-screen. */
+  CGFloat accumulatorMax;
+
+  /** How far the content must scroll back before a shifted header starts shifting back. */
+  CGFloat anchorLength;
+
+  /** The part of the header that remains on-screen when shifted. */
+  CGFloat minimumHeaderViewHeight;
+
+  BOOL canAlwaysExpandToMaximumHeight;
+  BOOL canShiftOffscreen;
+
+  /** Whether the header may grow taller than its maximum height when the content is pulled down. */
+  BOOL canOverExtend;
+} MDCFlexibleHeaderShiftGeometry;
+
+/** The mutable shift state of a header. */
+typedef struct {
+  /**
+   When positive, how far the header is shifted off-screen. When negative, how far the header is
+   expanded beyond its height.
+   */
+  CGFloat accumulator;
+
+  /** The content offset change accumulated since the scroll direction last changed. */
+  CGFloat accumulatedDeltaY;
+
+  /** Whether the header would like to be shifted off-screen once the user stops scrolling. */
+  BOOL wantsToBeHidden;
+} MDCFlexibleHeaderShiftState;
+
+/** One content offset change of the tracking scroll view. */
+typedef struct {
+  /** The unclamped height of the header: the negated content offset without injected insets. */
+  CGFloat headerHeight;
+
+  /** The change of the bounded content offset since the previous sample. */
+  CGFloat deltaY;
+
+  BOOL isTracking;
+  BOOL isScrubbing;
+  BOOL isOverExtendingBottom;
+
+  /** Whether the header is animating on- or off-screen, which suspends accumulation. */
+  BOOL isAnimating;
+} MDCFlexibleHeaderScrollSample;
+
+/** Updates @c state with a content offset change. */
+FOUNDATION_EXTERN void MDCFlexibleHeaderShiftStateAccumulateScroll(
+    MDCFlexibleHeaderShiftState *_Nonnull state,
+    const MDCFlexibleHeaderShiftGeometry *_Nonnull geometry,
+    const MDCFlexibleHeaderScrollSample *_Nonnull sample);
+
+/** Returns the largest accumulator value allowed at @c headerHeight. */
+FOUNDATION_EXTERN CGFloat MDCFlexibleHeaderShiftUpperBound(
+    const MDCFlexibleHeaderShiftGeometry *_Nonnull geometry, CGFloat headerHeight);
+
+/** Returns the smallest accumulator value allowed at @c headerHeight. */
+FOUNDATION_EXTERN CGFloat MDCFlexibleHeaderShiftLowerBound(
+    const MDCFlexibleHeaderShiftGeometry *_Nonnull geometry, CGFloat headerHeight);
+
+/** Returns the height of the header's bounds for @c accumulator at @c headerHeight. */
+FOUNDATION_EXTERN CGFloat MDCFlexibleHeaderShiftBoundsHeight(
+    const MDCFlexibleHeaderShiftGeometry *_Nonnull geometry,
+    CGFloat accumulator,
+    CGFloat headerHeight);
+
+/** Returns how far the header's frame is moved up for @c accumulator. */
+FOUNDATION_EXTERN CGFloat MDCFlexibleHeaderShiftOffset(
+    const MDCFlexibleHeaderShiftGeometry *_Nonnull geometry, CGFloat accumulator);
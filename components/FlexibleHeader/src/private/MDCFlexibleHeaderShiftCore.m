@@ -0,0 +1,160 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCFlexibleHeaderShiftCore.h"
+
+// The minimum delta y before we change the scroll direction.
+static const CGFloat kDeltaYSlop = 5;
+
+void MDCFlexibleHeaderShiftStateAccumulateScroll(MDCFlexibleHeaderShiftState *state,
+                                                 const MDCFlexibleHeaderShiftGeometry *geometry,
+                                                 const MDCFlexibleHeaderScrollSample *sample) {
+  CGFloat deltaY = sample->deltaY;
+  CGFloat headerHeight = sample->headerHeight;
+
+  if (state->accumulatedDeltaY * deltaY < 0) {
+    // Direction has changed.
+    state->accumulatedDeltaY = 0;
+  }
+  state->accumulatedDeltaY += deltaY;
+
+  // Keeps track of the last direction the user moved their finger in.
+  if (sample->isTracking) {
+    if (state->accumulatedDeltaY > kDeltaYSlop) {
+      state->wantsToBeHidden = YES;
+    } else if (state->accumulatedDeltaY < -kDeltaYSlop) {
+      state->wantsToBeHidden = NO;
+    }
+  }
+
+  if (sample->isOverExtendingBottom || sample->isAnimating) {
+    return;
+  }
+
+  if (!geometry->canAlwaysExpandToMaximumHeight) {
+    // When we're not allowed to shift offscreen, only allow the header to shift further on-screen
+    // in case it was previously off-screen due to a behavior change.
+    if (!geometry->canShiftOffscreen) {
+      deltaY = MIN(0, deltaY);
+    }
+  }
+
+  // When scrubbing we only allow the header to shrink and shift off-screen.
+  if (sample->isScrubbing) {
+    deltaY = MAX(0, deltaY);
+  }
+
+  if (geometry->canAlwaysExpandToMaximumHeight) {
+    // When still attached to the top content, don't accumulate negatively.
+    if (headerHeight >= geometry->minimumHeight) {
+      deltaY = MAX(0, deltaY);
+    }
+  }
+
+  // Check if our delta y will cause us to cross the boundary from shrinking to shifting and, if
+  // so, cap the deltaY to only the overshoot, otherwise the header will overshift.
+
+  // headerHeight and deltaY are in inverted coordinate spaces, so when we do
+  // headerHeight + deltaY we're calculating where the headerHeight was _before_ this update.
+
+  CGFloat previousHeaderHeight = headerHeight + deltaY;
+
+  // Overshoot coming in
+  if (headerHeight < geometry->minimumHeight && previousHeaderHeight > geometry->minimumHeight) {
+    deltaY = geometry->minimumHeight - headerHeight;
+
+    // Overshoot going out
+  } else if (headerHeight > geometry->minimumHeight &&
+             previousHeaderHeight < geometry->minimumHeight) {
+    deltaY = (headerHeight + deltaY) - geometry->minimumHeight;
+  }
+
+  // Calculate the upper bound of the accumulator based on what phase we're in.
+  CGFloat upperBound = MDCFlexibleHeaderShiftUpperBound(geometry, headerHeight);
+
+  // Ensure that we don't lose any deltaY by first capping the accumulator within its valid range.
+  state->accumulator = MIN(upperBound, state->accumulator);
+
+  // Accumulate the deltaY.
+  if (geometry->canAlwaysExpandToMaximumHeight) {
+    CGFloat lowerBound = MDCFlexibleHeaderShiftLowerBound(geometry, headerHeight);
+    state->accumulator = MAX(lowerBound, MIN(upperBound, state->accumulator + deltaY));
+  } else {
+    state->accumulator = MAX(0, MIN(upperBound, state->accumulator + deltaY));
+  }
+}
+
+CGFloat MDCFlexibleHeaderShiftUpperBound(const MDCFlexibleHeaderShiftGeometry *geometry,
+                                         CGFloat headerHeight) {
+  if (geometry->canAlwaysExpandToMaximumHeight && !geometry->canShiftOffscreen) {
+    // Don't allow any shifting.
+    return 0;
+  }
+  if (headerHeight < 0) {
+    if (geometry->minimumHeaderViewHeight != 0) {
+      // Set upperBound distance to be between
+      // |maximum height| and |remaining minimum height after shifting|.
+      return geometry->maximumHeightWithoutTopSafeArea - geometry->minimumHeaderViewHeight;
+    }
+    return geometry->accumulatorMax + geometry->anchorLength;
+  }
+  if (headerHeight < geometry->minimumHeight) {
+    if (geometry->minimumHeaderViewHeight != 0) {
+      return geometry->maximumHeightWithoutTopSafeArea - geometry->minimumHeaderViewHeight;
+    }
+    return geometry->accumulatorMax;
+  }
+  // Header is not shifting.
+  return 0;
+}
+
+CGFloat MDCFlexibleHeaderShiftLowerBound(const MDCFlexibleHeaderShiftGeometry *geometry,
+                                         CGFloat headerHeight) {
+  if (!geometry->canAlwaysExpandToMaximumHeight) {
+    return 0;
+  }
+  CGFloat maxExpansion;
+  if (headerHeight < geometry->minimumHeight) {
+    // The header is detached from the content and able to fully expand.
+    maxExpansion = geometry->maximumExpansion;
+  } else {
+    // We're now attached to the content and need to constrain our possible expansion.
+    maxExpansion = geometry->maximumHeight - headerHeight;
+  }
+  // Expansion is tracked via negative accumulation.
+  return MIN(0, -maxExpansion);
+}
+
+CGFloat MDCFlexibleHeaderShiftBoundsHeight(const MDCFlexibleHeaderShiftGeometry *geometry,
+                                           CGFloat accumulator,
+                                           CGFloat headerHeight) {
+  CGFloat height;
+  if (geometry->canOverExtend) {
+    height = MAX(geometry->minimumHeight, headerHeight);
+  } else {
+    height = MAX(geometry->minimumHeight, MIN(geometry->maximumHeight, headerHeight));
+  }
+  if (geometry->canAlwaysExpandToMaximumHeight) {
+    height += MAX(0, -accumulator);
+  }
+  return height;
+}
+
+CGFloat MDCFlexibleHeaderShiftOffset(const MDCFlexibleHeaderShiftGeometry *geometry,
+                                     CGFloat accumulator) {
+  if (geometry->canAlwaysExpandToMaximumHeight) {
+    return MAX(0, MIN(geometry->accumulatorMax, accumulator));
+  }
+  return MIN(geometry->accumulatorMax, accumulator);
+}
@@ -14,6 +14,8 @@
 
 #import "MDCFlexibleHeaderView.h"
 
+@class MDCDisplayLinkScheduler;
+
 @interface MDCFlexibleHeaderView ()
 
 /*
@@ -48,6 +50,14 @@
  */
 @property(nonatomic, readonly) CGFloat topSafeAreaGuideHeight;
 
+/**
+ The scheduler that drives the header while it animates on- or off-screen.
+
+ Defaults to the shared scheduler. Simulations can use a scheduler without a display link to advance
+ the animations deterministically.
+ */
+@property(nonatomic, strong, nonnull) MDCDisplayLinkScheduler *displayLinkScheduler;
+
 #pragma mark - WebKit compatibility
 
 /**
@@ -0,0 +1,245 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFlexibleHeaderView+Private.h"
+#import "MaterialDisplayLink.h"
+#import "MaterialFlexibleHeader.h"
+
+/** The frame rates the simulations run at, in Hz. */
+static const NSInteger kFrameRates[] = {60, 90, 120};
+
+/** The longest a simulated animation may run before it's considered stuck. */
+static const NSTimeInterval kMaximumSimulatedDuration = 10;
+
+/** A scroll view whose tracking state can be set, as if a finger were dragging it. */
+@interface FlexibleHeaderSimulationScrollView : UIScrollView
+@property(nonatomic, getter=isTracking) BOOL tracking;
+@end
+
+@implementation FlexibleHeaderSimulationScrollView
+@synthesize tracking = _tracking;
+@end
+
+/** The state of a header once a simulation has ended. */
+typedef struct {
+  CGRect frame;
+  BOOL shiftedOffscreen;
+  NSTimeInterval duration;
+} FlexibleHeaderSimulationResult;
+
+@interface FlexibleHeaderDisplayLinkSimulationTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderDisplayLinkSimulationTests {
+  MDCFlexibleHeaderView *_headerView;
+  FlexibleHeaderSimulationScrollView *_scrollView;
+  MDCDisplayLinkScheduler *_scheduler;
+}
+
+- (void)setUp {
+  [super setUp];
+
+  [self resetHeaderView];
+}
+
+- (void)tearDown {
+  _headerView = nil;
+  _scrollView = nil;
+  _scheduler = nil;
+
+  [super tearDown];
+}
+
+#pragma mark - Helpers
+
+/** Creates a new header tracking a new scroll view, driven by a scheduler without display link. */
+- (void)resetHeaderView {
+  _scheduler = [[MDCDisplayLinkScheduler alloc] initWithDisplayLinkEnabled:NO];
+  _scrollView = [[FlexibleHeaderSimulationScrollView alloc] init];
+  _scrollView.frame = CGRectMake(0, 0, 100, 100);
+  _scrollView.contentSize = CGSizeMake(100, 2000);
+  _headerView = [[MDCFlexibleHeaderView alloc] init];
+  _headerView.displayLinkScheduler = _scheduler;
+  _headerView.shiftBehavior = MDCFlexibleHeaderShiftBehaviorEnabled;
+  _headerView.trackingScrollView = _scrollView;
+  [_headerView trackingScrollViewDidScroll];
+}
+
+/**
+ Drags the scroll view through @c offsets, each relative to the content offset the drag started at,
+ and releases it without deceleration.
+ */
+- (void)replayDragWithOffsets:(const CGFloat *)offsets count:(NSUInteger)count {
+  CGFloat startOffset = _scrollView.contentOffset.y;
+  _scrollView.tracking = YES;
+  for (NSUInteger i = 0; i < count; ++i) {
+    _scrollView.contentOffset = CGPointMake(0, startOffset + offsets[i]);
+    [_headerView trackingScrollViewDidScroll];
+  }
+  _scrollView.tracking = NO;
+  [_headerView trackingScrollViewDidEndDraggingWillDecelerate:NO];
+}
+
+/** Advances the scheduler at @c frameRate until the header stops animating. */
+- (FlexibleHeaderSimulationResult)simulateAtFrameRate:(NSInteger)frameRate {
+  NSInteger frameCount = 0;
+  NSInteger maximumFrameCount = (NSInteger)(kMaximumSimulatedDuration * frameRate);
+  while (_scheduler.isActive && frameCount < maximumFrameCount) {
+    [_scheduler advanceByDuration:1.0 / frameRate];
+    frameCount += 1;
+  }
+  XCTAssertFalse(_scheduler.isActive, @"The header didn't settle at %@ Hz.", @(frameRate));
+
+  FlexibleHeaderSimulationResult result;
+  result.frame = _headerView.frame;
+  result.shiftedOffscreen = _headerView.isShiftedOffscreen;
+  result.duration = (NSTimeInterval)frameCount / frameRate;
+  return result;
+}
+
+/** Advances the scheduler at @c frameRate for @c duration and returns the header's top edge. */
+- (CGFloat)topEdgeAfterDuration:(NSTimeInterval)duration atFrameRate:(NSInteger)frameRate {
+  NSInteger frameCount = (NSInteger)round(duration * frameRate);
+  for (NSInteger frame = 0; frame < frameCount; ++frame) {
+    [_scheduler advanceByDuration:1.0 / frameRate];
+  }
+  return CGRectGetMinY(_headerView.frame);
+}
+
+/** Asserts that simulating @c trace at every frame rate ends in the same state. */
+- (FlexibleHeaderSimulationResult)assertTraceSettlesIdentically:(const CGFloat *)trace
+                                                          count:(NSUInteger)count {
+  FlexibleHeaderSimulationResult results[sizeof(kFrameRates) / sizeof(kFrameRates[0])];
+  for (size_t i = 0; i < sizeof(kFrameRates) / sizeof(kFrameRates[0]); ++i) {
+    [self resetHeaderView];
+    [self replayDragWithOffsets:trace count:count];
+    XCTAssertTrue(_scheduler.isActive, @"The trace should leave the header partially shifted.");
+    results[i] = [self simulateAtFrameRate:kFrameRates[i]];
+  }
+
+  for (size_t i = 1; i < sizeof(kFrameRates) / sizeof(kFrameRates[0]); ++i) {
+    XCTAssertTrue(CGRectEqualToRect(results[i].frame, results[0].frame), @"%@ Hz: %@ vs %@",
+                  @(kFrameRates[i]), NSStringFromCGRect(results[i].frame),
+                  NSStringFromCGRect(results[0].frame));
+    XCTAssertEqual(results[i].shiftedOffscreen, results[0].shiftedOffscreen);
+    // Settling can only differ by the frame that crossed the end of the animation.
+    XCTAssertEqualWithAccuracy(results[i].duration, results[0].duration, 1.0 / 60 + 1e-9);
+  }
+  return results[0];
+}
+
+#pragma mark - Tests
+
+- (void)testDragBackOnScreenSettlesIdenticallyAtAllFrameRates {
+  // Given
+  // Scrolls far enough for the header to shift off-screen, then scrolls back up most of the way.
+  CGFloat trace[60];
+  for (NSInteger i = 0; i < 40; ++i) {
+    trace[i] = (i + 1) * 10;
+  }
+  for (NSInteger i = 40; i < 60; ++i) {
+    trace[i] = 400 - (i - 39) * 10;
+  }
+
+  // When
+  FlexibleHeaderSimulationResult result =
+      [self assertTraceSettlesIdentically:trace count:sizeof(trace) / sizeof(trace[0])];
+
+  // Then
+  XCTAssertFalse(result.shiftedOffscreen);
+  XCTAssertEqualWithAccuracy(CGRectGetMinY(result.frame), 0, 0.001);
+}
+
+- (void)testDragOffScreenSettlesIdenticallyAtAllFrameRates {
+  // Given
+  // Like the trace above, but ends with a short scroll down so that the header wants to hide.
+  CGFloat trace[63];
+  for (NSInteger i = 0; i < 40; ++i) {
+    trace[i] = (i + 1) * 10;
+  }
+  for (NSInteger i = 40; i < 60; ++i) {
+    trace[i] = 400 - (i - 39) * 10;
+  }
+  for (NSInteger i = 60; i < 63; ++i) {
+    trace[i] = 200 + (i - 59) * 5;
+  }
+
+  // When
+  FlexibleHeaderSimulationResult result =
+      [self assertTraceSettlesIdentically:trace count:sizeof(trace) / sizeof(trace[0])];
+
+  // Then
+  XCTAssertTrue(result.shiftedOffscreen);
+}
+
+- (void)testShiftOffScreenAnimatedSettlesIdenticallyAtAllFrameRates {
+  FlexibleHeaderSimulationResult results[sizeof(kFrameRates) / sizeof(kFrameRates[0])];
+  for (size_t i = 0; i < sizeof(kFrameRates) / sizeof(kFrameRates[0]); ++i) {
+    // Given
+    [self resetHeaderView];
+
+    // When
+    [_headerView shiftHeaderOffScreenAnimated:YES];
+    results[i] = [self simulateAtFrameRate:kFrameRates[i]];
+
+    // Then
+    XCTAssertTrue(results[i].shiftedOffscreen);
+    XCTAssertTrue(CGRectEqualToRect(results[i].frame, results[0].frame));
+  }
+}
+
+- (void)testAnimationProgressIsIndependentOfTheFrameRate {
+  // Given
+  CGFloat topEdges[sizeof(kFrameRates) / sizeof(kFrameRates[0])];
+
+  for (size_t i = 0; i < sizeof(kFrameRates) / sizeof(kFrameRates[0]); ++i) {
+    [self resetHeaderView];
+
+    // When
+    [_headerView shiftHeaderOffScreenAnimated:YES];
+    // 0.1 seconds is a whole number of frames at every simulated frame rate.
+    topEdges[i] = [self topEdgeAfterDuration:0.1 atFrameRate:kFrameRates[i]];
+  }
+
+  // Then
+  XCTAssertLessThan(topEdges[0], 0, @"The header should be partway off-screen.");
+  XCTAssertGreaterThan(topEdges[0], -_headerView.maximumHeight);
+  for (size_t i = 1; i < sizeof(kFrameRates) / sizeof(kFrameRates[0]); ++i) {
+    XCTAssertEqualWithAccuracy(topEdges[i], topEdges[0], 0.001);
+  }
+}
+
+- (void)testDroppedFramesDoNotChangeAnimationProgress {
+  // Given
+  [_headerView shiftHeaderOffScreenAnimated:YES];
+  CGFloat steadyTopEdge = [self topEdgeAfterDuration:0.1 atFrameRate:120];
+  [self resetHeaderView];
+  [_headerView shiftHeaderOffScreenAnimated:YES];
+
+  // When
+  // 0.1 seconds at 120 Hz, where some frames took three times as long as if two were dropped.
+  [_scheduler advanceByDuration:1.0 / 120];
+  [_scheduler advanceByDuration:3.0 / 120];
+  [_scheduler advanceByDuration:1.0 / 120];
+  [_scheduler advanceByDuration:1.0 / 120];
+  [_scheduler advanceByDuration:3.0 / 120];
+  [_scheduler advanceByDuration:3.0 / 120];
+
+  // Then
+  XCTAssertEqualWithAccuracy(CGRectGetMinY(_headerView.frame), steadyTopEdge, 0.001);
+}
+
+@end
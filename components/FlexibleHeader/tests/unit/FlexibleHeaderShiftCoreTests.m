@@ -0,0 +1,248 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFlexibleHeaderShiftCore.h"
+
+/** One step of a recorded scroll trace and the header state it should produce. */
+typedef struct {
+  CGFloat contentOffset;
+  CGFloat boundsHeight;
+  CGFloat shiftOffset;
+} ShiftCoreTraceStep;
+
+/** The content offset a trace starts at: the top of the content below a 76 point header. */
+static const CGFloat kTraceStartContentOffset = -76;
+
+/**
+ A drag that scrolls the header off-screen, scrolls back most of the anchor length, nudges down,
+ and then pulls the content down past its top.
+ */
+static const ShiftCoreTraceStep kDefaultGeometryTrace[] = {
+    {-51, 76, 25},
+    {-26, 76, 50},
+    {-1, 76, 56},
+    {24, 76, 56},
+    {49, 76, 56},
+    {74, 76, 56},
+    {99, 76, 56},
+    {124, 76, 56},
+    {149, 76, 56},
+    {174, 76, 56},
+    {199, 76, 56},
+    {224, 76, 56},
+    {249, 76, 56},
+    {274, 76, 56},
+    {299, 76, 56},
+    {279, 76, 56},
+    {259, 76, 56},
+    {239, 76, 56},
+    {219, 76, 56},
+    {199, 76, 56},
+    {179, 76, 56},
+    {159, 76, 56},
+    {139, 76, 56},
+    {119, 76, 51},
+    {99, 76, 31},
+    {114, 76, 46},
+    {129, 76, 56},
+    {144, 76, 56},
+    {159, 76, 56},
+    {119, 76, 51},
+    {79, 76, 11},
+    {39, 76, 0},
+    {-1, 76, 0},
+    {-41, 76, 0},
+    {-81, 81, 0},
+    {-121, 121, 0},
+};
+
+/** The same drag for a header that can always expand to its maximum height of 176 points. */
+static const ShiftCoreTraceStep kCanAlwaysExpandGeometryTrace[] = {
+    {-51, 76, 25},
+    {-26, 76, 50},
+    {-1, 76, 56},
+    {24, 76, 56},
+    {49, 76, 56},
+    {74, 76, 56},
+    {99, 76, 56},
+    {124, 76, 56},
+    {149, 76, 56},
+    {174, 76, 56},
+    {199, 76, 56},
+    {224, 76, 56},
+    {249, 76, 56},
+    {274, 76, 56},
+    {299, 76, 56},
+    {279, 76, 56},
+    {259, 76, 56},
+    {239, 76, 56},
+    {219, 76, 56},
+    {199, 76, 56},
+    {179, 76, 56},
+    {159, 76, 56},
+    {139, 76, 56},
+    {119, 76, 51},
+    {99, 76, 31},
+    {114, 76, 46},
+    {129, 76, 56},
+    {144, 76, 56},
+    {159, 76, 56},
+    {119, 76, 51},
+    {79, 76, 11},
+    {39, 105, 0},
+    {-1, 145, 0},
+    {-41, 176, 0},
+    {-81, 176, 0},
+    {-121, 176, 0},
+};
+
+/** The geometry of a default header with a 20 point status bar. */
+static MDCFlexibleHeaderShiftGeometry DefaultGeometry(void) {
+  MDCFlexibleHeaderShiftGeometry geometry;
+  geometry.minimumHeight = 76;
+  geometry.maximumHeight = 76;
+  geometry.maximumHeightWithoutTopSafeArea = 56;
+  geometry.maximumExpansion = 0;
+  geometry.accumulatorMax = 56;
+  geometry.anchorLength = 175;
+  geometry.minimumHeaderViewHeight = 0;
+  geometry.canAlwaysExpandToMaximumHeight = NO;
+  geometry.canShiftOffscreen = YES;
+  geometry.canOverExtend = YES;
+  return geometry;
+}
+
+static MDCFlexibleHeaderShiftGeometry CanAlwaysExpandGeometry(void) {
+  MDCFlexibleHeaderShiftGeometry geometry = DefaultGeometry();
+  geometry.maximumHeight = 176;
+  geometry.maximumHeightWithoutTopSafeArea = 156;
+  geometry.maximumExpansion = 100;
+  geometry.canAlwaysExpandToMaximumHeight = YES;
+  return geometry;
+}
+
+/**
+ Feeds the content offsets of @c trace through the shift core as a drag and writes the resulting
+ bounds height and shift offset of each step to @c results.
+ */
+static void ReplayTrace(const MDCFlexibleHeaderShiftGeometry *geometry,
+                        const ShiftCoreTraceStep *trace,
+                        size_t count,
+                        ShiftCoreTraceStep *results) {
+  MDCFlexibleHeaderShiftState state = {0, 0, NO};
+  CGFloat previousContentOffset = kTraceStartContentOffset;
+  for (size_t i = 0; i < count; ++i) {
+    MDCFlexibleHeaderScrollSample sample;
+    sample.headerHeight = -trace[i].contentOffset;
+    sample.deltaY = trace[i].contentOffset - previousContentOffset;
+    sample.isTracking = YES;
+    sample.isScrubbing = NO;
+    sample.isOverExtendingBottom = NO;
+    sample.isAnimating = NO;
+    MDCFlexibleHeaderShiftStateAccumulateScroll(&state, geometry, &sample);
+
+    results[i].contentOffset = trace[i].contentOffset;
+    results[i].boundsHeight =
+        MDCFlexibleHeaderShiftBoundsHeight(geometry, state.accumulator, sample.headerHeight);
+    results[i].shiftOffset = MDCFlexibleHeaderShiftOffset(geometry, state.accumulator);
+    previousContentOffset = trace[i].contentOffset;
+  }
+}
+
+@interface FlexibleHeaderShiftCoreTests : XCTestCase
+@end
+
+@implementation FlexibleHeaderShiftCoreTests
+
+- (void)assertReplayOfTrace:(const ShiftCoreTraceStep *)trace
+                      count:(size_t)count
+                   geometry:(MDCFlexibleHeaderShiftGeometry)geometry {
+  ShiftCoreTraceStep *results = malloc(count * sizeof(ShiftCoreTraceStep));
+  ReplayTrace(&geometry, trace, count, results);
+  for (size_t i = 0; i < count; ++i) {
+    XCTAssertEqualWithAccuracy(results[i].boundsHeight, trace[i].boundsHeight, 0.001,
+                               @"Step %@ at content offset %@", @(i), @(trace[i].contentOffset));
+    XCTAssertEqualWithAccuracy(results[i].shiftOffset, trace[i].shiftOffset, 0.001,
+                               @"Step %@ at content offset %@", @(i), @(trace[i].contentOffset));
+  }
+  free(results);
+}
+
+- (void)testDefaultGeometryMatchesGoldenTrace {
+  [self assertReplayOfTrace:kDefaultGeometryTrace
+                      count:sizeof(kDefaultGeometryTrace) / sizeof(kDefaultGeometryTrace[0])
+                   geometry:DefaultGeometry()];
+}
+
+- (void)testCanAlwaysExpandGeometryMatchesGoldenTrace {
+  [self assertReplayOfTrace:kCanAlwaysExpandGeometryTrace
+                      count:sizeof(kCanAlwaysExpandGeometryTrace) /
+                            sizeof(kCanAlwaysExpandGeometryTrace[0])
+                   geometry:CanAlwaysExpandGeometry()];
+}
+
+- (void)testTrackingUpdatesWantsToBeHiddenPastTheSlop {
+  // Given
+  MDCFlexibleHeaderShiftGeometry geometry = DefaultGeometry();
+  MDCFlexibleHeaderShiftState state = {0, 0, NO};
+  MDCFlexibleHeaderScrollSample sample = {-200, 4, YES, NO, NO, NO};
+
+  // When
+  MDCFlexibleHeaderShiftStateAccumulateScroll(&state, &geometry, &sample);
+
+  // Then
+  XCTAssertFalse(state.wantsToBeHidden);
+
+  // When
+  MDCFlexibleHeaderShiftStateAccumulateScroll(&state, &geometry, &sample);
+
+  // Then
+  XCTAssertTrue(state.wantsToBeHidden);
+}
+
+- (void)testAnimatingHeaderDoesNotAccumulate {
+  // Given
+  MDCFlexibleHeaderShiftGeometry geometry = DefaultGeometry();
+  MDCFlexibleHeaderShiftState state = {20, 0, NO};
+  MDCFlexibleHeaderScrollSample sample = {-200, 10, YES, NO, NO, YES};
+
+  // When
+  MDCFlexibleHeaderShiftStateAccumulateScroll(&state, &geometry, &sample);
+
+  // Then
+  XCTAssertEqualWithAccuracy(state.accumulator, 20, 0.001);
+  XCTAssertTrue(state.wantsToBeHidden);
+}
+
+- (void)testReplayPerformance {
+  // Given
+  MDCFlexibleHeaderShiftGeometry geometry = CanAlwaysExpandGeometry();
+  const size_t count =
+      sizeof(kCanAlwaysExpandGeometryTrace) / sizeof(kCanAlwaysExpandGeometryTrace[0]);
+  ShiftCoreTraceStep *results = malloc(count * sizeof(ShiftCoreTraceStep));
+  const NSUInteger replayCount = 10000;
+
+  // When
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < replayCount; ++i) {
+      ReplayTrace(&geometry, kCanAlwaysExpandGeometryTrace, count, results);
+    }
+  }];
+
+  free(results);
+}
+
+@end
@@ -15,6 +15,7 @@
 #import "MDCInkView.h"
 
 #import "private/MDCInkLayer.h"
+#import "private/MDCInkView+Private.h"
 #import "private/MDCLegacyInkLayer.h"
 #import "MDCInkViewDelegate.h"
 
@@ -39,7 +40,13 @@
 
 @end
 
-@implementation MDCInkView
+/** The number of ink layers an ink view keeps for reuse. */
+static const NSUInteger kInkLayerPoolCapacity = 3;
+
+@implementation MDCInkView {
+  // The ink layers the view reuses. A layer is idle while it has no superlayer.
+  NSMutableArray<MDCInkLayer *> *_inkLayerPool;
+}
 
 + (Class)layerClass {
   return [MDCLegacyInkLayer class];
@@ -74,6 +81,7 @@
   _maskLayer.delegate = self;
 
   self.inkLayer.animationDelegate = self;
+  _inkLayerPool = [NSMutableArray arrayWithCapacity:kInkLayerPoolCapacity];
 }
 
 - (void)layoutSubviews {
@@ -176,10 +184,9 @@
     [self.inkLayer spreadFromPoint:point completion:completionBlock];
   } else {
     self.startInkRippleCompletionBlock = completionBlock;
-    MDCInkLayer *inkLayer = [MDCInkLayer layer];
+    MDCInkLayer *inkLayer = [self dequeueInkLayer];
     inkLayer.inkColor = self.inkColor;
     inkLayer.maxRippleRadius = self.maxRippleRadius;
-    inkLayer.animationDelegate = self;
     inkLayer.opacity = 0;
     inkLayer.frame = self.bounds;
     [self.layer addSublayer:inkLayer];
@@ -188,6 +195,24 @@
   }
 }
 
+- (MDCInkLayer *)dequeueInkLayer {
+  for (MDCInkLayer *inkLayer in _inkLayerPool) {
+    if (!inkLayer.superlayer) {
+      _inkLayerPoolHitCount += 1;
+      [inkLayer prepareForReuse];
+      return inkLayer;
+    }
+  }
+
+  MDCInkLayer *inkLayer = [MDCInkLayer layer];
+  inkLayer.animationDelegate = self;
+  _createdInkLayerCount += 1;
+  if (_inkLayerPool.count < kInkLayerPoolCapacity) {
+    [_inkLayerPool addObject:inkLayer];
+  }
+  return inkLayer;
+}
+
 - (void)startTouchEndAtPoint:(CGPoint)point
                     animated:(BOOL)animated
               withCompletion:(nullable MDCInkCompletionBlock)completionBlock {
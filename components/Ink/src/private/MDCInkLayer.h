@@ -105,4 +105,10 @@
  */
 - (void)endInkAtPoint:(CGPoint)point animated:(BOOL)animated;
 
+/**
+ Prepares a layer that was removed from its superlayer to present a new ink ripple, by removing its
+ animations and the state of its previous ink ripple.
+ */
+- (void)prepareForReuse;
+
 @end
@@ -15,6 +15,7 @@
 #import "MDCInkLayer.h"
 
 #import "MDCInkLayerDelegate.h"
+#import "MaterialAnimationTiming.h"
 
 static const CGFloat MDCInkLayerCommonDuration = (CGFloat)0.083;
 static const CGFloat MDCInkLayerEndFadeOutDuration = (CGFloat)0.15;
@@ -30,7 +31,114 @@ static NSString *const MDCInkLayerOpacityString = @"opacity";
 static NSString *const MDCInkLayerPositionString = @"position";
 static NSString *const MDCInkLayerScaleString = @"transform.scale";
 
-@implementation MDCInkLayer
+#pragma mark - Animation templates
+
+/** Returns a new start scale animation. Its @c fromValue must be set. */
+static CABasicAnimation *StartScaleAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCInkLayer.startScale"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
+                             scaleAnim.keyPath = MDCInkLayerScaleString;
+                             scaleAnim.toValue = @1;
+                             scaleAnim.duration = MDCInkLayerStartScalePositionDuration;
+                             scaleAnim.beginTime = MDCInkLayerCommonDuration;
+                             scaleAnim.timingFunction = [CAMediaTimingFunction
+                                 mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+                             scaleAnim.fillMode = kCAFillModeForwards;
+                             scaleAnim.removedOnCompletion = NO;
+                             return scaleAnim;
+                           }];
+}
+
+/** Returns a new start position animation. Its @c path must be set. */
+static CAKeyframeAnimation *StartPositionAnimation(void) {
+  return [CAKeyframeAnimation
+      mdc_animationWithTemplateKey:@"MDCInkLayer.startPosition"
+                           builder:^CAAnimation * {
+                             CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
+                             positionAnim.keyPath = MDCInkLayerPositionString;
+                             positionAnim.keyTimes = @[ @0, @1 ];
+                             positionAnim.values = @[ @0, @1 ];
+                             positionAnim.duration = MDCInkLayerStartScalePositionDuration;
+                             positionAnim.beginTime = MDCInkLayerCommonDuration;
+                             positionAnim.timingFunction = [CAMediaTimingFunction
+                                 mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+                             positionAnim.fillMode = kCAFillModeForwards;
+                             positionAnim.removedOnCompletion = NO;
+                             return positionAnim;
+                           }];
+}
+
+/** Returns a new start fade in animation. */
+static CABasicAnimation *StartFadeInAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCInkLayer.startFadeIn"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
+                             fadeInAnim.keyPath = MDCInkLayerOpacityString;
+                             fadeInAnim.fromValue = @0;
+                             fadeInAnim.toValue = @1;
+                             fadeInAnim.duration = MDCInkLayerCommonDuration;
+                             fadeInAnim.beginTime = MDCInkLayerCommonDuration;
+                             fadeInAnim.timingFunction = [CAMediaTimingFunction
+                                 functionWithName:kCAMediaTimingFunctionLinear];
+                             fadeInAnim.fillMode = kCAFillModeForwards;
+                             fadeInAnim.removedOnCompletion = NO;
+                             return fadeInAnim;
+                           }];
+}
+
+/** Returns a new start animation group. Its @c animations must be set. */
+static CAAnimationGroup *StartAnimationGroup(void) {
+  return [CAAnimationGroup
+      mdc_animationWithTemplateKey:@"MDCInkLayer.start"
+                           builder:^CAAnimation * {
+                             CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
+                             animGroup.duration = MDCInkLayerStartScalePositionDuration;
+                             animGroup.fillMode = kCAFillModeForwards;
+                             animGroup.removedOnCompletion = NO;
+                             return animGroup;
+                           }];
+}
+
+/**
+ Returns a new opacity animation that holds its final value. Its @c fromValue, @c toValue,
+ @c duration and @c beginTime must be set.
+ */
+static CABasicAnimation *FadeAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCInkLayer.fade"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *fadeAnim = [[CABasicAnimation alloc] init];
+                             fadeAnim.keyPath = MDCInkLayerOpacityString;
+                             fadeAnim.timingFunction = [CAMediaTimingFunction
+                                 functionWithName:kCAMediaTimingFunctionLinear];
+                             fadeAnim.fillMode = kCAFillModeForwards;
+                             fadeAnim.removedOnCompletion = NO;
+                             return fadeAnim;
+                           }];
+}
+
+/**
+ Returns a circle path in @c ovalRect. Ink layers of the same size share their path, so the path of
+ the last circle is kept and returned again while the circle doesn't change.
+ */
+static CGPathRef GetCirclePath(CGRect ovalRect) {
+  static UIBezierPath *lastCirclePath;
+  static CGRect lastOvalRect;
+  if (!lastCirclePath || !CGRectEqualToRect(ovalRect, lastOvalRect)) {
+    lastCirclePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
+    lastOvalRect = ovalRect;
+  }
+  return lastCirclePath.CGPath;
+}
+
+@implementation MDCInkLayer {
+  // Incremented when the layer is reused, so completion blocks of the animations of a previous
+  // ink ripple don't change the state of the current one.
+  NSUInteger _inkGeneration;
+}
 
 - (instancetype)init {
   self = [super init];
@@ -93,8 +201,10 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
   }
   CGRect ovalRect = CGRectMake(CGRectGetWidth(self.bounds) / 2 - radius,
                                CGRectGetHeight(self.bounds) / 2 - radius, radius * 2, radius * 2);
-  UIBezierPath *circlePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
-  self.path = circlePath.CGPath;
+  CGPathRef circlePath = GetCirclePath(ovalRect);
+  if (self.path != circlePath) {
+    self.path = circlePath;
+  }
   self.fillColor = self.inkColor.CGColor;
   if (!animated) {
     self.opacity = 1;
@@ -104,9 +214,6 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
     self.position = point;
     _startAnimationActive = YES;
 
-    CAMediaTimingFunction *materialTimingFunction =
-        [[CAMediaTimingFunction alloc] initWithControlPoints:(float) 0.4:0:(float)0.2:1];
-
     CGFloat scaleStart =
         MIN(CGRectGetWidth(self.bounds), CGRectGetHeight(self.bounds)) / MDCInkLayerScaleDivisor;
     if (scaleStart < MDCInkLayerScaleStartMin) {
@@ -115,15 +222,8 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
       scaleStart = MDCInkLayerScaleStartMax;
     }
 
-    CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
-    scaleAnim.keyPath = MDCInkLayerScaleString;
+    CABasicAnimation *scaleAnim = StartScaleAnimation();
     scaleAnim.fromValue = @(scaleStart);
-    scaleAnim.toValue = @1;
-    scaleAnim.duration = MDCInkLayerStartScalePositionDuration;
-    scaleAnim.beginTime = MDCInkLayerCommonDuration;
-    scaleAnim.timingFunction = materialTimingFunction;
-    scaleAnim.fillMode = kCAFillModeForwards;
-    scaleAnim.removedOnCompletion = NO;
 
     UIBezierPath *centerPath = [UIBezierPath bezierPath];
     CGPoint startPoint = point;
@@ -133,36 +233,19 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
     [centerPath addLineToPoint:endPoint];
     [centerPath closePath];
 
-    CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
-    positionAnim.keyPath = MDCInkLayerPositionString;
+    CAKeyframeAnimation *positionAnim = StartPositionAnimation();
     positionAnim.path = centerPath.CGPath;
-    positionAnim.keyTimes = @[ @0, @1 ];
-    positionAnim.values = @[ @0, @1 ];
-    positionAnim.duration = MDCInkLayerStartScalePositionDuration;
-    positionAnim.beginTime = MDCInkLayerCommonDuration;
-    positionAnim.timingFunction = materialTimingFunction;
-    positionAnim.fillMode = kCAFillModeForwards;
-    positionAnim.removedOnCompletion = NO;
-
-    CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-    fadeInAnim.keyPath = MDCInkLayerOpacityString;
-    fadeInAnim.fromValue = @0;
-    fadeInAnim.toValue = @1;
-    fadeInAnim.duration = MDCInkLayerCommonDuration;
-    fadeInAnim.beginTime = MDCInkLayerCommonDuration;
-    fadeInAnim.timingFunction =
-        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-    fadeInAnim.fillMode = kCAFillModeForwards;
-    fadeInAnim.removedOnCompletion = NO;
+
+    CABasicAnimation *fadeInAnim = StartFadeInAnimation();
 
     [CATransaction begin];
-    CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
+    CAAnimationGroup *animGroup = StartAnimationGroup();
     animGroup.animations = @[ scaleAnim, positionAnim, fadeInAnim ];
-    animGroup.duration = MDCInkLayerStartScalePositionDuration;
-    animGroup.fillMode = kCAFillModeForwards;
-    animGroup.removedOnCompletion = NO;
+    NSUInteger generation = _inkGeneration;
     [CATransaction setCompletionBlock:^{
-      self->_startAnimationActive = NO;
+      if (self->_inkGeneration == generation) {
+        self->_startAnimationActive = NO;
+      }
     }];
     [self addAnimation:animGroup forKey:nil];
     [CATransaction commit];
@@ -186,15 +269,11 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
     updatedOpacity = 1;
   }
 
-  CABasicAnimation *changeAnim = [[CABasicAnimation alloc] init];
-  changeAnim.keyPath = MDCInkLayerOpacityString;
+  CABasicAnimation *changeAnim = FadeAnimation();
   changeAnim.fromValue = @(currOpacity);
   changeAnim.toValue = @(updatedOpacity);
   changeAnim.duration = MDCInkLayerCommonDuration;
   changeAnim.beginTime = [self convertTime:(CACurrentMediaTime() + animationDelay) fromLayer:nil];
-  changeAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  changeAnim.fillMode = kCAFillModeForwards;
-  changeAnim.removedOnCompletion = NO;
   [self addAnimation:changeAnim forKey:nil];
 }
 
@@ -221,18 +300,19 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
     [self removeFromSuperlayer];
   } else {
     [CATransaction begin];
-    CABasicAnimation *fadeOutAnim = [[CABasicAnimation alloc] init];
-    fadeOutAnim.keyPath = MDCInkLayerOpacityString;
+    CABasicAnimation *fadeOutAnim = FadeAnimation();
     fadeOutAnim.fromValue = @(opacity);
     fadeOutAnim.toValue = @0;
     fadeOutAnim.duration = MDCInkLayerEndFadeOutDuration;
     fadeOutAnim.beginTime = [self convertTime:(CACurrentMediaTime() + self.endAnimationDelay)
                                     fromLayer:nil];
-    fadeOutAnim.timingFunction =
-        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-    fadeOutAnim.fillMode = kCAFillModeForwards;
-    fadeOutAnim.removedOnCompletion = NO;
+    NSUInteger generation = _inkGeneration;
     [CATransaction setCompletionBlock:^{
+      // Once the layer has been reused, the delegate must not take this for the end of the
+      // current ink ripple.
+      if (self->_inkGeneration != generation) {
+        return;
+      }
       if ([self.animationDelegate respondsToSelector:@selector(inkLayerAnimationDidEnd:)]) {
         [self.animationDelegate inkLayerAnimationDidEnd:self];
       }
@@ -243,4 +323,11 @@ static NSString *const MDCInkLayerScaleString = @"transform.scale";
   }
 }
 
+- (void)prepareForReuse {
+  _inkGeneration += 1;
+  [self removeAllAnimations];
+  _startAnimationActive = NO;
+  _endAnimationDelay = 0;
+}
+
 @end
@@ -0,0 +1,25 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCInkView.h"
+
+@interface MDCInkView ()
+
+/** The number of ink ripples that reused an idle ink layer of the view. */
+@property(nonatomic, assign, readonly) NSUInteger inkLayerPoolHitCount;
+
+/** The number of ink layers the view has created. */
+@property(nonatomic, assign, readonly) NSUInteger createdInkLayerCount;
+
+@end
@@ -14,6 +14,7 @@
 
 #import <XCTest/XCTest.h>
 
+#import "MDCInkView+Private.h"
 #import "MaterialInk.h"
 
 #pragma mark - Tests
@@ -163,4 +164,65 @@
   XCTAssertFalse(masksToBoundsWhenUnbounded);
 }
 
+- (void)testInkReusesIdleInkLayer {
+  // Given
+  MDCInkView *inkView = [[MDCInkView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  inkView.usesLegacyInkRipple = NO;
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+  CALayer *firstInkLayer = inkView.layer.sublayers.lastObject;
+  [inkView cancelAllAnimationsAnimated:NO];
+
+  // When
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+
+  // Then
+  XCTAssertEqual(inkView.layer.sublayers.lastObject, firstInkLayer);
+  XCTAssertEqual(inkView.createdInkLayerCount, 1U);
+  XCTAssertEqual(inkView.inkLayerPoolHitCount, 1U);
+}
+
+- (void)testCancelledInkDoesNotEndTheInkThatReusesItsLayer {
+  // Given
+  MDCInkView *inkView = [[MDCInkView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  inkView.usesLegacyInkRipple = NO;
+  __block NSUInteger endCompletionCount = 0;
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+  [inkView startTouchEndAtPoint:CGPointZero
+                       animated:YES
+                 withCompletion:^{
+                   endCompletionCount += 1;
+                 }];
+  [inkView cancelAllAnimationsAnimated:NO];
+
+  // When
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+  CALayer *inkLayer = inkView.layer.sublayers.lastObject;
+  // Give the cancelled ink's fade out time to complete.
+  XCTestExpectation *expectation = [self expectationWithDescription:@"fade out completed"];
+  dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.5 * NSEC_PER_SEC)),
+                 dispatch_get_main_queue(), ^{
+                   [expectation fulfill];
+                 });
+  [self waitForExpectationsWithTimeout:3 handler:nil];
+
+  // Then
+  XCTAssertEqual(inkView.inkLayerPoolHitCount, 1U);
+  XCTAssertEqual(endCompletionCount, 0U);
+  XCTAssertEqual(inkLayer.superlayer, inkView.layer);
+}
+
+- (void)testOverlappingInkUsesDifferentInkLayers {
+  // Given
+  MDCInkView *inkView = [[MDCInkView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  inkView.usesLegacyInkRipple = NO;
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+
+  // When
+  [inkView startTouchBeganAtPoint:CGPointZero animated:NO withCompletion:nil];
+
+  // Then
+  XCTAssertEqual(inkView.createdInkLayerCount, 2U);
+  XCTAssertEqual(inkView.inkLayerPoolHitCount, 0U);
+}
+
 @end
@@ -13,6 +13,9 @@
 // limitations under the License.
 
 #import "MDCPalettes.h"
+
+#import <os/lock.h>
+
 #import "private/MDCPaletteExpansions.h"
 #import "private/MDCPaletteNames.h"
 
@@ -32,6 +35,10 @@ const MDCPaletteAccent MDCPaletteAccent200Name = MDC_PALETTE_ACCENT_200_INTERNAL
 const MDCPaletteAccent MDCPaletteAccent400Name = MDC_PALETTE_ACCENT_400_INTERNAL_NAME;
 const MDCPaletteAccent MDCPaletteAccent700Name = MDC_PALETTE_ACCENT_700_INTERNAL_NAME;
 
+// Packs a 24-bit RGB color encoded as an integer into an opaque RGBA value. Zero marks an absent
+// color.
+#define RGBA(rgbValue) ((uint32_t)(rgbValue) << 8 | 0xFF)
+
 // Creates a UIColor from a 24-bit RGB color encoded as an integer.
 static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   return [UIColor colorWithRed:((CGFloat)((rgbValue & 0xFF0000) >> 16)) / 255
@@ -40,9 +47,168 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
                          alpha:1];
 }
 
+/** The Material palettes, in the order of kMaterialPaletteColors. */
+typedef NS_ENUM(NSInteger, MaterialPalette) {
+  MaterialPaletteRed,
+  MaterialPalettePink,
+  MaterialPalettePurple,
+  MaterialPaletteDeepPurple,
+  MaterialPaletteIndigo,
+  MaterialPaletteBlue,
+  MaterialPaletteLightBlue,
+  MaterialPaletteCyan,
+  MaterialPaletteTeal,
+  MaterialPaletteGreen,
+  MaterialPaletteLightGreen,
+  MaterialPaletteLime,
+  MaterialPaletteYellow,
+  MaterialPaletteAmber,
+  MaterialPaletteOrange,
+  MaterialPaletteDeepOrange,
+  MaterialPaletteBrown,
+  MaterialPaletteGrey,
+  MaterialPaletteBlueGrey,
+  MaterialPaletteCount,
+};
+
+/** The packed colors of the Material palettes, indexed by kQTMColor*Index. */
+static const uint32_t kMaterialPaletteColors[MaterialPaletteCount][kQTMColorCount] = {
+    [MaterialPaletteRed] =
+        {
+            RGBA(0xFFEBEE), RGBA(0xFFCDD2), RGBA(0xEF9A9A), RGBA(0xE57373), RGBA(0xEF5350),
+            RGBA(0xF44336), RGBA(0xE53935), RGBA(0xD32F2F), RGBA(0xC62828), RGBA(0xB71C1C),
+            RGBA(0xFF8A80), RGBA(0xFF5252), RGBA(0xFF1744), RGBA(0xD50000),
+        },
+    [MaterialPalettePink] =
+        {
+            RGBA(0xFCE4EC), RGBA(0xF8BBD0), RGBA(0xF48FB1), RGBA(0xF06292), RGBA(0xEC407A),
+            RGBA(0xE91E63), RGBA(0xD81B60), RGBA(0xC2185B), RGBA(0xAD1457), RGBA(0x880E4F),
+            RGBA(0xFF80AB), RGBA(0xFF4081), RGBA(0xF50057), RGBA(0xC51162),
+        },
+    [MaterialPalettePurple] =
+        {
+            RGBA(0xF3E5F5), RGBA(0xE1BEE7), RGBA(0xCE93D8), RGBA(0xBA68C8), RGBA(0xAB47BC),
+            RGBA(0x9C27B0), RGBA(0x8E24AA), RGBA(0x7B1FA2), RGBA(0x6A1B9A), RGBA(0x4A148C),
+            RGBA(0xEA80FC), RGBA(0xE040FB), RGBA(0xD500F9), RGBA(0xAA00FF),
+        },
+    [MaterialPaletteDeepPurple] =
+        {
+            RGBA(0xEDE7F6), RGBA(0xD1C4E9), RGBA(0xB39DDB), RGBA(0x9575CD), RGBA(0x7E57C2),
+            RGBA(0x673AB7), RGBA(0x5E35B1), RGBA(0x512DA8), RGBA(0x4527A0), RGBA(0x311B92),
+            RGBA(0xB388FF), RGBA(0x7C4DFF), RGBA(0x651FFF), RGBA(0x6200EA),
+        },
+    [MaterialPaletteIndigo] =
+        {
+            RGBA(0xE8EAF6), RGBA(0xC5CAE9), RGBA(0x9FA8DA), RGBA(0x7986CB), RGBA(0x5C6BC0),
+            RGBA(0x3F51B5), RGBA(0x3949AB), RGBA(0x303F9F), RGBA(0x283593), RGBA(0x1A237E),
+            RGBA(0x8C9EFF), RGBA(0x536DFE), RGBA(0x3D5AFE), RGBA(0x304FFE),
+        },
+    [MaterialPaletteBlue] =
+        {
+            RGBA(0xE3F2FD), RGBA(0xBBDEFB), RGBA(0x90CAF9), RGBA(0x64B5F6), RGBA(0x42A5F5),
+            RGBA(0x2196F3), RGBA(0x1E88E5), RGBA(0x1976D2), RGBA(0x1565C0), RGBA(0x0D47A1),
+            RGBA(0x82B1FF), RGBA(0x448AFF), RGBA(0x2979FF), RGBA(0x2962FF),
+        },
+    [MaterialPaletteLightBlue] =
+        {
+            RGBA(0xE1F5FE), RGBA(0xB3E5FC), RGBA(0x81D4FA), RGBA(0x4FC3F7), RGBA(0x29B6F6),
+            RGBA(0x03A9F4), RGBA(0x039BE5), RGBA(0x0288D1), RGBA(0x0277BD), RGBA(0x01579B),
+            RGBA(0x80D8FF), RGBA(0x40C4FF), RGBA(0x00B0FF), RGBA(0x0091EA),
+        },
+    [MaterialPaletteCyan] =
+        {
+            RGBA(0xE0F7FA), RGBA(0xB2EBF2), RGBA(0x80DEEA), RGBA(0x4DD0E1), RGBA(0x26C6DA),
+            RGBA(0x00BCD4), RGBA(0x00ACC1), RGBA(0x0097A7), RGBA(0x00838F), RGBA(0x006064),
+            RGBA(0x84FFFF), RGBA(0x18FFFF), RGBA(0x00E5FF), RGBA(0x00B8D4),
+        },
+    [MaterialPaletteTeal] =
+        {
+            RGBA(0xE0F2F1), RGBA(0xB2DFDB), RGBA(0x80CBC4), RGBA(0x4DB6AC), RGBA(0x26A69A),
+            RGBA(0x009688), RGBA(0x00897B), RGBA(0x00796B), RGBA(0x00695C), RGBA(0x004D40),
+            RGBA(0xA7FFEB), RGBA(0x64FFDA), RGBA(0x1DE9B6), RGBA(0x00BFA5),
+        },
+    [MaterialPaletteGreen] =
+        {
+            RGBA(0xE8F5E9), RGBA(0xC8E6C9), RGBA(0xA5D6A7), RGBA(0x81C784), RGBA(0x66BB6A),
+            RGBA(0x4CAF50), RGBA(0x43A047), RGBA(0x388E3C), RGBA(0x2E7D32), RGBA(0x1B5E20),
+            RGBA(0xB9F6CA), RGBA(0x69F0AE), RGBA(0x00E676), RGBA(0x00C853),
+        },
+    [MaterialPaletteLightGreen] =
+        {
+            RGBA(0xF1F8E9), RGBA(0xDCEDC8), RGBA(0xC5E1A5), RGBA(0xAED581), RGBA(0x9CCC65),
+            RGBA(0x8BC34A), RGBA(0x7CB342), RGBA(0x689F38), RGBA(0x558B2F), RGBA(0x33691E),
+            RGBA(0xCCFF90), RGBA(0xB2FF59), RGBA(0x76FF03), RGBA(0x64DD17),
+        },
+    [MaterialPaletteLime] =
+        {
+            RGBA(0xF9FBE7), RGBA(0xF0F4C3), RGBA(0xE6EE9C), RGBA(0xDCE775), RGBA(0xD4E157),
+            RGBA(0xCDDC39), RGBA(0xC0CA33), RGBA(0xAFB42B), RGBA(0x9E9D24), RGBA(0x827717),
+            RGBA(0xF4FF81), RGBA(0xEEFF41), RGBA(0xC6FF00), RGBA(0xAEEA00),
+        },
+    [MaterialPaletteYellow] =
+        {
+            RGBA(0xFFFDE7), RGBA(0xFFF9C4), RGBA(0xFFF59D), RGBA(0xFFF176), RGBA(0xFFEE58),
+            RGBA(0xFFEB3B), RGBA(0xFDD835), RGBA(0xFBC02D), RGBA(0xF9A825), RGBA(0xF57F17),
+            RGBA(0xFFFF8D), RGBA(0xFFFF00), RGBA(0xFFEA00), RGBA(0xFFD600),
+        },
+    [MaterialPaletteAmber] =
+        {
+            RGBA(0xFFF8E1), RGBA(0xFFECB3), RGBA(0xFFE082), RGBA(0xFFD54F), RGBA(0xFFCA28),
+            RGBA(0xFFC107), RGBA(0xFFB300), RGBA(0xFFA000), RGBA(0xFF8F00), RGBA(0xFF6F00),
+            RGBA(0xFFE57F), RGBA(0xFFD740), RGBA(0xFFC400), RGBA(0xFFAB00),
+        },
+    [MaterialPaletteOrange] =
+        {
+            RGBA(0xFFF3E0), RGBA(0xFFE0B2), RGBA(0xFFCC80), RGBA(0xFFB74D), RGBA(0xFFA726),
+            RGBA(0xFF9800), RGBA(0xFB8C00), RGBA(0xF57C00), RGBA(0xEF6C00), RGBA(0xE65100),
+            RGBA(0xFFD180), RGBA(0xFFAB40), RGBA(0xFF9100), RGBA(0xFF6D00),
+        },
+    [MaterialPaletteDeepOrange] =
+        {
+            RGBA(0xFBE9E7), RGBA(0xFFCCBC), RGBA(0xFFAB91), RGBA(0xFF8A65), RGBA(0xFF7043),
+            RGBA(0xFF5722), RGBA(0xF4511E), RGBA(0xE64A19), RGBA(0xD84315), RGBA(0xBF360C),
+            RGBA(0xFF9E80), RGBA(0xFF6E40), RGBA(0xFF3D00), RGBA(0xDD2C00),
+        },
+    [MaterialPaletteBrown] =
+        {
+            RGBA(0xEFEBE9), RGBA(0xD7CCC8), RGBA(0xBCAAA4), RGBA(0xA1887F), RGBA(0x8D6E63),
+            RGBA(0x795548), RGBA(0x6D4C41), RGBA(0x5D4037), RGBA(0x4E342E), RGBA(0x3E2723),
+            0, 0, 0, 0,
+        },
+    [MaterialPaletteGrey] =
+        {
+            RGBA(0xFAFAFA), RGBA(0xF5F5F5), RGBA(0xEEEEEE), RGBA(0xE0E0E0), RGBA(0xBDBDBD),
+            RGBA(0x9E9E9E), RGBA(0x757575), RGBA(0x616161), RGBA(0x424242), RGBA(0x212121),
+            0, 0, 0, 0,
+        },
+    [MaterialPaletteBlueGrey] =
+        {
+            RGBA(0xECEFF1), RGBA(0xCFD8DC), RGBA(0xB0BEC5), RGBA(0x90A4AE), RGBA(0x78909C),
+            RGBA(0x607D8B), RGBA(0x546E7A), RGBA(0x455A64), RGBA(0x37474F), RGBA(0x263238),
+            0, 0, 0, 0,
+        },
+};
+
+/** The names of the tints and accents, indexed by kQTMColor*Index. */
+static NSString *const kColorNames[kQTMColorCount] = {
+    MDC_PALETTE_TINT_50_INTERNAL_NAME,    MDC_PALETTE_TINT_100_INTERNAL_NAME,
+    MDC_PALETTE_TINT_200_INTERNAL_NAME,   MDC_PALETTE_TINT_300_INTERNAL_NAME,
+    MDC_PALETTE_TINT_400_INTERNAL_NAME,   MDC_PALETTE_TINT_500_INTERNAL_NAME,
+    MDC_PALETTE_TINT_600_INTERNAL_NAME,   MDC_PALETTE_TINT_700_INTERNAL_NAME,
+    MDC_PALETTE_TINT_800_INTERNAL_NAME,   MDC_PALETTE_TINT_900_INTERNAL_NAME,
+    MDC_PALETTE_ACCENT_100_INTERNAL_NAME, MDC_PALETTE_ACCENT_200_INTERNAL_NAME,
+    MDC_PALETTE_ACCENT_400_INTERNAL_NAME, MDC_PALETTE_ACCENT_700_INTERNAL_NAME,
+};
+
 @interface MDCPalette () {
-  NSDictionary<MDCPaletteTint, UIColor *> *_tints;
-  NSDictionary<MDCPaletteAccent, UIColor *> *_accents;
+  // The colors of the palette, indexed by kQTMColor*Index. The slots of a Material palette are
+  // filled on first access under _colorsLock; the slots of any other palette are set in init.
+  UIColor *_colors[kQTMColorCount];
+
+  // The packed colors of a Material palette, whose UIColors are created on first access, or NULL.
+  const uint32_t *_packedColors;
+
+  os_unfair_lock _colorsLock;
 }
 
 @end
@@ -53,24 +219,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFEBEE),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFCDD2),
-      MDCPaletteTint200Name : ColorFromRGB(0xEF9A9A),
-      MDCPaletteTint300Name : ColorFromRGB(0xE57373),
-      MDCPaletteTint400Name : ColorFromRGB(0xEF5350),
-      MDCPaletteTint500Name : ColorFromRGB(0xF44336),
-      MDCPaletteTint600Name : ColorFromRGB(0xE53935),
-      MDCPaletteTint700Name : ColorFromRGB(0xD32F2F),
-      MDCPaletteTint800Name : ColorFromRGB(0xC62828),
-      MDCPaletteTint900Name : ColorFromRGB(0xB71C1C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF8A80),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF5252),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF1744),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xD50000)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteRed];
   });
   return palette;
 }
@@ -79,24 +228,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFCE4EC),
-      MDCPaletteTint100Name : ColorFromRGB(0xF8BBD0),
-      MDCPaletteTint200Name : ColorFromRGB(0xF48FB1),
-      MDCPaletteTint300Name : ColorFromRGB(0xF06292),
-      MDCPaletteTint400Name : ColorFromRGB(0xEC407A),
-      MDCPaletteTint500Name : ColorFromRGB(0xE91E63),
-      MDCPaletteTint600Name : ColorFromRGB(0xD81B60),
-      MDCPaletteTint700Name : ColorFromRGB(0xC2185B),
-      MDCPaletteTint800Name : ColorFromRGB(0xAD1457),
-      MDCPaletteTint900Name : ColorFromRGB(0x880E4F)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF80AB),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF4081),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xF50057),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xC51162)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPalettePink];
   });
   return palette;
 }
@@ -105,24 +237,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF3E5F5),
-      MDCPaletteTint100Name : ColorFromRGB(0xE1BEE7),
-      MDCPaletteTint200Name : ColorFromRGB(0xCE93D8),
-      MDCPaletteTint300Name : ColorFromRGB(0xBA68C8),
-      MDCPaletteTint400Name : ColorFromRGB(0xAB47BC),
-      MDCPaletteTint500Name : ColorFromRGB(0x9C27B0),
-      MDCPaletteTint600Name : ColorFromRGB(0x8E24AA),
-      MDCPaletteTint700Name : ColorFromRGB(0x7B1FA2),
-      MDCPaletteTint800Name : ColorFromRGB(0x6A1B9A),
-      MDCPaletteTint900Name : ColorFromRGB(0x4A148C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xEA80FC),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xE040FB),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xD500F9),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xAA00FF)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPalettePurple];
   });
   return palette;
 }
@@ -131,24 +246,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xEDE7F6),
-      MDCPaletteTint100Name : ColorFromRGB(0xD1C4E9),
-      MDCPaletteTint200Name : ColorFromRGB(0xB39DDB),
-      MDCPaletteTint300Name : ColorFromRGB(0x9575CD),
-      MDCPaletteTint400Name : ColorFromRGB(0x7E57C2),
-      MDCPaletteTint500Name : ColorFromRGB(0x673AB7),
-      MDCPaletteTint600Name : ColorFromRGB(0x5E35B1),
-      MDCPaletteTint700Name : ColorFromRGB(0x512DA8),
-      MDCPaletteTint800Name : ColorFromRGB(0x4527A0),
-      MDCPaletteTint900Name : ColorFromRGB(0x311B92)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xB388FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x7C4DFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x651FFF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x6200EA)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteDeepPurple];
   });
   return palette;
 }
@@ -157,24 +255,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE8EAF6),
-      MDCPaletteTint100Name : ColorFromRGB(0xC5CAE9),
-      MDCPaletteTint200Name : ColorFromRGB(0x9FA8DA),
-      MDCPaletteTint300Name : ColorFromRGB(0x7986CB),
-      MDCPaletteTint400Name : ColorFromRGB(0x5C6BC0),
-      MDCPaletteTint500Name : ColorFromRGB(0x3F51B5),
-      MDCPaletteTint600Name : ColorFromRGB(0x3949AB),
-      MDCPaletteTint700Name : ColorFromRGB(0x303F9F),
-      MDCPaletteTint800Name : ColorFromRGB(0x283593),
-      MDCPaletteTint900Name : ColorFromRGB(0x1A237E)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x8C9EFF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x536DFE),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x3D5AFE),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x304FFE)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteIndigo];
   });
   return palette;
 }
@@ -183,24 +264,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE3F2FD),
-      MDCPaletteTint100Name : ColorFromRGB(0xBBDEFB),
-      MDCPaletteTint200Name : ColorFromRGB(0x90CAF9),
-      MDCPaletteTint300Name : ColorFromRGB(0x64B5F6),
-      MDCPaletteTint400Name : ColorFromRGB(0x42A5F5),
-      MDCPaletteTint500Name : ColorFromRGB(0x2196F3),
-      MDCPaletteTint600Name : ColorFromRGB(0x1E88E5),
-      MDCPaletteTint700Name : ColorFromRGB(0x1976D2),
-      MDCPaletteTint800Name : ColorFromRGB(0x1565C0),
-      MDCPaletteTint900Name : ColorFromRGB(0x0D47A1)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x82B1FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x448AFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x2979FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x2962FF)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteBlue];
   });
   return palette;
 }
@@ -209,24 +273,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE1F5FE),
-      MDCPaletteTint100Name : ColorFromRGB(0xB3E5FC),
-      MDCPaletteTint200Name : ColorFromRGB(0x81D4FA),
-      MDCPaletteTint300Name : ColorFromRGB(0x4FC3F7),
-      MDCPaletteTint400Name : ColorFromRGB(0x29B6F6),
-      MDCPaletteTint500Name : ColorFromRGB(0x03A9F4),
-      MDCPaletteTint600Name : ColorFromRGB(0x039BE5),
-      MDCPaletteTint700Name : ColorFromRGB(0x0288D1),
-      MDCPaletteTint800Name : ColorFromRGB(0x0277BD),
-      MDCPaletteTint900Name : ColorFromRGB(0x01579B)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x80D8FF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x40C4FF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00B0FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x0091EA)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteLightBlue];
   });
   return palette;
 }
@@ -235,24 +282,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE0F7FA),
-      MDCPaletteTint100Name : ColorFromRGB(0xB2EBF2),
-      MDCPaletteTint200Name : ColorFromRGB(0x80DEEA),
-      MDCPaletteTint300Name : ColorFromRGB(0x4DD0E1),
-      MDCPaletteTint400Name : ColorFromRGB(0x26C6DA),
-      MDCPaletteTint500Name : ColorFromRGB(0x00BCD4),
-      MDCPaletteTint600Name : ColorFromRGB(0x00ACC1),
-      MDCPaletteTint700Name : ColorFromRGB(0x0097A7),
-      MDCPaletteTint800Name : ColorFromRGB(0x00838F),
-      MDCPaletteTint900Name : ColorFromRGB(0x006064)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0x84FFFF),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x18FFFF),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00E5FF),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00B8D4)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteCyan];
   });
   return palette;
 }
@@ -261,24 +291,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE0F2F1),
-      MDCPaletteTint100Name : ColorFromRGB(0xB2DFDB),
-      MDCPaletteTint200Name : ColorFromRGB(0x80CBC4),
-      MDCPaletteTint300Name : ColorFromRGB(0x4DB6AC),
-      MDCPaletteTint400Name : ColorFromRGB(0x26A69A),
-      MDCPaletteTint500Name : ColorFromRGB(0x009688),
-      MDCPaletteTint600Name : ColorFromRGB(0x00897B),
-      MDCPaletteTint700Name : ColorFromRGB(0x00796B),
-      MDCPaletteTint800Name : ColorFromRGB(0x00695C),
-      MDCPaletteTint900Name : ColorFromRGB(0x004D40)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xA7FFEB),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x64FFDA),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x1DE9B6),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00BFA5)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteTeal];
   });
   return palette;
 }
@@ -287,24 +300,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xE8F5E9),
-      MDCPaletteTint100Name : ColorFromRGB(0xC8E6C9),
-      MDCPaletteTint200Name : ColorFromRGB(0xA5D6A7),
-      MDCPaletteTint300Name : ColorFromRGB(0x81C784),
-      MDCPaletteTint400Name : ColorFromRGB(0x66BB6A),
-      MDCPaletteTint500Name : ColorFromRGB(0x4CAF50),
-      MDCPaletteTint600Name : ColorFromRGB(0x43A047),
-      MDCPaletteTint700Name : ColorFromRGB(0x388E3C),
-      MDCPaletteTint800Name : ColorFromRGB(0x2E7D32),
-      MDCPaletteTint900Name : ColorFromRGB(0x1B5E20)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xB9F6CA),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0x69F0AE),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x00E676),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x00C853)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteGreen];
   });
   return palette;
 }
@@ -313,24 +309,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF1F8E9),
-      MDCPaletteTint100Name : ColorFromRGB(0xDCEDC8),
-      MDCPaletteTint200Name : ColorFromRGB(0xC5E1A5),
-      MDCPaletteTint300Name : ColorFromRGB(0xAED581),
-      MDCPaletteTint400Name : ColorFromRGB(0x9CCC65),
-      MDCPaletteTint500Name : ColorFromRGB(0x8BC34A),
-      MDCPaletteTint600Name : ColorFromRGB(0x7CB342),
-      MDCPaletteTint700Name : ColorFromRGB(0x689F38),
-      MDCPaletteTint800Name : ColorFromRGB(0x558B2F),
-      MDCPaletteTint900Name : ColorFromRGB(0x33691E)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xCCFF90),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xB2FF59),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0x76FF03),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0x64DD17)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteLightGreen];
   });
   return palette;
 }
@@ -339,24 +318,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xF9FBE7),
-      MDCPaletteTint100Name : ColorFromRGB(0xF0F4C3),
-      MDCPaletteTint200Name : ColorFromRGB(0xE6EE9C),
-      MDCPaletteTint300Name : ColorFromRGB(0xDCE775),
-      MDCPaletteTint400Name : ColorFromRGB(0xD4E157),
-      MDCPaletteTint500Name : ColorFromRGB(0xCDDC39),
-      MDCPaletteTint600Name : ColorFromRGB(0xC0CA33),
-      MDCPaletteTint700Name : ColorFromRGB(0xAFB42B),
-      MDCPaletteTint800Name : ColorFromRGB(0x9E9D24),
-      MDCPaletteTint900Name : ColorFromRGB(0x827717)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xF4FF81),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xEEFF41),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xC6FF00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xAEEA00)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteLime];
   });
   return palette;
 }
@@ -365,24 +327,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFFDE7),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFF9C4),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFF59D),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFF176),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFEE58),
-      MDCPaletteTint500Name : ColorFromRGB(0xFFEB3B),
-      MDCPaletteTint600Name : ColorFromRGB(0xFDD835),
-      MDCPaletteTint700Name : ColorFromRGB(0xFBC02D),
-      MDCPaletteTint800Name : ColorFromRGB(0xF9A825),
-      MDCPaletteTint900Name : ColorFromRGB(0xF57F17)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFFF8D),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFFF00),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFFEA00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFFD600)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteYellow];
   });
   return palette;
 }
@@ -391,24 +336,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFF8E1),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFECB3),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFE082),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFD54F),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFCA28),
-      MDCPaletteTint500Name : ColorFromRGB(0xFFC107),
-      MDCPaletteTint600Name : ColorFromRGB(0xFFB300),
-      MDCPaletteTint700Name : ColorFromRGB(0xFFA000),
-      MDCPaletteTint800Name : ColorFromRGB(0xFF8F00),
-      MDCPaletteTint900Name : ColorFromRGB(0xFF6F00)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFE57F),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFD740),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFFC400),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFFAB00)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteAmber];
   });
   return palette;
 }
@@ -417,24 +345,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFFF3E0),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFE0B2),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFCC80),
-      MDCPaletteTint300Name : ColorFromRGB(0xFFB74D),
-      MDCPaletteTint400Name : ColorFromRGB(0xFFA726),
-      MDCPaletteTint500Name : ColorFromRGB(0xFF9800),
-      MDCPaletteTint600Name : ColorFromRGB(0xFB8C00),
-      MDCPaletteTint700Name : ColorFromRGB(0xF57C00),
-      MDCPaletteTint800Name : ColorFromRGB(0xEF6C00),
-      MDCPaletteTint900Name : ColorFromRGB(0xE65100)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFFD180),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFFAB40),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF9100),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xFF6D00)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteOrange];
   });
   return palette;
 }
@@ -443,24 +354,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFBE9E7),
-      MDCPaletteTint100Name : ColorFromRGB(0xFFCCBC),
-      MDCPaletteTint200Name : ColorFromRGB(0xFFAB91),
-      MDCPaletteTint300Name : ColorFromRGB(0xFF8A65),
-      MDCPaletteTint400Name : ColorFromRGB(0xFF7043),
-      MDCPaletteTint500Name : ColorFromRGB(0xFF5722),
-      MDCPaletteTint600Name : ColorFromRGB(0xF4511E),
-      MDCPaletteTint700Name : ColorFromRGB(0xE64A19),
-      MDCPaletteTint800Name : ColorFromRGB(0xD84315),
-      MDCPaletteTint900Name : ColorFromRGB(0xBF360C)
-    }
-                                  accents:@{
-                                    MDCPaletteAccent100Name : ColorFromRGB(0xFF9E80),
-                                    MDCPaletteAccent200Name : ColorFromRGB(0xFF6E40),
-                                    MDCPaletteAccent400Name : ColorFromRGB(0xFF3D00),
-                                    MDCPaletteAccent700Name : ColorFromRGB(0xDD2C00)
-                                  }];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteDeepOrange];
   });
   return palette;
 }
@@ -469,19 +363,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xEFEBE9),
-      MDCPaletteTint100Name : ColorFromRGB(0xD7CCC8),
-      MDCPaletteTint200Name : ColorFromRGB(0xBCAAA4),
-      MDCPaletteTint300Name : ColorFromRGB(0xA1887F),
-      MDCPaletteTint400Name : ColorFromRGB(0x8D6E63),
-      MDCPaletteTint500Name : ColorFromRGB(0x795548),
-      MDCPaletteTint600Name : ColorFromRGB(0x6D4C41),
-      MDCPaletteTint700Name : ColorFromRGB(0x5D4037),
-      MDCPaletteTint800Name : ColorFromRGB(0x4E342E),
-      MDCPaletteTint900Name : ColorFromRGB(0x3E2723)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteBrown];
   });
   return palette;
 }
@@ -490,19 +372,7 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xFAFAFA),
-      MDCPaletteTint100Name : ColorFromRGB(0xF5F5F5),
-      MDCPaletteTint200Name : ColorFromRGB(0xEEEEEE),
-      MDCPaletteTint300Name : ColorFromRGB(0xE0E0E0),
-      MDCPaletteTint400Name : ColorFromRGB(0xBDBDBD),
-      MDCPaletteTint500Name : ColorFromRGB(0x9E9E9E),
-      MDCPaletteTint600Name : ColorFromRGB(0x757575),
-      MDCPaletteTint700Name : ColorFromRGB(0x616161),
-      MDCPaletteTint800Name : ColorFromRGB(0x424242),
-      MDCPaletteTint900Name : ColorFromRGB(0x212121)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteGrey];
   });
   return palette;
 }
@@ -511,43 +381,24 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
   static MDCPalette *palette;
   static dispatch_once_t onceToken;
   dispatch_once(&onceToken, ^{
-    palette = [[self alloc] initWithTints:@{
-      MDCPaletteTint50Name : ColorFromRGB(0xECEFF1),
-      MDCPaletteTint100Name : ColorFromRGB(0xCFD8DC),
-      MDCPaletteTint200Name : ColorFromRGB(0xB0BEC5),
-      MDCPaletteTint300Name : ColorFromRGB(0x90A4AE),
-      MDCPaletteTint400Name : ColorFromRGB(0x78909C),
-      MDCPaletteTint500Name : ColorFromRGB(0x607D8B),
-      MDCPaletteTint600Name : ColorFromRGB(0x546E7A),
-      MDCPaletteTint700Name : ColorFromRGB(0x455A64),
-      MDCPaletteTint800Name : ColorFromRGB(0x37474F),
-      MDCPaletteTint900Name : ColorFromRGB(0x263238)
-    }
-                                  accents:nil];
+    palette = [[self alloc] initWithMaterialPalette:MaterialPaletteBlueGrey];
   });
   return palette;
 }
 
 + (instancetype)paletteGeneratedFromColor:(nonnull UIColor *)target500Color {
-  NSArray *tintNames = @[
-    MDCPaletteTint50Name, MDCPaletteTint100Name, MDCPaletteTint200Name, MDCPaletteTint300Name,
-    MDCPaletteTint400Name, MDCPaletteTint500Name, MDCPaletteTint600Name, MDCPaletteTint700Name,
-    MDCPaletteTint800Name, MDCPaletteTint900Name, MDCPaletteAccent100Name, MDCPaletteAccent200Name,
-    MDCPaletteAccent400Name, MDCPaletteAccent700Name
-  ];
+  MDCPaletteHSB seed = MDCPaletteHSBFromColor(target500Color);
+  MDCPaletteHSB colors[kQTMColorCount];
+  MDCPaletteGenerateHSB(&seed, 1, colors);
 
   NSMutableDictionary *tints = [[NSMutableDictionary alloc] init];
-  for (MDCPaletteTint name in tintNames) {
-    [tints setObject:MDCPaletteTintFromTargetColor(target500Color, name) forKey:name];
+  for (int i = kQTMColorTint50Index; i <= kQTMColorTint900Index; ++i) {
+    [tints setObject:MDCPaletteColorFromHSB(colors[i]) forKey:kColorNames[i]];
   }
 
-  NSArray *accentNames = @[
-    MDCPaletteAccent100Name, MDCPaletteAccent200Name, MDCPaletteAccent400Name,
-    MDCPaletteAccent700Name
-  ];
   NSMutableDictionary *accents = [[NSMutableDictionary alloc] init];
-  for (MDCPaletteAccent name in accentNames) {
-    [accents setObject:MDCPaletteAccentFromTargetColor(target500Color, name) forKey:name];
+  for (int i = kQTMColorAccent100Index; i <= kQTMColorAccent700Index; ++i) {
+    [accents setObject:MDCPaletteColorFromHSB(colors[i]) forKey:kColorNames[i]];
   }
 
   return [self paletteWithTints:tints accents:accents];
@@ -562,7 +413,9 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
                       accents:(NSDictionary<MDCPaletteAccent, UIColor *> *)accents {
   self = [super init];
   if (self) {
-    _accents = accents ? [accents copy] : @{};
+    if (!accents) {
+      accents = @{};
+    }
 
     // Check if all the accent colors are present.
     NSDictionary<MDCPaletteTint, UIColor *> *allTints = tints;
@@ -572,76 +425,107 @@ static inline UIColor *ColorFromRGB(uint32_t rgbValue) {
     if ([requiredTintKeys count] != 0) {
       NSAssert(NO, @"Missing accent colors for the following keys: %@.", requiredTintKeys);
       NSMutableDictionary<MDCPaletteTint, UIColor *> *replacementTints =
-          [NSMutableDictionary dictionaryWithDictionary:_accents];
+          [NSMutableDictionary dictionaryWithDictionary:accents];
       for (MDCPaletteTint tintKey in requiredTintKeys) {
         [replacementTints setObject:[UIColor clearColor] forKey:tintKey];
       }
       allTints = replacementTints;
     }
 
-    _tints = [allTints copy];
+    for (int i = kQTMColorTint50Index; i <= kQTMColorTint900Index; ++i) {
+      _colors[i] = allTints[kColorNames[i]];
+    }
+    for (int i = kQTMColorAccent100Index; i <= kQTMColorAccent700Index; ++i) {
+      _colors[i] = accents[kColorNames[i]];
+    }
   }
   return self;
 }
 
 - (UIColor *)tint50 {
-  return _tints[MDCPaletteTint50Name];
+  return [self colorAtIndex:kQTMColorTint50Index];
 }
 
 - (UIColor *)tint100 {
-  return _tints[MDCPaletteTint100Name];
+  return [self colorAtIndex:kQTMColorTint100Index];
 }
 
 - (UIColor *)tint200 {
-  return _tints[MDCPaletteTint200Name];
+  return [self colorAtIndex:kQTMColorTint200Index];
 }
 
 - (UIColor *)tint300 {
-  return _tints[MDCPaletteTint300Name];
+  return [self colorAtIndex:kQTMColorTint300Index];
 }
 
 - (UIColor *)tint400 {
-  return _tints[MDCPaletteTint400Name];
+  return [self colorAtIndex:kQTMColorTint400Index];
 }
 
 - (UIColor *)tint500 {
-  return _tints[MDCPaletteTint500Name];
+  return [self colorAtIndex:kQTMColorTint500Index];
 }
 
 - (UIColor *)tint600 {
-  return _tints[MDCPaletteTint600Name];
+  return [self colorAtIndex:kQTMColorTint600Index];
 }
 
 - (UIColor *)tint700 {
-  return _tints[MDCPaletteTint700Name];
+  return [self colorAtIndex:kQTMColorTint700Index];
 }
 
 - (UIColor *)tint800 {
-  return _tints[MDCPaletteTint800Name];
+  return [self colorAtIndex:kQTMColorTint800Index];
 }
 
 - (UIColor *)tint900 {
-  return _tints[MDCPaletteTint900Name];
+  return [self colorAtIndex:kQTMColorTint900Index];
 }
 
 - (UIColor *)accent100 {
-  return _accents[MDCPaletteAccent100Name];
+  return [self colorAtIndex:kQTMColorAccent100Index];
 }
 
 - (UIColor *)accent200 {
-  return _accents[MDCPaletteAccent200Name];
+  return [self colorAtIndex:kQTMColorAccent200Index];
 }
 
 - (UIColor *)accent400 {
-  return _accents[MDCPaletteAccent400Name];
+  return [self colorAtIndex:kQTMColorAccent400Index];
 }
 
 - (UIColor *)accent700 {
-  return _accents[MDCPaletteAccent700Name];
+  return [self colorAtIndex:kQTMColorAccent700Index];
 }
 
 #pragma mark - Private methods
 
+- (instancetype)initWithMaterialPalette:(MaterialPalette)materialPalette {
+  self = [super init];
+  if (self) {
+    _packedColors = kMaterialPaletteColors[materialPalette];
+    _colorsLock = OS_UNFAIR_LOCK_INIT;
+  }
+  return self;
+}
+
+- (UIColor *)colorAtIndex:(int)index {
+  if (!_packedColors) {
+    return _colors[index];
+  }
+
+  // The shared Material palettes may be read from several threads, so both reading and filling a
+  // slot happen under the lock, and the first UIColor created for a slot is returned from then on.
+  os_unfair_lock_lock(&_colorsLock);
+  UIColor *color = _colors[index];
+  if (!color && _packedColors[index]) {
+    color = ColorFromRGB(_packedColors[index] >> 8);
+    _colors[index] = color;
+  }
+  os_unfair_lock_unlock(&_colorsLock);
+  return color;
+}
+
 + (nonnull NSSet<MDCPaletteTint> *)requiredTintKeys {
   return [NSSet setWithArray:@[
     MDCPaletteTint50Name, MDCPaletteTint100Name, MDCPaletteTint200Name, MDCPaletteTint300Name,
@@ -14,8 +14,16 @@
 
 #import <UIKit/UIKit.h>
 
+#import "MDCPaletteGenerator.h"
+
 UIColor* _Nonnull MDCPaletteTintFromTargetColor(UIColor* _Nonnull targetColor,
                                                 NSString* _Nonnull tintName);
 
 UIColor* _Nonnull MDCPaletteAccentFromTargetColor(UIColor* _Nonnull targetColor,
                                                   NSString* _Nonnull accentName);
+
+/** Returns the HSB components of a color, with hue and saturation 0 for greyscale colors. */
+MDCPaletteHSB MDCPaletteHSBFromColor(UIColor* _Nonnull color);
+
+/** Returns an opaque color with the given HSB components. */
+UIColor* _Nonnull MDCPaletteColorFromHSB(MDCPaletteHSB color);
@@ -18,79 +18,6 @@
 
 #import "MDCPaletteNames.h"
 
-// Observed saturation ranges for tints 50, 500, 900.
-static const CGFloat kSaturation50Min = (CGFloat)0.06;
-static const CGFloat kSaturation50Max = (CGFloat)0.12;
-static const CGFloat kSaturation500Min = (CGFloat)0.60;
-static const CGFloat kSaturation500Max = 1;
-static const CGFloat kSaturation900Min = (CGFloat)0.70;
-static const CGFloat kSaturation900Max = 1;
-
-// Minimum value of saturation to consider a color "colorless" (e.g. white/black/grey).
-static const CGFloat kSaturationMinThreshold = 1 / (CGFloat)256;
-
-// A small value for comparing floating point numbers that is appropriate for color components.
-static const CGFloat kComponentEpsilon = (CGFloat)0.5 / 256;
-
-// Observed brightness ranges for tints 50, 500, 900.
-static const CGFloat kBrightness50Min = (CGFloat)0.95;
-static const CGFloat kBrightness50Max = 1;
-static const CGFloat kBrightness500Min = (CGFloat)0.50;
-static const CGFloat kBrightness500Max = 1;
-
-// Observed quadratic brightness coefficients for tints >= 500.
-static const CGFloat kBrightnessQuadracticCoeff = (CGFloat)-0.00642857142857143;
-static const CGFloat kBrightnessLinearCoeff = (CGFloat)-0.03585714285714282;
-
-// Median saturation and brightness values for A100, A200, A400, A700.
-static const CGFloat kAccentSaturation[4] = {(CGFloat)0.49, (CGFloat)0.75, 1, 1};
-static const CGFloat kAccentBrightness[4] = {1, 1, 1, (CGFloat)0.92};
-
-// Ordered indices of each of the tints/accents.
-static const int kQTMColorTint50Index = 0;
-static const int kQTMColorTint100Index = 1;
-static const int kQTMColorTint200Index = 2;
-static const int kQTMColorTint300Index = 3;
-static const int kQTMColorTint400Index = 4;
-static const int kQTMColorTint500Index = 5;
-static const int kQTMColorTint600Index = 6;
-static const int kQTMColorTint700Index = 7;
-static const int kQTMColorTint800Index = 8;
-static const int kQTMColorTint900Index = 9;
-static const int kQTMColorAccent100Index = 10;
-static const int kQTMColorAccent200Index = 11;
-static const int kQTMColorAccent400Index = 12;
-static const int kQTMColorAccent700Index = 13;
-
-/** Returns a value Clamped to the range [min, max]. */
-static inline CGFloat Clamp(CGFloat value, CGFloat min, CGFloat max) {
-  if (value < min) {
-    return min;
-  } else if (value > max) {
-    return max;
-  } else {
-    return value;
-  }
-}
-
-/** Returns the linear interpolation of [min, max] at value. */
-static inline CGFloat Lerp(CGFloat value, CGFloat min, CGFloat max) {
-  return (1 - value) * min + value * max;
-}
-
-/** Returns the value t such that Lerp(t, min, max) == value. */
-static inline CGFloat InvLerp(CGFloat value, CGFloat min, CGFloat max) {
-  return (value - min) / (max - min);
-}
-
-/**
- Returns "component > value", but accounting for floating point mathematics. The component is
- expected to be between [0,255].
- */
-static inline BOOL IsComponentGreaterThanValue(CGFloat component, CGFloat value) {
-  return component + kComponentEpsilon > value;
-}
-
 static void ColorToHSB(UIColor *_Nonnull color, CGFloat hsb[4]) {
   // Pre-iOS 8 would not convert greyscale colors to HSB.
   if (![color getHue:&hsb[0] saturation:&hsb[1] brightness:&hsb[2] alpha:&hsb[3]]) {
@@ -137,68 +64,29 @@ static int NameToIndex(NSString *_Nonnull name) {
   }
 }
 
-UIColor *MDCPaletteTintFromTargetColor(UIColor *targetColor, NSString *tintName) {
-  NSCAssert(MDCPaletteIsTintOrAccentName(tintName), @"Invalid tint/accent name %@.", tintName);
-  int tint = NameToIndex(tintName);
-
+MDCPaletteHSB MDCPaletteHSBFromColor(UIColor *color) {
   CGFloat hsb[4];
-  ColorToHSB(targetColor, hsb);
-
-  // Saturation: select a saturation curve from the input saturation, unless the saturation is so
-  // low to be considered 'colorless', e.g. white/black/grey, in which case skip this step.
-  CGFloat saturation = hsb[1];
-  CGFloat t;
-  if (IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold)) {
-    // Limit saturation to observed values.
-    hsb[1] = Clamp(hsb[1], kSaturation500Min, kSaturation500Max);
-
-    t = InvLerp(hsb[1], kSaturation500Min, kSaturation500Max);
-    if (tint <= kQTMColorTint500Index) {
-      CGFloat saturation50 = Lerp(t, kSaturation50Min, kSaturation50Max);
-      CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
-      saturation = Lerp(u, saturation50, hsb[1]);
-    } else {
-      CGFloat saturation900 = Lerp(t, kSaturation900Min, kSaturation900Max);
-      CGFloat u = InvLerp(tint, kQTMColorTint500Index, kQTMColorTint900Index);
-      saturation = Lerp(u, hsb[1], saturation900);
-    }
-  }
-
-  // Brightness: select a brightness curve from the input brightness.
-  CGFloat brightness;
-
-  // Limit brightness to observed values.
-  hsb[2] = Clamp(hsb[2], kBrightness500Min, kBrightness500Max);
-  t = InvLerp(hsb[2], kBrightness500Min, kBrightness500Max);
-
-  // The tints 50-500 are nice and linear.
-  if (tint <= kQTMColorTint500Index) {
-    CGFloat brightness50 = Lerp(t, kBrightness50Min, kBrightness50Max);
-    CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
-    brightness = Lerp(u, brightness50, hsb[2]);
+  ColorToHSB(color, hsb);
+  return (MDCPaletteHSB){.hue = hsb[0], .saturation = hsb[1], .brightness = hsb[2]};
+}
 
-    // The tints > 500 fall off roughly quadratically.
-  } else {
-    CGFloat u = tint - kQTMColorTint500Index;
-    brightness = hsb[2] + kBrightnessQuadracticCoeff * u * u + kBrightnessLinearCoeff * u;
-  }
+UIColor *MDCPaletteColorFromHSB(MDCPaletteHSB color) {
+  return [UIColor colorWithHue:color.hue
+                    saturation:color.saturation
+                    brightness:color.brightness
+                         alpha:1];
+}
 
-  return [UIColor colorWithHue:hsb[0] saturation:saturation brightness:brightness alpha:1];
+UIColor *MDCPaletteTintFromTargetColor(UIColor *targetColor, NSString *tintName) {
+  NSCAssert(MDCPaletteIsTintOrAccentName(tintName), @"Invalid tint/accent name %@.", tintName);
+  int tint = NameToIndex(tintName);
+  return MDCPaletteColorFromHSB(MDCPaletteTintFromSeed(MDCPaletteHSBFromColor(targetColor), tint));
 }
 
 UIColor *MDCPaletteAccentFromTargetColor(UIColor *targetColor, NSString *accentName) {
   NSCAssert(MDCPaletteIsTintOrAccentName(accentName), @"Invalid tint/accent name %@.", accentName);
   int accent = NameToIndex(accentName);
-
-  CGFloat hsb[4];
-  ColorToHSB(targetColor, hsb);
-
-  int index = accent - kQTMColorAccent100Index;
-  NSCAssert(index >= 0 && index < 4, @"Invalid accent index %i", (int)accent);
-
-  CGFloat saturation = IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold)
-                           ? kAccentSaturation[index]
-                           : hsb[1];
-  CGFloat brightness = kAccentBrightness[index];
-  return [UIColor colorWithHue:hsb[0] saturation:saturation brightness:brightness alpha:1];
+  NSCAssert(accent >= kQTMColorAccent100Index, @"Invalid accent index %i", (int)accent);
+  return MDCPaletteColorFromHSB(
+      MDCPaletteAccentFromSeed(MDCPaletteHSBFromColor(targetColor), accent));
 }
@@ -0,0 +1,89 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+// Ordered indices of each of the tints/accents.
+enum {
+  kQTMColorTint50Index = 0,
+  kQTMColorTint100Index = 1,
+  kQTMColorTint200Index = 2,
+  kQTMColorTint300Index = 3,
+  kQTMColorTint400Index = 4,
+  kQTMColorTint500Index = 5,
+  kQTMColorTint600Index = 6,
+  kQTMColorTint700Index = 7,
+  kQTMColorTint800Index = 8,
+  kQTMColorTint900Index = 9,
+  kQTMColorAccent100Index = 10,
+  kQTMColorAccent200Index = 11,
+  kQTMColorAccent400Index = 12,
+  kQTMColorAccent700Index = 13,
+
+  // The number of tints and accents.
+  kQTMColorCount = 14,
+};
+
+/** An opaque color in the hue, saturation and brightness model, with components in [0, 1]. */
+typedef struct MDCPaletteHSB {
+  CGFloat hue;
+  CGFloat saturation;
+  CGFloat brightness;
+} MDCPaletteHSB;
+
+/**
+ Returns the HSB components of an RGB color, with hue 0 for greys.
+
+ @param red The red component, in [0, 1].
+ @param green The green component, in [0, 1].
+ @param blue The blue component, in [0, 1].
+ */
+FOUNDATION_EXTERN MDCPaletteHSB MDCPaletteHSBFromRGB(CGFloat red, CGFloat green, CGFloat blue);
+
+/** Returns a 24-bit RGB color encoded as an integer, with each component rounded to 8 bits. */
+FOUNDATION_EXTERN uint32_t MDCPaletteRGBFromHSB(MDCPaletteHSB hsb);
+
+/** Returns the tint at @c tint, a kQTMColorTint*Index, of the palette whose 500 tint is @c seed. */
+FOUNDATION_EXTERN MDCPaletteHSB MDCPaletteTintFromSeed(MDCPaletteHSB seed, int tint);
+
+/**
+ Returns the accent at @c accent, a kQTMColorAccent*Index, of the palette whose 500 tint is
+ @c seed.
+ */
+FOUNDATION_EXTERN MDCPaletteHSB MDCPaletteAccentFromSeed(MDCPaletteHSB seed, int accent);
+
+/**
+ Generates the palettes of @c count seeds.
+
+ @param seeds The 500 tints of the palettes.
+ @param count The number of seeds.
+ @param palettes Receives kQTMColorCount colors per seed, ordered by kQTMColor*Index, so the
+                 colors of seed @c i start at @c palettes[i * kQTMColorCount].
+ */
+FOUNDATION_EXTERN void MDCPaletteGenerateHSB(const MDCPaletteHSB *_Nonnull seeds,
+                                             size_t count,
+                                             MDCPaletteHSB *_Nonnull palettes);
+
+/**
+ Generates the palettes of @c count seeds given as 24-bit RGB colors encoded as integers.
+
+ @param seeds The 500 tints of the palettes.
+ @param count The number of seeds.
+ @param palettes Receives kQTMColorCount 24-bit RGB colors per seed, laid out as in
+                 MDCPaletteGenerateHSB.
+ */
+FOUNDATION_EXTERN void MDCPaletteGenerateRGB(const uint32_t *_Nonnull seeds,
+                                             size_t count,
+                                             uint32_t *_Nonnull palettes);
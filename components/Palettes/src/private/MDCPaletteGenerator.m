@@ -0,0 +1,243 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCPaletteGenerator.h"
+
+#include <math.h>
+
+// Observed saturation ranges for tints 50, 500, 900.
+static const CGFloat kSaturation50Min = (CGFloat)0.06;
+static const CGFloat kSaturation50Max = (CGFloat)0.12;
+static const CGFloat kSaturation500Min = (CGFloat)0.60;
+static const CGFloat kSaturation500Max = 1;
+static const CGFloat kSaturation900Min = (CGFloat)0.70;
+static const CGFloat kSaturation900Max = 1;
+
+// Minimum value of saturation to consider a color "colorless" (e.g. white/black/grey).
+static const CGFloat kSaturationMinThreshold = 1 / (CGFloat)256;
+
+// A small value for comparing floating point numbers that is appropriate for color components.
+static const CGFloat kComponentEpsilon = (CGFloat)0.5 / 256;
+
+// Observed brightness ranges for tints 50, 500, 900.
+static const CGFloat kBrightness50Min = (CGFloat)0.95;
+static const CGFloat kBrightness50Max = 1;
+static const CGFloat kBrightness500Min = (CGFloat)0.50;
+static const CGFloat kBrightness500Max = 1;
+
+// Observed quadratic brightness coefficients for tints >= 500.
+static const CGFloat kBrightnessQuadracticCoeff = (CGFloat)-0.00642857142857143;
+static const CGFloat kBrightnessLinearCoeff = (CGFloat)-0.03585714285714282;
+
+// Median saturation and brightness values for A100, A200, A400, A700.
+static const CGFloat kAccentSaturation[4] = {(CGFloat)0.49, (CGFloat)0.75, 1, 1};
+static const CGFloat kAccentBrightness[4] = {1, 1, 1, (CGFloat)0.92};
+
+/** Returns a value Clamped to the range [min, max]. */
+static inline CGFloat Clamp(CGFloat value, CGFloat min, CGFloat max) {
+  if (value < min) {
+    return min;
+  } else if (value > max) {
+    return max;
+  } else {
+    return value;
+  }
+}
+
+/** Returns the linear interpolation of [min, max] at value. */
+static inline CGFloat Lerp(CGFloat value, CGFloat min, CGFloat max) {
+  return (1 - value) * min + value * max;
+}
+
+/** Returns the value t such that Lerp(t, min, max) == value. */
+static inline CGFloat InvLerp(CGFloat value, CGFloat min, CGFloat max) {
+  return (value - min) / (max - min);
+}
+
+/**
+ Returns "component > value", but accounting for floating point mathematics. The component is
+ expected to be between [0,255].
+ */
+static inline BOOL IsComponentGreaterThanValue(CGFloat component, CGFloat value) {
+  return component + kComponentEpsilon > value;
+}
+
+/** The values of a seed that all of its tints and accents share. */
+typedef struct SeedCurves {
+  // The seed's hue.
+  CGFloat hue;
+
+  // Whether the seed is saturated enough for the saturation curves to apply.
+  BOOL isColorful;
+
+  // The seed's saturation, clamped to the observed 500 range when the seed is colorful.
+  CGFloat saturation;
+
+  // The saturations of the 50 and 900 tints.
+  CGFloat saturation50;
+  CGFloat saturation900;
+
+  // The seed's brightness clamped to the observed 500 range, and the brightness of the 50 tint.
+  CGFloat brightness;
+  CGFloat brightness50;
+} SeedCurves;
+
+static inline SeedCurves SeedCurvesMake(MDCPaletteHSB seed) {
+  SeedCurves curves;
+  curves.hue = seed.hue;
+  curves.isColorful = IsComponentGreaterThanValue(seed.saturation, kSaturationMinThreshold);
+  curves.saturation = seed.saturation;
+  curves.saturation50 = 0;
+  curves.saturation900 = 0;
+  if (curves.isColorful) {
+    // Limit saturation to observed values.
+    curves.saturation = Clamp(seed.saturation, kSaturation500Min, kSaturation500Max);
+    CGFloat t = InvLerp(curves.saturation, kSaturation500Min, kSaturation500Max);
+    curves.saturation50 = Lerp(t, kSaturation50Min, kSaturation50Max);
+    curves.saturation900 = Lerp(t, kSaturation900Min, kSaturation900Max);
+  }
+
+  // Limit brightness to observed values.
+  curves.brightness = Clamp(seed.brightness, kBrightness500Min, kBrightness500Max);
+  CGFloat t = InvLerp(curves.brightness, kBrightness500Min, kBrightness500Max);
+  curves.brightness50 = Lerp(t, kBrightness50Min, kBrightness50Max);
+  return curves;
+}
+
+static inline MDCPaletteHSB TintFromCurves(const SeedCurves *curves, MDCPaletteHSB seed, int tint) {
+  MDCPaletteHSB color;
+  color.hue = curves->hue;
+
+  // Saturation: select a saturation curve from the input saturation, unless the saturation is so
+  // low to be considered 'colorless', e.g. white/black/grey, in which case skip this step.
+  color.saturation = seed.saturation;
+  if (curves->isColorful) {
+    if (tint <= kQTMColorTint500Index) {
+      CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
+      color.saturation = Lerp(u, curves->saturation50, curves->saturation);
+    } else {
+      CGFloat u = InvLerp(tint, kQTMColorTint500Index, kQTMColorTint900Index);
+      color.saturation = Lerp(u, curves->saturation, curves->saturation900);
+    }
+  }
+
+  // Brightness: the tints 50-500 are nice and linear.
+  if (tint <= kQTMColorTint500Index) {
+    CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
+    color.brightness = Lerp(u, curves->brightness50, curves->brightness);
+
+    // The tints > 500 fall off roughly quadratically.
+  } else {
+    CGFloat u = tint - kQTMColorTint500Index;
+    color.brightness = curves->brightness + kBrightnessQuadracticCoeff * u * u +
+                       kBrightnessLinearCoeff * u;
+  }
+  return color;
+}
+
+static inline MDCPaletteHSB AccentFromCurves(const SeedCurves *curves,
+                                             MDCPaletteHSB seed,
+                                             int accent) {
+  int index = accent - kQTMColorAccent100Index;
+  MDCPaletteHSB color;
+  color.hue = curves->hue;
+  color.saturation = curves->isColorful ? kAccentSaturation[index] : seed.saturation;
+  color.brightness = kAccentBrightness[index];
+  return color;
+}
+
+static inline uint32_t ComponentFromUnit(CGFloat value) {
+  return (uint32_t)lround(Clamp(value, 0, 1) * 255);
+}
+
+MDCPaletteHSB MDCPaletteHSBFromRGB(CGFloat red, CGFloat green, CGFloat blue) {
+  CGFloat max = MAX(red, MAX(green, blue));
+  CGFloat min = MIN(red, MIN(green, blue));
+  CGFloat delta = max - min;
+
+  MDCPaletteHSB hsb;
+  hsb.brightness = max;
+  hsb.saturation = max > 0 ? delta / max : 0;
+  if (delta <= 0) {
+    hsb.hue = 0;
+  } else if (max == red) {
+    hsb.hue = (green - blue) / delta;
+  } else if (max == green) {
+    hsb.hue = 2 + (blue - red) / delta;
+  } else {
+    hsb.hue = 4 + (red - green) / delta;
+  }
+  hsb.hue /= 6;
+  if (hsb.hue < 0) {
+    hsb.hue += 1;
+  }
+  return hsb;
+}
+
+/** Returns the RGB component whose hexcone is offset by n sextants, in [0, 1]. */
+static inline CGFloat ComponentFromHSB(CGFloat n, CGFloat hue, CGFloat saturation, CGFloat value) {
+  CGFloat k = fmod(n + hue * 6, 6);
+  return value - value * saturation * Clamp(MIN(k, 4 - k), 0, 1);
+}
+
+uint32_t MDCPaletteRGBFromHSB(MDCPaletteHSB hsb) {
+  CGFloat hue = hsb.hue - floor(hsb.hue);
+  CGFloat saturation = Clamp(hsb.saturation, 0, 1);
+  CGFloat brightness = Clamp(hsb.brightness, 0, 1);
+  return ComponentFromUnit(ComponentFromHSB(5, hue, saturation, brightness)) << 16 |
+         ComponentFromUnit(ComponentFromHSB(3, hue, saturation, brightness)) << 8 |
+         ComponentFromUnit(ComponentFromHSB(1, hue, saturation, brightness));
+}
+
+MDCPaletteHSB MDCPaletteTintFromSeed(MDCPaletteHSB seed, int tint) {
+  SeedCurves curves = SeedCurvesMake(seed);
+  return TintFromCurves(&curves, seed, tint);
+}
+
+MDCPaletteHSB MDCPaletteAccentFromSeed(MDCPaletteHSB seed, int accent) {
+  NSCAssert(accent >= kQTMColorAccent100Index && accent <= kQTMColorAccent700Index,
+            @"Invalid accent index %i", accent);
+  SeedCurves curves = SeedCurvesMake(seed);
+  return AccentFromCurves(&curves, seed, accent);
+}
+
+void MDCPaletteGenerateHSB(const MDCPaletteHSB *seeds, size_t count, MDCPaletteHSB *palettes) {
+  for (size_t i = 0; i < count; ++i) {
+    // The clamped seed and the 50 and 900 curve endpoints are computed once per seed, and the
+    // per-tint loops below have no data-dependent control flow besides isColorful.
+    MDCPaletteHSB seed = seeds[i];
+    SeedCurves curves = SeedCurvesMake(seed);
+    MDCPaletteHSB *palette = palettes + i * kQTMColorCount;
+    for (int tint = kQTMColorTint50Index; tint <= kQTMColorTint900Index; ++tint) {
+      palette[tint] = TintFromCurves(&curves, seed, tint);
+    }
+    for (int accent = kQTMColorAccent100Index; accent <= kQTMColorAccent700Index; ++accent) {
+      palette[accent] = AccentFromCurves(&curves, seed, accent);
+    }
+  }
+}
+
+void MDCPaletteGenerateRGB(const uint32_t *seeds, size_t count, uint32_t *palettes) {
+  MDCPaletteHSB palette[kQTMColorCount];
+  for (size_t i = 0; i < count; ++i) {
+    uint32_t rgb = seeds[i];
+    MDCPaletteHSB seed = MDCPaletteHSBFromRGB((CGFloat)((rgb & 0xFF0000) >> 16) / 255,
+                                              (CGFloat)((rgb & 0x00FF00) >> 8) / 255,
+                                              (CGFloat)((rgb & 0x0000FF) >> 0) / 255);
+    MDCPaletteGenerateHSB(&seed, 1, palette);
+    for (int j = 0; j < kQTMColorCount; ++j) {
+      palettes[i * kQTMColorCount + j] = MDCPaletteRGBFromHSB(palette[j]);
+    }
+  }
+}
@@ -0,0 +1,283 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCPaletteExpansions.h"
+#import "MDCPaletteGenerator.h"
+#import "MaterialPalettes.h"
+
+static const size_t kBenchmarkSeedCount = 10000;
+
+// The seed colors the bit-identity tests cover: a hue grid crossed with saturations and
+// brightnesses around the thresholds of the tint and accent formulas, including greys.
+enum { kSeedHueCount = 36 };
+static const CGFloat kSeedSaturations[] = {
+    0, (CGFloat)0.5 / 256, (CGFloat)1 / 256, (CGFloat)2 / 256, (CGFloat)0.06, (CGFloat)0.12,
+    (CGFloat)0.3, (CGFloat)0.6, (CGFloat)0.7, (CGFloat)0.9, 1,
+};
+static const CGFloat kSeedBrightnesses[] = {
+    0, (CGFloat)0.1, (CGFloat)0.25, (CGFloat)0.5, (CGFloat)0.6, (CGFloat)0.75, (CGFloat)0.9,
+    (CGFloat)0.95, 1,
+};
+enum {
+  kSeedCount = kSeedHueCount * (sizeof(kSeedSaturations) / sizeof(kSeedSaturations[0])) *
+               (sizeof(kSeedBrightnesses) / sizeof(kSeedBrightnesses[0])),
+};
+
+// The constants and formulas that MDCPaletteTintFromTargetColor and
+// MDCPaletteAccentFromTargetColor used before the generator kernel.
+static const CGFloat kSaturation50Min = (CGFloat)0.06;
+static const CGFloat kSaturation50Max = (CGFloat)0.12;
+static const CGFloat kSaturation500Min = (CGFloat)0.60;
+static const CGFloat kSaturation500Max = 1;
+static const CGFloat kSaturation900Min = (CGFloat)0.70;
+static const CGFloat kSaturation900Max = 1;
+static const CGFloat kSaturationMinThreshold = 1 / (CGFloat)256;
+static const CGFloat kComponentEpsilon = (CGFloat)0.5 / 256;
+static const CGFloat kBrightness50Min = (CGFloat)0.95;
+static const CGFloat kBrightness50Max = 1;
+static const CGFloat kBrightness500Min = (CGFloat)0.50;
+static const CGFloat kBrightness500Max = 1;
+static const CGFloat kBrightnessQuadracticCoeff = (CGFloat)-0.00642857142857143;
+static const CGFloat kBrightnessLinearCoeff = (CGFloat)-0.03585714285714282;
+static const CGFloat kAccentSaturation[4] = {(CGFloat)0.49, (CGFloat)0.75, 1, 1};
+static const CGFloat kAccentBrightness[4] = {1, 1, 1, (CGFloat)0.92};
+
+static CGFloat Clamp(CGFloat value, CGFloat min, CGFloat max) {
+  if (value < min) {
+    return min;
+  } else if (value > max) {
+    return max;
+  } else {
+    return value;
+  }
+}
+
+static CGFloat Lerp(CGFloat value, CGFloat min, CGFloat max) {
+  return (1 - value) * min + value * max;
+}
+
+static CGFloat InvLerp(CGFloat value, CGFloat min, CGFloat max) {
+  return (value - min) / (max - min);
+}
+
+static BOOL IsComponentGreaterThanValue(CGFloat component, CGFloat value) {
+  return component + kComponentEpsilon > value;
+}
+
+static MDCPaletteHSB ReferenceTint(MDCPaletteHSB seed, int tint) {
+  CGFloat hsb[3] = {seed.hue, seed.saturation, seed.brightness};
+  CGFloat saturation = hsb[1];
+  CGFloat t;
+  if (IsComponentGreaterThanValue(hsb[1], kSaturationMinThreshold)) {
+    hsb[1] = Clamp(hsb[1], kSaturation500Min, kSaturation500Max);
+
+    t = InvLerp(hsb[1], kSaturation500Min, kSaturation500Max);
+    if (tint <= kQTMColorTint500Index) {
+      CGFloat saturation50 = Lerp(t, kSaturation50Min, kSaturation50Max);
+      CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
+      saturation = Lerp(u, saturation50, hsb[1]);
+    } else {
+      CGFloat saturation900 = Lerp(t, kSaturation900Min, kSaturation900Max);
+      CGFloat u = InvLerp(tint, kQTMColorTint500Index, kQTMColorTint900Index);
+      saturation = Lerp(u, hsb[1], saturation900);
+    }
+  }
+
+  CGFloat brightness;
+  hsb[2] = Clamp(hsb[2], kBrightness500Min, kBrightness500Max);
+  t = InvLerp(hsb[2], kBrightness500Min, kBrightness500Max);
+  if (tint <= kQTMColorTint500Index) {
+    CGFloat brightness50 = Lerp(t, kBrightness50Min, kBrightness50Max);
+    CGFloat u = InvLerp(tint, kQTMColorTint50Index, kQTMColorTint500Index);
+    brightness = Lerp(u, brightness50, hsb[2]);
+  } else {
+    CGFloat u = tint - kQTMColorTint500Index;
+    brightness = hsb[2] + kBrightnessQuadracticCoeff * u * u + kBrightnessLinearCoeff * u;
+  }
+  return (MDCPaletteHSB){.hue = hsb[0], .saturation = saturation, .brightness = brightness};
+}
+
+static MDCPaletteHSB ReferenceAccent(MDCPaletteHSB seed, int accent) {
+  int index = accent - kQTMColorAccent100Index;
+  CGFloat saturation = IsComponentGreaterThanValue(seed.saturation, kSaturationMinThreshold)
+                           ? kAccentSaturation[index]
+                           : seed.saturation;
+  return (MDCPaletteHSB){
+      .hue = seed.hue, .saturation = saturation, .brightness = kAccentBrightness[index]};
+}
+
+/** Returns the seed color at @c index of the grid of seed colors. */
+static MDCPaletteHSB SeedAtIndex(NSUInteger index) {
+  const NSUInteger saturationCount = sizeof(kSeedSaturations) / sizeof(kSeedSaturations[0]);
+  const NSUInteger brightnessCount = sizeof(kSeedBrightnesses) / sizeof(kSeedBrightnesses[0]);
+  return (MDCPaletteHSB){
+      .hue = (CGFloat)(index % kSeedHueCount) / kSeedHueCount,
+      .saturation = kSeedSaturations[(index / kSeedHueCount) % saturationCount],
+      .brightness = kSeedBrightnesses[(index / kSeedHueCount / saturationCount) % brightnessCount],
+  };
+}
+
+@interface PaletteGeneratorTests : XCTestCase
+@end
+
+@implementation PaletteGeneratorTests
+
+- (void)assertColor:(MDCPaletteHSB)color
+    isBitIdenticalToColor:(MDCPaletteHSB)otherColor
+                    index:(int)index {
+  XCTAssertEqual(memcmp(&color, &otherColor, sizeof(color)), 0,
+                 @"index %i: (%f, %f, %f) != (%f, %f, %f)", index, color.hue, color.saturation,
+                 color.brightness, otherColor.hue, otherColor.saturation, otherColor.brightness);
+}
+
+#pragma mark - Tests
+
+- (void)testBatchGenerationIsBitIdenticalToPerColorFormulas {
+  // Given
+  MDCPaletteHSB *seeds = malloc(kSeedCount * sizeof(MDCPaletteHSB));
+  MDCPaletteHSB *palettes = malloc(kSeedCount * kQTMColorCount * sizeof(MDCPaletteHSB));
+  for (NSUInteger i = 0; i < kSeedCount; ++i) {
+    seeds[i] = SeedAtIndex(i);
+  }
+
+  // When
+  MDCPaletteGenerateHSB(seeds, kSeedCount, palettes);
+
+  // Then
+  for (NSUInteger i = 0; i < kSeedCount; ++i) {
+    const MDCPaletteHSB *palette = palettes + i * kQTMColorCount;
+    for (int tint = kQTMColorTint50Index; tint <= kQTMColorTint900Index; ++tint) {
+      [self assertColor:palette[tint]
+          isBitIdenticalToColor:ReferenceTint(seeds[i], tint)
+                          index:tint];
+    }
+    for (int accent = kQTMColorAccent100Index; accent <= kQTMColorAccent700Index; ++accent) {
+      [self assertColor:palette[accent]
+          isBitIdenticalToColor:ReferenceAccent(seeds[i], accent)
+                          index:accent];
+    }
+  }
+  free(palettes);
+  free(seeds);
+}
+
+- (void)testSingleColorFunctionsMatchBatchGeneration {
+  // Every 37th seed visits each hue, saturation and brightness of the grid.
+  for (NSUInteger i = 0; i < kSeedCount; i += 37) {
+    // Given
+    MDCPaletteHSB seed = SeedAtIndex(i);
+    MDCPaletteHSB palette[kQTMColorCount];
+
+    // When
+    MDCPaletteGenerateHSB(&seed, 1, palette);
+
+    // Then
+    for (int tint = kQTMColorTint50Index; tint <= kQTMColorTint900Index; ++tint) {
+      [self assertColor:MDCPaletteTintFromSeed(seed, tint)
+          isBitIdenticalToColor:palette[tint]
+                          index:tint];
+    }
+    for (int accent = kQTMColorAccent100Index; accent <= kQTMColorAccent700Index; ++accent) {
+      [self assertColor:MDCPaletteAccentFromSeed(seed, accent)
+          isBitIdenticalToColor:palette[accent]
+                          index:accent];
+    }
+  }
+}
+
+- (void)testGeneratedPaletteMatchesTargetColorFunctions {
+  // Given
+  UIColor *color = [UIColor colorWithRed:(CGFloat)0.2
+                                   green:(CGFloat)0.4
+                                    blue:(CGFloat)0.9
+                                   alpha:1];
+
+  // When
+  MDCPalette *palette = [MDCPalette paletteGeneratedFromColor:color];
+
+  // Then
+  XCTAssertEqualObjects(palette.tint50, MDCPaletteTintFromTargetColor(color, MDCPaletteTint50Name));
+  XCTAssertEqualObjects(palette.tint500,
+                        MDCPaletteTintFromTargetColor(color, MDCPaletteTint500Name));
+  XCTAssertEqualObjects(palette.tint900,
+                        MDCPaletteTintFromTargetColor(color, MDCPaletteTint900Name));
+  XCTAssertEqualObjects(palette.accent100,
+                        MDCPaletteAccentFromTargetColor(color, MDCPaletteAccent100Name));
+  XCTAssertEqualObjects(palette.accent700,
+                        MDCPaletteAccentFromTargetColor(color, MDCPaletteAccent700Name));
+}
+
+- (void)testRGBGenerationGolden {
+  // Given
+  uint32_t seed = 0xF44336;
+  uint32_t palette[kQTMColorCount];
+
+  // When
+  MDCPaletteGenerateRGB(&seed, 1, palette);
+
+  // Then
+  const uint32_t expected[kQTMColorCount] = {
+      0xFEE9E8, 0xFCC7C3, 0xFAA59F, 0xF8847C, 0xF66358, 0xF44336, 0xE93D30,
+      0xDB372A, 0xCA3024, 0xB5281E, 0xFF8B82, 0xFF4D40, 0xFF1100, 0xEB1000,
+  };
+  for (int i = 0; i < kQTMColorCount; ++i) {
+    XCTAssertEqual(palette[i], expected[i], @"index %i", i);
+  }
+}
+
+- (void)testRGBRoundTrip {
+  for (uint32_t rgb = 0; rgb <= 0xFFFFFF; rgb += 997) {
+    MDCPaletteHSB hsb = MDCPaletteHSBFromRGB((CGFloat)((rgb & 0xFF0000) >> 16) / 255,
+                                             (CGFloat)((rgb & 0x00FF00) >> 8) / 255,
+                                             (CGFloat)((rgb & 0x0000FF) >> 0) / 255);
+    XCTAssertEqual(MDCPaletteRGBFromHSB(hsb), rgb);
+  }
+}
+
+#pragma mark - Performance
+
+- (void)testBatchGenerationPerformance {
+  uint32_t *seeds = malloc(kBenchmarkSeedCount * sizeof(uint32_t));
+  uint32_t *palettes = malloc(kBenchmarkSeedCount * kQTMColorCount * sizeof(uint32_t));
+  // Spread the seeds evenly over the RGB range.
+  for (size_t i = 0; i < kBenchmarkSeedCount; ++i) {
+    seeds[i] = (uint32_t)(i * (0xFFFFFF / kBenchmarkSeedCount));
+  }
+
+  [self measureBlock:^{
+    MDCPaletteGenerateRGB(seeds, kBenchmarkSeedCount, palettes);
+  }];
+
+  free(palettes);
+  free(seeds);
+}
+
+- (void)testGeneratedPalettePerformance {
+  UIColor *color = [UIColor colorWithRed:(CGFloat)0.2
+                                   green:(CGFloat)0.4
+                                    blue:(CGFloat)0.9
+                                   alpha:1];
+
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 1000; ++i) {
+      @autoreleasepool {
+        [MDCPalette paletteGeneratedFromColor:color];
+      }
+    }
+  }];
+}
+
+@end
@@ -23,6 +23,24 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
                          alpha:1];
 }
 
+/** A palette subclass that records calls to the designated initializer. */
+@interface PaletteTestsInitializerRecordingPalette : MDCPalette
+@property(nonatomic, assign) BOOL initializedWithTintsAndAccents;
+@end
+
+@implementation PaletteTestsInitializerRecordingPalette
+
+- (instancetype)initWithTints:(NSDictionary<MDCPaletteTint, UIColor *> *)tints
+                      accents:(NSDictionary<MDCPaletteAccent, UIColor *> *)accents {
+  self = [super initWithTints:tints accents:accents];
+  if (self) {
+    _initializedWithTintsAndAccents = YES;
+  }
+  return self;
+}
+
+@end
+
 @interface PaletteTests : XCTestCase
 
 @end
@@ -40,6 +58,43 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
   XCTAssertTrue(first == second);
 }
 
+- (void)testColorCaching {
+  MDCPalette *palette = MDCPalette.tealPalette;
+  XCTAssertTrue(palette.tint500 == palette.tint500);
+  XCTAssertTrue(palette.accent700 == palette.accent700);
+}
+
+- (void)testConcurrentColorAccessReturnsOneColor {
+  // Given
+  MDCPalette *palette = MDCPalette.limePalette;
+  NSPointerArray *colors = [NSPointerArray strongObjectsPointerArray];
+  colors.count = 64;
+
+  // When
+  dispatch_apply(colors.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0),
+                 ^(size_t i) {
+                   UIColor *color = palette.tint800;
+                   @synchronized(colors) {
+                     [colors replacePointerAtIndex:i withPointer:(__bridge void *)color];
+                   }
+                 });
+
+  // Then
+  for (NSUInteger i = 0; i < colors.count; ++i) {
+    XCTAssertTrue([colors pointerAtIndex:i] == (__bridge void *)palette.tint800);
+  }
+}
+
+- (void)testMaterialPaletteColors {
+  XCTAssertEqualObjects(MDCPalette.redPalette.tint500, ColorFromRGB(0xF44336));
+  XCTAssertEqualObjects(MDCPalette.redPalette.accent700, ColorFromRGB(0xD50000));
+  XCTAssertEqualObjects(MDCPalette.deepPurplePalette.tint900, ColorFromRGB(0x311B92));
+  XCTAssertEqualObjects(MDCPalette.lightBluePalette.accent100, ColorFromRGB(0x80D8FF));
+  XCTAssertEqualObjects(MDCPalette.deepOrangePalette.accent400, ColorFromRGB(0xFF3D00));
+  XCTAssertEqualObjects(MDCPalette.greyPalette.tint50, ColorFromRGB(0xFAFAFA));
+  XCTAssertEqualObjects(MDCPalette.blueGreyPalette.tint900, ColorFromRGB(0x263238));
+}
+
 - (void)testAccentlessPalette {
   MDCPalette *brownPalette = MDCPalette.brownPalette;
   XCTAssertNil(brownPalette.accent100);
@@ -66,6 +121,17 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
   XCTAssertNotNil(palette.accent700);
 }
 
+- (void)testGeneratedPaletteUsesDesignatedInitializer {
+  // When
+  PaletteTestsInitializerRecordingPalette *palette =
+      [PaletteTestsInitializerRecordingPalette paletteGeneratedFromColor:UIColor.redColor];
+
+  // Then
+  XCTAssertTrue(palette.initializedWithTintsAndAccents);
+  XCTAssertNotNil(palette.tint500);
+  XCTAssertNotNil(palette.accent700);
+}
+
 - (void)testCustomPalette {
   NSDictionary<MDCPaletteTint, UIColor *> *tints = @{
     MDCPaletteTint50Name : [UIColor colorWithWhite:(CGFloat)0 alpha:(CGFloat)1],
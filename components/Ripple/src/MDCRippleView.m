@@ -14,6 +14,7 @@
 
 #import "MDCRippleView.h"
 #import "private/MDCRippleLayer.h"
+#import "private/MDCRippleView+Private.h"
 
 #import "MaterialAvailability.h"
 #import "MDCRippleViewDelegate.h"
@@ -37,7 +38,13 @@
 static const CGFloat kRippleDefaultAlpha = (CGFloat)0.12;
 static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
 
-@implementation MDCRippleView
+/** The number of ripple layers a ripple view keeps for reuse. */
+static const NSUInteger kRippleLayerPoolCapacity = 3;
+
+@implementation MDCRippleView {
+  // The ripple layers the view reuses. A layer is idle while it has no superlayer.
+  NSMutableArray<MDCRippleLayer *> *_rippleLayerPool;
+}
 
 @synthesize activeRippleLayer = _activeRippleLayer;
 
@@ -69,6 +76,7 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   });
   _rippleColor = defaultRippleColor;
   _rippleStyle = MDCRippleStyleBounded;
+  _rippleLayerPool = [NSMutableArray arrayWithCapacity:kRippleLayerPoolCapacity];
 }
 
 - (void)layoutSubviews {
@@ -202,17 +210,32 @@ static const CGFloat kRippleFadeOutDelay = (CGFloat)0.15;
   rippleLayer.fillColor = self.rippleColor.CGColor;
 }
 
+- (MDCRippleLayer *)dequeueRippleLayer {
+  for (MDCRippleLayer *rippleLayer in _rippleLayerPool) {
+    if (!rippleLayer.superlayer) {
+      _rippleLayerPoolHitCount += 1;
+      [rippleLayer prepareForReuse];
+      return rippleLayer;
+    }
+  }
+
+  MDCRippleLayer *rippleLayer = [MDCRippleLayer layer];
+  rippleLayer.rippleLayerDelegate = self;
+  _createdRippleLayerCount += 1;
+  if (_rippleLayerPool.count < kRippleLayerPoolCapacity) {
+    [_rippleLayerPool addObject:rippleLayer];
+  }
+  return rippleLayer;
+}
+
 - (void)beginRippleTouchDownAtPoint:(CGPoint)point
                            animated:(BOOL)animated
                          completion:(nullable MDCRippleCompletionBlock)completion {
-  MDCRippleLayer *rippleLayer = [MDCRippleLayer layer];
-  rippleLayer.rippleLayerDelegate = self;
+  MDCRippleLayer *rippleLayer = [self dequeueRippleLayer];
   [self updateRippleStyle];
   [self setColorForRippleLayer:rippleLayer];
   rippleLayer.frame = self.bounds;
-  if (self.rippleStyle == MDCRippleStyleUnbounded) {
-    rippleLayer.maximumRadius = self.maximumRadius;
-  }
+  rippleLayer.maximumRadius = self.rippleStyle == MDCRippleStyleUnbounded ? self.maximumRadius : 0;
   [self.layer addSublayer:rippleLayer];
   [rippleLayer startRippleAtPoint:point animated:animated completion:completion];
   self.activeRippleLayer = rippleLayer;
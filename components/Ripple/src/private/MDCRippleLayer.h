@@ -93,4 +93,11 @@ typedef void (^MDCRippleCompletionBlock)(void);
  */
 - (void)fadeOutRippleAnimated:(BOOL)animated
                    completion:(nullable MDCRippleCompletionBlock)completion;
+
+/**
+ Prepares a layer that was removed from its superlayer to present a new ripple, by removing its
+ animations and the state of its previous ripple.
+ */
+- (void)prepareForReuse;
+
 @end
@@ -37,7 +37,101 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
   return (CGFloat)(hypot(CGRectGetMidX(rect), CGRectGetMidY(rect)) + kExpandRippleBeyondSurface);
 }
 
-@implementation MDCRippleLayer
+#pragma mark - Animation templates
+
+/** Returns a new touch down scale animation. Its @c fromValue must be set. */
+static CABasicAnimation *TouchDownScaleAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCRippleLayer.touchDownScale"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
+                             scaleAnim.keyPath = kRippleLayerScaleString;
+                             scaleAnim.toValue = @1;
+                             scaleAnim.timingFunction = [CAMediaTimingFunction
+                                 mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+                             return scaleAnim;
+                           }];
+}
+
+/** Returns a new touch down position animation. Its @c path must be set. */
+static CAKeyframeAnimation *TouchDownPositionAnimation(void) {
+  return [CAKeyframeAnimation
+      mdc_animationWithTemplateKey:@"MDCRippleLayer.touchDownPosition"
+                           builder:^CAAnimation * {
+                             CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
+                             positionAnim.keyPath = kRippleLayerPositionString;
+                             positionAnim.keyTimes = @[ @0, @1 ];
+                             positionAnim.values = @[ @0, @1 ];
+                             positionAnim.timingFunction = [CAMediaTimingFunction
+                                 mdc_functionWithType:MDCAnimationTimingFunctionStandard];
+                             return positionAnim;
+                           }];
+}
+
+/** Returns a new touch down fade in animation. */
+static CABasicAnimation *TouchDownFadeInAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCRippleLayer.touchDownFadeIn"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
+                             fadeInAnim.keyPath = kRippleLayerOpacityString;
+                             fadeInAnim.fromValue = @0;
+                             fadeInAnim.toValue = @1;
+                             fadeInAnim.duration = kRippleFadeInDuration;
+                             fadeInAnim.timingFunction = [CAMediaTimingFunction
+                                 functionWithName:kCAMediaTimingFunctionLinear];
+                             return fadeInAnim;
+                           }];
+}
+
+/** Returns a new touch down animation group. Its @c animations must be set. */
+static CAAnimationGroup *TouchDownAnimationGroup(void) {
+  return [CAAnimationGroup mdc_animationWithTemplateKey:@"MDCRippleLayer.touchDown"
+                                                builder:^CAAnimation * {
+                                                  CAAnimationGroup *animGroup =
+                                                      [[CAAnimationGroup alloc] init];
+                                                  animGroup.duration = kRippleTouchDownDuration;
+                                                  return animGroup;
+                                                }];
+}
+
+/**
+ Returns a new opacity animation that holds its final value. Its @c fromValue, @c toValue and
+ @c duration must be set.
+ */
+static CABasicAnimation *FadeAnimation(void) {
+  return [CABasicAnimation
+      mdc_animationWithTemplateKey:@"MDCRippleLayer.fade"
+                           builder:^CAAnimation * {
+                             CABasicAnimation *fadeAnim = [[CABasicAnimation alloc] init];
+                             fadeAnim.keyPath = kRippleLayerOpacityString;
+                             fadeAnim.timingFunction = [CAMediaTimingFunction
+                                 functionWithName:kCAMediaTimingFunctionLinear];
+                             fadeAnim.fillMode = kCAFillModeForwards;
+                             fadeAnim.removedOnCompletion = NO;
+                             return fadeAnim;
+                           }];
+}
+
+/**
+ Returns a circle path in @c ovalRect. Ripple layers of the same size share their path, so the path
+ of the last circle is kept and returned again while the circle doesn't change.
+ */
+static CGPathRef GetCirclePath(CGRect ovalRect) {
+  static UIBezierPath *lastCirclePath;
+  static CGRect lastOvalRect;
+  if (!lastCirclePath || !CGRectEqualToRect(ovalRect, lastOvalRect)) {
+    lastCirclePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
+    lastOvalRect = ovalRect;
+  }
+  return lastCirclePath.CGPath;
+}
+
+@implementation MDCRippleLayer {
+  // Incremented when the layer is reused, so completion blocks of the animations of a previous
+  // ripple don't change the state of the current one.
+  NSUInteger _rippleGeneration;
+}
 
 - (void)setNeedsLayout {
   [super setNeedsLayout];
@@ -53,8 +147,10 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
 - (void)setPathFromRadii:(CGFloat)radius {
   CGRect ovalRect = CGRectMake(CGRectGetMidX(self.bounds) - radius,
                                CGRectGetMidY(self.bounds) - radius, radius * 2, radius * 2);
-  UIBezierPath *circlePath = [UIBezierPath bezierPathWithOvalInRect:ovalRect];
-  self.path = circlePath.CGPath;
+  CGPathRef circlePath = GetCirclePath(ovalRect);
+  if (self.path != circlePath) {
+    self.path = circlePath;
+  }
 }
 
 - (CGFloat)calculateRadius {
@@ -78,12 +174,8 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
     _startAnimationActive = YES;
 
     CGFloat startingScale = GetInitialRippleRadius(self.bounds) / finalRadius;
-    CABasicAnimation *scaleAnim = [[CABasicAnimation alloc] init];
-    scaleAnim.keyPath = kRippleLayerScaleString;
+    CABasicAnimation *scaleAnim = TouchDownScaleAnimation();
     scaleAnim.fromValue = @(startingScale);
-    scaleAnim.toValue = @1;
-    scaleAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
 
     UIBezierPath *centerPath = [UIBezierPath bezierPath];
     CGPoint startPoint = point;
@@ -92,32 +184,28 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
     [centerPath addLineToPoint:endPoint];
     [centerPath closePath];
 
-    CAKeyframeAnimation *positionAnim = [[CAKeyframeAnimation alloc] init];
-    positionAnim.keyPath = kRippleLayerPositionString;
+    CAKeyframeAnimation *positionAnim = TouchDownPositionAnimation();
     positionAnim.path = centerPath.CGPath;
-    positionAnim.keyTimes = @[ @0, @1 ];
-    positionAnim.values = @[ @0, @1 ];
-    positionAnim.timingFunction =
-        [CAMediaTimingFunction mdc_functionWithType:MDCAnimationTimingFunctionStandard];
-
-    CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-    fadeInAnim.keyPath = kRippleLayerOpacityString;
-    fadeInAnim.fromValue = @0;
-    fadeInAnim.toValue = @1;
-    fadeInAnim.duration = kRippleFadeInDuration;
-    fadeInAnim.timingFunction =
-        [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
+
+    CABasicAnimation *fadeInAnim = TouchDownFadeInAnimation();
 
     [CATransaction begin];
-    CAAnimationGroup *animGroup = [[CAAnimationGroup alloc] init];
+    CAAnimationGroup *animGroup = TouchDownAnimationGroup();
     animGroup.animations = @[ scaleAnim, positionAnim, fadeInAnim ];
-    animGroup.duration = kRippleTouchDownDuration;
+    NSUInteger generation = _rippleGeneration;
     [CATransaction setCompletionBlock:^{
-      self->_startAnimationActive = NO;
+      BOOL isCurrentRipple = self->_rippleGeneration == generation;
+      if (isCurrentRipple) {
+        self->_startAnimationActive = NO;
+      }
       if (completion) {
         completion();
       }
-      [self.rippleLayerDelegate rippleLayerTouchDownAnimationDidEnd:self];
+      // Once the layer has been reused, the delegate must not take this for the end of the
+      // current ripple's touch down.
+      if (isCurrentRipple) {
+        [self.rippleLayerDelegate rippleLayerTouchDownAnimationDidEnd:self];
+      }
     }];
     [self addAnimation:animGroup forKey:nil];
     _rippleTouchDownStartTime = CACurrentMediaTime();
@@ -127,14 +215,10 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
 
 - (void)fadeInRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
+  CABasicAnimation *fadeInAnim = FadeAnimation();
   fadeInAnim.fromValue = @0;
   fadeInAnim.toValue = @1;
   fadeInAnim.duration = animated ? kRippleFadeInDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
@@ -146,14 +230,10 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
 
 - (void)fadeOutRippleAnimated:(BOOL)animated completion:(MDCRippleCompletionBlock)completion {
   [CATransaction begin];
-  CABasicAnimation *fadeInAnim = [[CABasicAnimation alloc] init];
-  fadeInAnim.keyPath = kRippleLayerOpacityString;
+  CABasicAnimation *fadeInAnim = FadeAnimation();
   fadeInAnim.fromValue = @1;
   fadeInAnim.toValue = @0;
   fadeInAnim.duration = animated ? kRippleFadeOutDuration : 0;
-  fadeInAnim.timingFunction = [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeInAnim.fillMode = kCAFillModeForwards;
-  fadeInAnim.removedOnCompletion = NO;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
@@ -170,25 +250,30 @@ static CGFloat GetFinalRippleRadius(CGRect rect) {
   }
   [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidBegin:self];
   [CATransaction begin];
-  CABasicAnimation *fadeOutAnim = [[CABasicAnimation alloc] init];
-  fadeOutAnim.keyPath = kRippleLayerOpacityString;
+  CABasicAnimation *fadeOutAnim = FadeAnimation();
   fadeOutAnim.fromValue = @1;
   fadeOutAnim.toValue = @0;
   fadeOutAnim.duration = animated ? kRippleTouchUpDuration : 0;
   fadeOutAnim.beginTime = [self convertTime:_rippleTouchDownStartTime + delay fromLayer:nil];
-  fadeOutAnim.timingFunction =
-      [CAMediaTimingFunction functionWithName:kCAMediaTimingFunctionLinear];
-  fadeOutAnim.fillMode = kCAFillModeForwards;
-  fadeOutAnim.removedOnCompletion = NO;
+  NSUInteger generation = _rippleGeneration;
   [CATransaction setCompletionBlock:^{
     if (completion) {
       completion();
     }
-    [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidEnd:self];
-    [self removeFromSuperlayer];
+    if (self->_rippleGeneration == generation) {
+      [self.rippleLayerDelegate rippleLayerTouchUpAnimationDidEnd:self];
+      [self removeFromSuperlayer];
+    }
   }];
   [self addAnimation:fadeOutAnim forKey:nil];
   [CATransaction commit];
 }
 
+- (void)prepareForReuse {
+  _rippleGeneration += 1;
+  [self removeAllAnimations];
+  _startAnimationActive = NO;
+  _rippleTouchDownStartTime = 0;
+}
+
 @end
@@ -282,4 +282,43 @@
   XCTAssertEqual(rippleLayer.maximumRadius, fakeRadius);
 }
 
+- (void)testReusedLayerDoesNotReportTheEndOfThePreviousRipple {
+  // Given
+  FakeMDCRippleLayerAnimationDelegate *delegate =
+      [[FakeMDCRippleLayerAnimationDelegate alloc] init];
+  MDCRippleLayer *rippleLayer = [[MDCRippleLayer alloc] init];
+  rippleLayer.bounds = CGRectMake(0, 0, 100, 100);
+  rippleLayer.rippleLayerDelegate = delegate;
+  XCTestExpectation *expectation = [self expectationWithDescription:@"completed"];
+  [rippleLayer startRippleAtPoint:CGPointMake(10, 10) animated:NO completion:nil];
+  delegate.rippleTouchDownDidEnd = NO;
+  [rippleLayer endRippleAnimated:YES
+                      completion:^{
+                        [expectation fulfill];
+                      }];
+
+  // When
+  [rippleLayer prepareForReuse];
+  [self waitForExpectationsWithTimeout:3 handler:nil];
+
+  // Then
+  XCTAssertFalse(delegate.rippleTouchUpDidEnd);
+  XCTAssertFalse(delegate.rippleTouchDownDidEnd);
+}
+
+- (void)testPrepareForReuseResetsTheRipple {
+  // Given
+  MDCRippleLayer *rippleLayer = [[MDCRippleLayer alloc] init];
+  rippleLayer.bounds = CGRectMake(0, 0, 100, 100);
+  [rippleLayer startRippleAtPoint:CGPointMake(10, 10) animated:YES completion:nil];
+
+  // When
+  [rippleLayer prepareForReuse];
+
+  // Then
+  XCTAssertFalse(rippleLayer.isStartAnimationActive);
+  XCTAssertEqual(rippleLayer.animationKeys.count, 0U);
+  XCTAssertEqualWithAccuracy(rippleLayer.rippleTouchDownStartTime, 0, 0.0001);
+}
+
 @end
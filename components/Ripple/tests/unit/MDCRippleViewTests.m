@@ -14,7 +14,9 @@
 
 #import <XCTest/XCTest.h>
 
+#import "../../../AnimationTiming/src/private/CAAnimation+MDCAnimationTiming+Private.h"
 #import "../../src/private/MDCRippleLayer.h"
+#import "../../src/private/MDCRippleView+Private.h"
 #import "MaterialRipple.h"
 
 @interface FakeMDCRippleViewAnimationDelegate : NSObject <MDCRippleViewDelegate>
@@ -300,4 +302,96 @@
   XCTAssertEqualObjects(injectedRippleView.superview, firstLevelView);
 }
 
+- (void)testRippleReusesIdleRippleLayer {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  MDCRippleLayer *firstRippleLayer = rippleView.activeRippleLayer;
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+
+  // When
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.activeRippleLayer, firstRippleLayer);
+  XCTAssertEqual(rippleView.activeRippleLayer.superlayer, rippleView.layer);
+  XCTAssertEqual(rippleView.createdRippleLayerCount, 1U);
+  XCTAssertEqual(rippleView.rippleLayerPoolHitCount, 1U);
+}
+
+- (void)testOverlappingRipplesUseDifferentRippleLayers {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  MDCRippleLayer *firstRippleLayer = rippleView.activeRippleLayer;
+
+  // When
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertNotEqual(rippleView.activeRippleLayer, firstRippleLayer);
+  XCTAssertEqual(rippleView.layer.sublayers.count, 2U);
+  XCTAssertEqual(rippleView.createdRippleLayerCount, 2U);
+  XCTAssertEqual(rippleView.rippleLayerPoolHitCount, 0U);
+}
+
+- (void)testReusedRippleLayerTakesTheCurrentStyle {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 40, 40)];
+  rippleView.rippleStyle = MDCRippleStyleUnbounded;
+  rippleView.maximumRadius = 10;
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+
+  // When
+  rippleView.rippleStyle = MDCRippleStyleBounded;
+  rippleView.rippleColor = UIColor.redColor;
+  [rippleView beginRippleTouchDownAtPoint:CGPointZero animated:NO completion:nil];
+
+  // Then
+  XCTAssertEqual(rippleView.rippleLayerPoolHitCount, 1U);
+  XCTAssertEqual(rippleView.activeRippleLayer.maximumRadius, 0);
+  XCTAssertTrue(CGColorEqualToColor(rippleView.activeRippleLayer.fillColor,
+                                    UIColor.redColor.CGColor));
+}
+
+- (void)testPerformanceOfOneThousandTaps {
+  // Given
+  MDCRippleView *rippleView = [[MDCRippleView alloc] initWithFrame:CGRectMake(0, 0, 64, 64)];
+  // One warm-up tap builds the templates and measures how many copies a tap takes.
+  NSUInteger copyCountBeforeTap = CAAnimation.mdc_animationTemplateCopyCount;
+  [self tapRippleView:rippleView];
+  NSUInteger templateCopiesPerTap = CAAnimation.mdc_animationTemplateCopyCount - copyCountBeforeTap;
+  NSUInteger buildCount = CAAnimation.mdc_animationTemplateBuildCount;
+  NSUInteger copyCount = CAAnimation.mdc_animationTemplateCopyCount;
+  __block NSUInteger tapCount = 0;
+
+  // When
+  [self measureBlock:^{
+    @autoreleasepool {
+      for (NSUInteger i = 0; i < 1000; ++i) {
+        [self tapRippleView:rippleView];
+      }
+      tapCount += 1000;
+    }
+  }];
+
+  // Then
+  // Taps only copy the templates built by the warm-up tap, and every tap reuses the one pooled
+  // ripple layer.
+  XCTAssertGreaterThan(templateCopiesPerTap, 0U);
+  XCTAssertEqual(CAAnimation.mdc_animationTemplateBuildCount, buildCount);
+  XCTAssertEqual(CAAnimation.mdc_animationTemplateCopyCount - copyCount,
+                 tapCount * templateCopiesPerTap);
+  XCTAssertEqual(rippleView.createdRippleLayerCount, 1U);
+}
+
+#pragma mark - Helpers
+
+- (void)tapRippleView:(MDCRippleView *)rippleView {
+  [rippleView beginRippleTouchDownAtPoint:CGPointMake(8, 8) animated:YES completion:nil];
+  [rippleView beginRippleTouchUpAnimated:YES completion:nil];
+  [rippleView cancelAllRipplesAnimated:NO completion:nil];
+}
+
 @end
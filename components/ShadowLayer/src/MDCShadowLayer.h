@@ -76,6 +76,22 @@
  */
 @property(nonatomic, getter=isShadowMaskEnabled, assign) BOOL shadowMaskEnabled;
 
+/**
+ Whether to render the shadow as a single cached, pre-blurred, stretchable image instead of the
+ two shadow-casting sublayers.
+
+ Shadow-casting sublayers, and masked ones in particular, are rendered offscreen. When enabled, the
+ shadow is rendered once per elevation, corner radius, shadow color, shadow mask setting and screen
+ scale, and the image is shared by every layer with the same values.
+
+ The image can only reproduce rounded rectangle shadows, so the sublayers are still used while a
+ custom shadowPath is set, or while the bounds are too small for the image's corners and edges.
+ Corner radius changes are not animated while the image is used.
+
+ Default is NO.
+ */
+@property(nonatomic, getter=isShadowImageEnabled, assign) BOOL shadowImageEnabled;
+
 /**
  Animates the layer's corner radius
 
@@ -14,9 +14,10 @@
 
 #import "MDCShadowLayer.h"
 
+#import "private/MDCShadowImageCache.h"
+#import "private/MDCShadowMetricsValues.h"
+
 static const CGFloat kShadowElevationDialog = 24.0;
-static const float kKeyShadowOpacity = (float)0.26;
-static const float kAmbientShadowOpacity = (float)0.08;
 
 @interface MDCPendingAnimation : NSObject <CAAction>
 @property(nonatomic, weak) CALayer *animationSourceLayer;
@@ -29,21 +30,43 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 + (MDCShadowMetrics *)metricsWithElevation:(CGFloat)elevation {
   if (0.0 < elevation) {
+    // MDCShadowMetrics is immutable, so the metrics of the whole elevations up to the dialog
+    // elevation, which include every MDCShadowElevation constant, are shared.
+    if (elevation <= kShadowElevationDialog && elevation == floor(elevation)) {
+      return [MDCShadowMetrics sharedMetricsForWholeElevations][(NSUInteger)elevation];
+    }
     return [[MDCShadowMetrics alloc] initWithElevation:elevation];
   } else {
     return [MDCShadowMetrics emptyShadowMetrics];
   }
 }
 
+/** The shared metrics indexed by whole elevation, from 0 up to the dialog elevation. */
++ (NSArray<MDCShadowMetrics *> *)sharedMetricsForWholeElevations {
+  static NSArray<MDCShadowMetrics *> *sharedMetrics;
+  static dispatch_once_t once;
+  dispatch_once(&once, ^{
+    NSUInteger count = (NSUInteger)kShadowElevationDialog + 1;
+    NSMutableArray<MDCShadowMetrics *> *metrics = [NSMutableArray arrayWithCapacity:count];
+    [metrics addObject:[MDCShadowMetrics emptyShadowMetrics]];
+    for (NSUInteger elevation = 1; elevation < count; ++elevation) {
+      [metrics addObject:[[MDCShadowMetrics alloc] initWithElevation:(CGFloat)elevation]];
+    }
+    sharedMetrics = [metrics copy];
+  });
+  return sharedMetrics;
+}
+
 - (MDCShadowMetrics *)initWithElevation:(CGFloat)elevation {
   self = [super init];
   if (self) {
-    _topShadowRadius = [MDCShadowMetrics ambientShadowBlur:elevation];
-    _topShadowOffset = CGSizeMake(0.0, 0.0);
-    _topShadowOpacity = kAmbientShadowOpacity;
-    _bottomShadowRadius = [MDCShadowMetrics keyShadowBlur:elevation];
-    _bottomShadowOffset = CGSizeMake(0.0, [MDCShadowMetrics keyShadowYOff:elevation]);
-    _bottomShadowOpacity = kKeyShadowOpacity;
+    MDCShadowMetricsValues values = MDCShadowMetricsValuesForElevation(elevation);
+    _topShadowRadius = values.topShadowRadius;
+    _topShadowOffset = values.topShadowOffset;
+    _topShadowOpacity = values.topShadowOpacity;
+    _bottomShadowRadius = values.bottomShadowRadius;
+    _bottomShadowOffset = values.bottomShadowOffset;
+    _bottomShadowOpacity = values.bottomShadowOpacity;
   }
   return self;
 }
@@ -64,21 +87,6 @@ static const float kAmbientShadowOpacity = (float)0.08;
   return emptyShadowMetrics;
 }
 
-+ (CGFloat)ambientShadowBlur:(CGFloat)points {
-  CGFloat blur = (CGFloat)0.889544 * points - (CGFloat)0.003701;
-  return blur;
-}
-
-+ (CGFloat)keyShadowBlur:(CGFloat)points {
-  CGFloat blur = (CGFloat)0.666920 * points - (CGFloat)0.001648;
-  return blur;
-}
-
-+ (CGFloat)keyShadowYOff:(CGFloat)points {
-  CGFloat yOff = (CGFloat)1.23118 * points - (CGFloat)0.03933;
-  return yOff;
-}
-
 @end
 
 @interface MDCShadowLayer ()
@@ -92,6 +100,8 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 @implementation MDCShadowLayer {
   BOOL _shadowPathIsInvalid;
+  CALayer *_shadowImageLayer;
+  MDCShadowImage *_shadowImage;
 }
 
 - (instancetype)init {
@@ -120,6 +130,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
       MDCShadowLayer *otherLayer = (MDCShadowLayer *)layer;
       _elevation = otherLayer.elevation;
       _shadowMaskEnabled = otherLayer.isShadowMaskEnabled;
+      _shadowImageEnabled = otherLayer.isShadowImageEnabled;
       _bottomShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.bottomShadow];
       _topShadow = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadow];
       _topShadowMask = [[CAShapeLayer alloc] initWithLayer:otherLayer.topShadowMask];
@@ -152,13 +163,7 @@ static const float kAmbientShadowOpacity = (float)0.08;
   }
 
   // Setup shadow layer state based off _elevation and _shadowMaskEnabled
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:_elevation];
-  _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
-  _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
-  _topShadow.shadowOpacity = shadowMetrics.topShadowOpacity;
-  _bottomShadow.shadowOffset = shadowMetrics.bottomShadowOffset;
-  _bottomShadow.shadowRadius = shadowMetrics.bottomShadowRadius;
-  _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
+  [self applyShadowMetricsForElevation:_elevation];
 
   if (!_topShadowMask) {
     _topShadowMask = [CAShapeLayer layer];
@@ -214,7 +219,10 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
   _topShadow.cornerRadius = cornerRadius;
   _bottomShadow.cornerRadius = cornerRadius;
-  if (_shadowMaskEnabled) {
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
+  if (_shadowMaskEnabled && ![self rendersShadowImage]) {
     [self configureShadowLayerMaskForLayer:_topShadowMask];
     [self configureShadowLayerMaskForLayer:_bottomShadowMask];
     _topShadow.mask = _topShadowMask;
@@ -226,7 +234,10 @@ static const float kAmbientShadowOpacity = (float)0.08;
   super.shadowPath = shadowPath;
   _topShadow.shadowPath = shadowPath;
   _bottomShadow.shadowPath = shadowPath;
-  if (_shadowMaskEnabled) {
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
+  if (_shadowMaskEnabled && ![self rendersShadowImage]) {
     [self configureShadowLayerMaskForLayer:_topShadowMask];
     [self configureShadowLayerMaskForLayer:_bottomShadowMask];
   }
@@ -236,6 +247,9 @@ static const float kAmbientShadowOpacity = (float)0.08;
   super.shadowColor = shadowColor;
   _topShadow.shadowColor = shadowColor;
   _bottomShadow.shadowColor = shadowColor;
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
 }
 
 #pragma mark - shouldRasterize forwarding
@@ -250,21 +264,16 @@ static const float kAmbientShadowOpacity = (float)0.08;
 
 // Returns how far aware the shadow is spread from the edge of the layer.
 + (CGSize)shadowSpreadForElevation:(CGFloat)elevation {
-  MDCShadowMetrics *metrics = [MDCShadowMetrics metricsWithElevation:elevation];
-
-  CGSize shadowSpread = CGSizeZero;
-  shadowSpread.width = MAX(metrics.topShadowRadius, metrics.bottomShadowRadius) +
-                       MAX(metrics.topShadowOffset.width, metrics.bottomShadowOffset.width);
-  shadowSpread.height = MAX(metrics.topShadowRadius, metrics.bottomShadowRadius) +
-                        MAX(metrics.topShadowOffset.height, metrics.bottomShadowOffset.height);
-
-  return shadowSpread;
+  return MDCShadowSpreadForElevation(elevation);
 }
 
 #pragma mark - Pseudo Shadow Masks
 
 - (void)setShadowMaskEnabled:(BOOL)shadowMaskEnabled {
   _shadowMaskEnabled = shadowMaskEnabled;
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
   if (_shadowMaskEnabled) {
     [self configureShadowLayerMaskForLayer:_topShadowMask];
     [self configureShadowLayerMaskForLayer:_bottomShadowMask];
@@ -312,7 +321,14 @@ static const float kAmbientShadowOpacity = (float)0.08;
 - (void)setElevation:(CGFloat)elevation {
   _elevation = elevation;
 
-  MDCShadowMetrics *shadowMetrics = [MDCShadowMetrics metricsWithElevation:elevation];
+  [self applyShadowMetricsForElevation:elevation];
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
+}
+
+- (void)applyShadowMetricsForElevation:(CGFloat)elevation {
+  MDCShadowMetricsValues shadowMetrics = MDCShadowMetricsValuesForElevation(elevation);
 
   _topShadow.shadowOffset = shadowMetrics.topShadowOffset;
   _topShadow.shadowRadius = shadowMetrics.topShadowRadius;
@@ -322,6 +338,68 @@ static const float kAmbientShadowOpacity = (float)0.08;
   _bottomShadow.shadowOpacity = shadowMetrics.bottomShadowOpacity;
 }
 
+#pragma mark - Shadow Image
+
+- (void)setShadowImageEnabled:(BOOL)shadowImageEnabled {
+  _shadowImageEnabled = shadowImageEnabled;
+  [self updateShadowImageLayer];
+  if (!_shadowImageEnabled && _shadowMaskEnabled) {
+    [self configureShadowLayerMaskForLayer:_topShadowMask];
+    [self configureShadowLayerMaskForLayer:_bottomShadowMask];
+  }
+}
+
+- (BOOL)rendersShadowImage {
+  if (!_shadowImageEnabled || self.shadowPath != NULL) {
+    return NO;
+  }
+  // Bounds smaller than the image's corner slices can't be drawn by stretching the image.
+  CGSize minimumSize = [MDCShadowImageCache minimumBoundsSizeForElevation:_elevation
+                                                             cornerRadius:self.cornerRadius];
+  CGSize size = self.bounds.size;
+  return size.width >= minimumSize.width && size.height >= minimumSize.height;
+}
+
+// Switches between the shadow image and the shadow sublayers, and keeps the image up to date with
+// the layer's appearance and bounds.
+- (void)updateShadowImageLayer {
+  BOOL rendersShadowImage = [self rendersShadowImage];
+  _topShadow.hidden = rendersShadowImage;
+  _bottomShadow.hidden = rendersShadowImage;
+
+  MDCShadowImage *shadowImage = nil;
+  if (rendersShadowImage) {
+    MDCShadowImageCache *cache = MDCShadowImageCache.sharedCache;
+    shadowImage = [cache shadowImageForElevation:_elevation
+                                    cornerRadius:self.cornerRadius
+                                     shadowColor:self.shadowColor
+                                 cutsOutInterior:_shadowMaskEnabled
+                                           scale:UIScreen.mainScreen.scale];
+  }
+  if (!shadowImage) {
+    _shadowImageLayer.hidden = YES;
+    _shadowImageLayer.contents = nil;
+    _shadowImage = nil;
+    return;
+  }
+
+  if (!_shadowImageLayer) {
+    _shadowImageLayer = [CALayer layer];
+    _shadowImageLayer.delegate = self;
+    [self insertSublayer:_shadowImageLayer below:_bottomShadow];
+  }
+  if (_shadowImage != shadowImage) {
+    _shadowImage = shadowImage;
+    _shadowImageLayer.contents = (__bridge id)shadowImage.image;
+    _shadowImageLayer.contentsScale = shadowImage.scale;
+    _shadowImageLayer.contentsCenter = shadowImage.contentsCenter;
+  }
+  UIEdgeInsets outsets = shadowImage.outsets;
+  _shadowImageLayer.frame = UIEdgeInsetsInsetRect(
+      self.bounds, UIEdgeInsetsMake(-outsets.top, -outsets.left, -outsets.bottom, -outsets.right));
+  _shadowImageLayer.hidden = NO;
+}
+
 #pragma mark - CALayerDelegate
 
 - (id<CAAction>)actionForLayer:(CALayer *)layer forKey:(NSString *)event {
@@ -349,7 +427,10 @@ static const float kAmbientShadowOpacity = (float)0.08;
   _topShadow.position = CGPointMake(CGRectGetMidX(bounds), CGRectGetMidY(bounds));
   _topShadow.bounds = bounds;
 
-  if (_shadowMaskEnabled) {
+  if (_shadowImageEnabled) {
+    [self updateShadowImageLayer];
+  }
+  if (_shadowMaskEnabled && ![self rendersShadowImage]) {
     [self configureShadowLayerMaskForLayer:_topShadowMask];
     [self configureShadowLayerMaskForLayer:_bottomShadowMask];
   }
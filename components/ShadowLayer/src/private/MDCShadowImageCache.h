@@ -0,0 +1,71 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/**
+ A pre-rendered, nine-slice stretchable image of a rounded rectangle's Material shadow.
+ */
+@interface MDCShadowImage : NSObject
+
+/** The rendered shadow. */
+@property(nonatomic, readonly, nonnull) CGImageRef image;
+
+/** The scale the image was rendered at. */
+@property(nonatomic, readonly) CGFloat scale;
+
+/**
+ How far the image extends beyond each edge of the shadowed layer's bounds, in points. Lay the
+ image out in @c UIEdgeInsetsInsetRect(bounds, negated outsets).
+ */
+@property(nonatomic, readonly) UIEdgeInsets outsets;
+
+/** The stretchable center slice, in the unit coordinate space of CALayer.contentsCenter. */
+@property(nonatomic, readonly) CGRect contentsCenter;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/**
+ A process-wide, memory-pressure-aware cache of MDCShadowImages.
+
+ Images are rendered by laying out a regular MDCShadowLayer (with its two shadow sublayers and
+ optional masks) around a rounded rectangle just large enough to contain every corner and one
+ stretchable point per axis, so a stretched image reproduces the layer tree's output.
+ */
+@interface MDCShadowImageCache : NSObject
+
+@property(class, nonatomic, readonly, nonnull) MDCShadowImageCache *sharedCache;
+
+/**
+ Returns the shadow image for the given appearance, rendering it on first use. Returns nil if the
+ elevation does not cast a shadow.
+ */
+- (nullable MDCShadowImage *)shadowImageForElevation:(CGFloat)elevation
+                                        cornerRadius:(CGFloat)cornerRadius
+                                         shadowColor:(nullable CGColorRef)shadowColor
+                                     cutsOutInterior:(BOOL)cutsOutInterior
+                                               scale:(CGFloat)scale;
+
+/**
+ The smallest bounds a shadow image for the given appearance can be stretched to. Smaller bounds
+ would make the image's fixed corner slices overlap, so they need the shadow sublayers instead.
+ */
++ (CGSize)minimumBoundsSizeForElevation:(CGFloat)elevation cornerRadius:(CGFloat)cornerRadius;
+
+/** Removes every cached image. */
+- (void)removeAllImages;
+
+@end
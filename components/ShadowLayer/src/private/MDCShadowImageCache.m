@@ -0,0 +1,155 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShadowImageCache.h"
+
+#import "MDCShadowLayer.h"
+#import "MDCShadowMetricsValues.h"
+
+/** How far the image extends beyond each edge of the shape, in points. */
+static CGSize ShadowImageMargin(CGFloat elevation) {
+  // A Gaussian shadow fades out within roughly twice its blur radius past its offset.
+  CGSize spread = MDCShadowSpreadForElevation(elevation);
+  return CGSizeMake(ceil(spread.width * 2), ceil(spread.height * 2));
+}
+
+/**
+ The distance from each edge of the shape to the stretchable center slice, in points. It keeps the
+ center slice far enough from each corner that no corner's blur reaches it.
+ */
+static CGSize ShadowImageCapInset(CGFloat elevation, CGFloat cornerRadius) {
+  CGSize margin = ShadowImageMargin(elevation);
+  CGFloat corner = ceil(MAX(cornerRadius, 0));
+  return CGSizeMake(margin.width + corner, margin.height + corner);
+}
+
+@implementation MDCShadowImage
+
+- (instancetype)initWithImage:(CGImageRef)image
+                        scale:(CGFloat)scale
+                      outsets:(UIEdgeInsets)outsets
+               contentsCenter:(CGRect)contentsCenter {
+  self = [super init];
+  if (self) {
+    _image = CGImageRetain(image);
+    _scale = scale;
+    _outsets = outsets;
+    _contentsCenter = contentsCenter;
+  }
+  return self;
+}
+
+- (void)dealloc {
+  CGImageRelease(_image);
+}
+
+@end
+
+@implementation MDCShadowImageCache {
+  NSCache<NSArray *, MDCShadowImage *> *_images;
+}
+
++ (MDCShadowImageCache *)sharedCache {
+  static MDCShadowImageCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCShadowImageCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _images = [[NSCache alloc] init];
+    _images.name = @"com.google.MaterialComponents.ShadowImageCache";
+  }
+  return self;
+}
+
+- (MDCShadowImage *)shadowImageForElevation:(CGFloat)elevation
+                               cornerRadius:(CGFloat)cornerRadius
+                                shadowColor:(CGColorRef)shadowColor
+                            cutsOutInterior:(BOOL)cutsOutInterior
+                                      scale:(CGFloat)scale {
+  if (!(elevation > 0) || !(scale > 0)) {
+    return nil;
+  }
+  cornerRadius = MAX(cornerRadius, 0);
+  UIColor *color = shadowColor ? [UIColor colorWithCGColor:shadowColor] : UIColor.blackColor;
+
+  NSArray *key = @[ @(elevation), @(cornerRadius), color, @(cutsOutInterior), @(scale) ];
+  MDCShadowImage *shadowImage = [_images objectForKey:key];
+  if (!shadowImage) {
+    shadowImage = [self renderShadowImageForElevation:elevation
+                                         cornerRadius:cornerRadius
+                                          shadowColor:color
+                                      cutsOutInterior:cutsOutInterior
+                                                scale:scale];
+    [_images setObject:shadowImage forKey:key];
+  }
+  return shadowImage;
+}
+
++ (CGSize)minimumBoundsSizeForElevation:(CGFloat)elevation cornerRadius:(CGFloat)cornerRadius {
+  CGSize capInset = ShadowImageCapInset(elevation, cornerRadius);
+  return CGSizeMake(capInset.width * 2, capInset.height * 2);
+}
+
+- (void)removeAllImages {
+  [_images removeAllObjects];
+}
+
+#pragma mark - Private
+
+- (MDCShadowImage *)renderShadowImageForElevation:(CGFloat)elevation
+                                     cornerRadius:(CGFloat)cornerRadius
+                                      shadowColor:(UIColor *)shadowColor
+                                  cutsOutInterior:(BOOL)cutsOutInterior
+                                            scale:(CGFloat)scale {
+  CGSize margin = ShadowImageMargin(elevation);
+  CGFloat marginX = margin.width;
+  CGFloat marginY = margin.height;
+
+  // Keep the stretchable center one point wide, so every row and column of it is uniform.
+  CGSize capInset = ShadowImageCapInset(elevation, cornerRadius);
+  CGFloat capX = marginX + capInset.width;
+  CGFloat capY = marginY + capInset.height;
+  CGSize shapeSize = CGSizeMake(capInset.width * 2 + 1, capInset.height * 2 + 1);
+  CGSize imageSize = CGSizeMake(shapeSize.width + marginX * 2, shapeSize.height + marginY * 2);
+
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+  shadowLayer.bounds = CGRectMake(0, 0, shapeSize.width, shapeSize.height);
+  shadowLayer.cornerRadius = cornerRadius;
+  shadowLayer.elevation = elevation;
+  shadowLayer.shadowMaskEnabled = cutsOutInterior;
+  shadowLayer.shadowColor = shadowColor.CGColor;
+  [shadowLayer layoutIfNeeded];
+
+  UIGraphicsBeginImageContextWithOptions(imageSize, NO, scale);
+  CGContextRef context = UIGraphicsGetCurrentContext();
+  CGContextTranslateCTM(context, marginX, marginY);
+  [shadowLayer renderInContext:context];
+  UIImage *image = UIGraphicsGetImageFromCurrentImageContext();
+  UIGraphicsEndImageContext();
+
+  CGRect contentsCenter = CGRectMake(capX / imageSize.width, capY / imageSize.height,
+                                     1 / imageSize.width, 1 / imageSize.height);
+  return [[MDCShadowImage alloc] initWithImage:image.CGImage
+                                         scale:scale
+                                       outsets:UIEdgeInsetsMake(marginY, marginX, marginY, marginX)
+                                contentsCenter:contentsCenter];
+}
+
+@end
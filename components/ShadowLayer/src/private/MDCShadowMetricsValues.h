@@ -0,0 +1,41 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ The values of MDCShadowMetrics as a plain struct, so they can be looked up without allocating.
+ */
+typedef struct MDCShadowMetricsValues {
+  CGFloat topShadowRadius;
+  CGSize topShadowOffset;
+  float topShadowOpacity;
+  CGFloat bottomShadowRadius;
+  CGSize bottomShadowOffset;
+  float bottomShadowOpacity;
+} MDCShadowMetricsValues;
+
+/**
+ Returns the Material shadow metrics for @c elevation.
+
+ Every metric is a linear fit of the elevation, which is cheaper to evaluate than any lookup.
+ Elevations that are not positive return empty metrics. Never allocates.
+ */
+FOUNDATION_EXTERN MDCShadowMetricsValues MDCShadowMetricsValuesForElevation(CGFloat elevation);
+
+/**
+ Returns how far the shadow for @c elevation spreads from the edge of its layer.
+ */
+FOUNDATION_EXTERN CGSize MDCShadowSpreadForElevation(CGFloat elevation);
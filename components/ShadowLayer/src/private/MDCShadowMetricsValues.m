@@ -0,0 +1,49 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShadowMetricsValues.h"
+
+static const float kKeyShadowOpacity = (float)0.26;
+static const float kAmbientShadowOpacity = (float)0.08;
+
+static CGFloat AmbientShadowBlur(CGFloat points) {
+  return (CGFloat)0.889544 * points - (CGFloat)0.003701;
+}
+
+static CGFloat KeyShadowBlur(CGFloat points) {
+  return (CGFloat)0.666920 * points - (CGFloat)0.001648;
+}
+
+static CGFloat KeyShadowYOff(CGFloat points) {
+  return (CGFloat)1.23118 * points - (CGFloat)0.03933;
+}
+
+MDCShadowMetricsValues MDCShadowMetricsValuesForElevation(CGFloat elevation) {
+  MDCShadowMetricsValues values = {0};
+  if (elevation > 0) {
+    values.topShadowRadius = AmbientShadowBlur(elevation);
+    values.topShadowOpacity = kAmbientShadowOpacity;
+    values.bottomShadowRadius = KeyShadowBlur(elevation);
+    values.bottomShadowOffset = CGSizeMake(0, KeyShadowYOff(elevation));
+    values.bottomShadowOpacity = kKeyShadowOpacity;
+  }
+  return values;
+}
+
+CGSize MDCShadowSpreadForElevation(CGFloat elevation) {
+  MDCShadowMetricsValues values = MDCShadowMetricsValuesForElevation(elevation);
+  CGFloat radius = MAX(values.topShadowRadius, values.bottomShadowRadius);
+  return CGSizeMake(radius + MAX(values.topShadowOffset.width, values.bottomShadowOffset.width),
+                    radius + MAX(values.topShadowOffset.height, values.bottomShadowOffset.height));
+}
@@ -0,0 +1,223 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShadowLayer.h"
+
+/** The result of comparing two renderings pixel by pixel. */
+typedef struct {
+  double meanDifference;
+  uint8_t maxDifference;
+} MDCShadowPixelDifference;
+
+static const CGFloat kRenderPadding = 64;
+static const CGFloat kRenderScale = 2;
+
+@interface MDCShadowLayerShadowImageTests : XCTestCase
+@end
+
+@implementation MDCShadowLayerShadowImageTests
+
+#pragma mark - Pixel diff harness
+
+/** Renders @c layer, padded so its shadow fits, into a newly allocated RGBA8 buffer. */
+- (NSData *)renderLayer:(CALayer *)layer {
+  CGSize size = CGSizeMake(CGRectGetWidth(layer.bounds) + kRenderPadding * 2,
+                           CGRectGetHeight(layer.bounds) + kRenderPadding * 2);
+  size_t width = (size_t)(size.width * kRenderScale);
+  size_t height = (size_t)(size.height * kRenderScale);
+  NSMutableData *pixels = [NSMutableData dataWithLength:width * height * 4];
+  CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB();
+  CGContextRef context =
+      CGBitmapContextCreate(pixels.mutableBytes, width, height, 8, width * 4, colorSpace,
+                            kCGImageAlphaPremultipliedLast | kCGBitmapByteOrder32Big);
+  CGColorSpaceRelease(colorSpace);
+  CGContextScaleCTM(context, kRenderScale, kRenderScale);
+  CGContextTranslateCTM(context, kRenderPadding, kRenderPadding);
+  [layer layoutIfNeeded];
+  [layer renderInContext:context];
+  CGContextRelease(context);
+  return pixels;
+}
+
+- (MDCShadowPixelDifference)differenceBetween:(NSData *)pixels and:(NSData *)otherPixels {
+  MDCShadowPixelDifference difference = {0, 0};
+  XCTAssertEqual(pixels.length, otherPixels.length);
+  const uint8_t *bytes = pixels.bytes;
+  const uint8_t *otherBytes = otherPixels.bytes;
+  NSUInteger length = MIN(pixels.length, otherPixels.length);
+  double total = 0;
+  for (NSUInteger i = 0; i < length; ++i) {
+    uint8_t channelDifference =
+        (uint8_t)(bytes[i] > otherBytes[i] ? bytes[i] - otherBytes[i] : otherBytes[i] - bytes[i]);
+    total += channelDifference;
+    difference.maxDifference = MAX(difference.maxDifference, channelDifference);
+  }
+  difference.meanDifference = length > 0 ? total / length : 0;
+  return difference;
+}
+
+- (MDCShadowLayer *)shadowLayerWithElevation:(CGFloat)elevation
+                                cornerRadius:(CGFloat)cornerRadius
+                                        size:(CGSize)size {
+  MDCShadowLayer *shadowLayer = [[MDCShadowLayer alloc] init];
+  shadowLayer.bounds = CGRectMake(0, 0, size.width, size.height);
+  shadowLayer.cornerRadius = cornerRadius;
+  shadowLayer.elevation = elevation;
+  return shadowLayer;
+}
+
+#pragma mark - Tests
+
+- (void)testShadowImageMatchesLayerTreeOutput {
+  CGFloat elevations[] = {MDCShadowElevationSwitch, MDCShadowElevationCardResting,
+                          MDCShadowElevationAppBar, MDCShadowElevationFABPressed};
+  CGFloat cornerRadii[] = {0, 4, 12};
+  for (size_t e = 0; e < sizeof(elevations) / sizeof(elevations[0]); ++e) {
+    for (size_t r = 0; r < sizeof(cornerRadii) / sizeof(cornerRadii[0]); ++r) {
+      // Given
+      MDCShadowLayer *layerTreeShadow = [self shadowLayerWithElevation:elevations[e]
+                                                          cornerRadius:cornerRadii[r]
+                                                                  size:CGSizeMake(180, 90)];
+      MDCShadowLayer *imageShadow = [self shadowLayerWithElevation:elevations[e]
+                                                      cornerRadius:cornerRadii[r]
+                                                              size:CGSizeMake(180, 90)];
+
+      // When
+      imageShadow.shadowImageEnabled = YES;
+      MDCShadowPixelDifference difference =
+          [self differenceBetween:[self renderLayer:layerTreeShadow]
+                              and:[self renderLayer:imageShadow]];
+
+      // Then
+      XCTAssertLessThan(difference.meanDifference, 1.0, @"elevation %@, corner radius %@",
+                        @(elevations[e]), @(cornerRadii[r]));
+      XCTAssertLessThanOrEqual(difference.maxDifference, 24, @"elevation %@, corner radius %@",
+                               @(elevations[e]), @(cornerRadii[r]));
+    }
+  }
+}
+
+- (void)testSmallBoundsMatchLayerTreeOutput {
+  CGFloat elevations[] = {MDCShadowElevationCardResting, MDCShadowElevationAppBar,
+                          MDCShadowElevationFABPressed};
+  CGSize sizes[] = {CGSizeMake(36, 36), CGSizeMake(64, 36)};
+  for (size_t e = 0; e < sizeof(elevations) / sizeof(elevations[0]); ++e) {
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+      // Given
+      MDCShadowLayer *layerTreeShadow = [self shadowLayerWithElevation:elevations[e]
+                                                          cornerRadius:12
+                                                                  size:sizes[s]];
+      MDCShadowLayer *imageShadow = [self shadowLayerWithElevation:elevations[e]
+                                                      cornerRadius:12
+                                                              size:sizes[s]];
+
+      // When
+      imageShadow.shadowImageEnabled = YES;
+      MDCShadowPixelDifference difference =
+          [self differenceBetween:[self renderLayer:layerTreeShadow]
+                              and:[self renderLayer:imageShadow]];
+
+      // Then
+      XCTAssertLessThan(difference.meanDifference, 1.0, @"elevation %@, size %@", @(elevations[e]),
+                        NSStringFromCGSize(sizes[s]));
+      XCTAssertLessThanOrEqual(difference.maxDifference, 24, @"elevation %@, size %@",
+                               @(elevations[e]), NSStringFromCGSize(sizes[s]));
+    }
+  }
+}
+
+- (void)testBoundsSmallerThanShadowImageCornersFallBackToShadowSublayers {
+  // Given
+  MDCShadowLayer *shadowLayer = [self shadowLayerWithElevation:MDCShadowElevationFABPressed
+                                                  cornerRadius:12
+                                                          size:CGSizeMake(64, 36)];
+
+  // When
+  shadowLayer.shadowImageEnabled = YES;
+  [shadowLayer layoutIfNeeded];
+
+  // Then
+  NSUInteger visibleSublayerCount = 0;
+  for (CALayer *sublayer in shadowLayer.sublayers) {
+    if (!sublayer.hidden) {
+      visibleSublayerCount++;
+      XCTAssertNil(sublayer.contents);
+    }
+  }
+  XCTAssertEqual(visibleSublayerCount, 2U);
+}
+
+- (void)testShadowImageHidesShadowSublayers {
+  // Given
+  MDCShadowLayer *shadowLayer = [self shadowLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4
+                                                          size:CGSizeMake(100, 100)];
+
+  // When
+  shadowLayer.shadowImageEnabled = YES;
+  [shadowLayer layoutIfNeeded];
+
+  // Then
+  NSUInteger visibleSublayerCount = 0;
+  for (CALayer *sublayer in shadowLayer.sublayers) {
+    if (!sublayer.hidden) {
+      visibleSublayerCount++;
+      XCTAssertNotNil(sublayer.contents);
+      XCTAssertNil(sublayer.mask);
+    }
+  }
+  XCTAssertEqual(visibleSublayerCount, 1U);
+}
+
+- (void)testCustomShadowPathFallsBackToShadowSublayers {
+  // Given
+  MDCShadowLayer *shadowLayer = [self shadowLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4
+                                                          size:CGSizeMake(100, 100)];
+  shadowLayer.shadowImageEnabled = YES;
+
+  // When
+  shadowLayer.shadowPath = [UIBezierPath bezierPathWithOvalInRect:shadowLayer.bounds].CGPath;
+  [shadowLayer layoutIfNeeded];
+
+  // Then
+  for (CALayer *sublayer in shadowLayer.sublayers) {
+    if (!sublayer.hidden) {
+      XCTAssertNil(sublayer.contents);
+    }
+  }
+}
+
+- (void)testShadowImageIsSharedBetweenLayers {
+  // Given
+  MDCShadowLayer *shadowLayer = [self shadowLayerWithElevation:MDCShadowElevationCardResting
+                                                  cornerRadius:4
+                                                          size:CGSizeMake(100, 100)];
+  MDCShadowLayer *otherShadowLayer = [self shadowLayerWithElevation:MDCShadowElevationCardResting
+                                                       cornerRadius:4
+                                                               size:CGSizeMake(300, 40)];
+
+  // When
+  shadowLayer.shadowImageEnabled = YES;
+  otherShadowLayer.shadowImageEnabled = YES;
+
+  // Then
+  XCTAssertNotNil(shadowLayer.sublayers.firstObject.contents);
+  XCTAssertEqual(shadowLayer.sublayers.firstObject.contents,
+                 otherShadowLayer.sublayers.firstObject.contents);
+}
+
+@end
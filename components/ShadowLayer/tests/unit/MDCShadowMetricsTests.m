@@ -0,0 +1,135 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCShadowMetricsValues.h"
+#import "MaterialShadowLayer.h"
+
+static const NSInteger kBenchmarkIterations = 100000;
+
+@interface MDCShadowMetricsTests : XCTestCase
+@end
+
+@implementation MDCShadowMetricsTests
+
+// The linear fits that MDCShadowMetrics historically evaluated for every elevation.
+- (void)assertMetrics:(MDCShadowMetrics *)metrics matchFitsForElevation:(CGFloat)elevation {
+  XCTAssertEqualWithAccuracy(metrics.topShadowRadius, 0.889544 * elevation - 0.003701, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.topShadowOffset.width, 0, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.topShadowOffset.height, 0, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.topShadowOpacity, 0.08, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.bottomShadowRadius, 0.666920 * elevation - 0.001648, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.bottomShadowOffset.width, 0, 1e-6);
+  XCTAssertEqualWithAccuracy(metrics.bottomShadowOffset.height, 1.23118 * elevation - 0.03933,
+                             1e-6);
+  XCTAssertEqualWithAccuracy(metrics.bottomShadowOpacity, 0.26, 1e-6);
+}
+
+- (void)testWholeElevationsMatchLinearFits {
+  for (CGFloat elevation = 1; elevation <= 30; elevation += 1) {
+    [self assertMetrics:[MDCShadowMetrics metricsWithElevation:elevation]
+        matchFitsForElevation:elevation];
+  }
+}
+
+- (void)testArbitraryElevationsMatchLinearFits {
+  for (CGFloat elevation = (CGFloat)0.25; elevation < 40; elevation += (CGFloat)0.75) {
+    [self assertMetrics:[MDCShadowMetrics metricsWithElevation:elevation]
+        matchFitsForElevation:elevation];
+  }
+}
+
+- (void)testNonPositiveElevationsReturnEmptyMetrics {
+  for (CGFloat elevation = -2; elevation <= 0; elevation += 1) {
+    MDCShadowMetricsValues values = MDCShadowMetricsValuesForElevation(elevation);
+    XCTAssertEqual(values.topShadowRadius, 0);
+    XCTAssertEqual(values.topShadowOpacity, 0);
+    XCTAssertEqual(values.bottomShadowRadius, 0);
+    XCTAssertEqual(values.bottomShadowOffset.height, 0);
+    XCTAssertEqual(values.bottomShadowOpacity, 0);
+  }
+}
+
+- (void)testShadowElevationConstantsShareMetrics {
+  CGFloat elevations[] = {
+      MDCShadowElevationAppBar,       MDCShadowElevationBottomAppBar,
+      MDCShadowElevationCardPickedUp, MDCShadowElevationCardResting,
+      MDCShadowElevationDialog,       MDCShadowElevationFABPressed,
+      MDCShadowElevationFABResting,   MDCShadowElevationMenu,
+      MDCShadowElevationNavDrawer,    MDCShadowElevationQuickEntry,
+      MDCShadowElevationSubMenu,      MDCShadowElevationSwitch,
+  };
+  for (size_t i = 0; i < sizeof(elevations) / sizeof(elevations[0]); ++i) {
+    XCTAssertEqual([MDCShadowMetrics metricsWithElevation:elevations[i]],
+                   [MDCShadowMetrics metricsWithElevation:elevations[i]]);
+  }
+}
+
+- (void)testFractionalAndLargeElevationsAreNotShared {
+  XCTAssertNotEqual([MDCShadowMetrics metricsWithElevation:(CGFloat)2.5],
+                    [MDCShadowMetrics metricsWithElevation:(CGFloat)2.5]);
+  XCTAssertNotEqual([MDCShadowMetrics metricsWithElevation:25],
+                    [MDCShadowMetrics metricsWithElevation:25]);
+}
+
+- (void)testShadowSpreadMatchesMetrics {
+  for (CGFloat elevation = 0; elevation <= 24; elevation += (CGFloat)0.5) {
+    MDCShadowMetrics *metrics = [MDCShadowMetrics metricsWithElevation:elevation];
+    CGFloat radius = MAX(metrics.topShadowRadius, metrics.bottomShadowRadius);
+    CGSize spread = [MDCShadowLayer shadowSpreadForElevation:elevation];
+    XCTAssertEqualWithAccuracy(spread.width, radius, 1e-6);
+    XCTAssertEqualWithAccuracy(spread.height, radius + metrics.bottomShadowOffset.height, 1e-6);
+  }
+}
+
+#pragma mark - Benchmarks
+
+// The baseline: every lookup used to allocate metrics, which fractional elevations still do.
+- (void)testAllocatedMetricsPerformance {
+  [self measureBlock:^{
+    CGFloat total = 0;
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      @autoreleasepool {
+        total += [MDCShadowMetrics metricsWithElevation:(CGFloat)(i % 24) + (CGFloat)0.5]
+                     .bottomShadowRadius;
+      }
+    }
+    XCTAssertGreaterThan(total, 0);
+  }];
+}
+
+- (void)testSharedMetricsPerformance {
+  [self measureBlock:^{
+    CGFloat total = 0;
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      @autoreleasepool {
+        total += [MDCShadowMetrics metricsWithElevation:(CGFloat)(i % 24 + 1)].bottomShadowRadius;
+      }
+    }
+    XCTAssertGreaterThan(total, 0);
+  }];
+}
+
+- (void)testMetricsValuesPerformance {
+  [self measureBlock:^{
+    CGFloat total = 0;
+    for (NSInteger i = 0; i < kBenchmarkIterations; ++i) {
+      total += MDCShadowMetricsValuesForElevation((CGFloat)(i % 24)).bottomShadowRadius;
+    }
+    XCTAssertGreaterThan(total, 0);
+  }];
+}
+
+@end
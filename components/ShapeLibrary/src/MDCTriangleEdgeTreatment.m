@@ -38,4 +38,19 @@
   return [[[self class] alloc] initWithSize:_size style:_style];
 }
 
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (!object || ![[object class] isEqual:[self class]]) {
+    return NO;
+  }
+  MDCTriangleEdgeTreatment *otherEdge = (MDCTriangleEdgeTreatment *)object;
+  return self.size == otherEdge.size && self.style == otherEdge.style;
+}
+
+- (NSUInteger)hash {
+  return @(self.size).hash ^ (NSUInteger)self.style;
+}
+
 @end
@@ -79,6 +79,44 @@ void GetCGPathAddLineToPointValues(void *info, const CGPathElement *element);
   XCTAssertEqualObjects(cutCorner, cutCorner);
 }
 
+- (void)testTriangleEdgeEquality {
+  // Given
+  MDCTriangleEdgeTreatment *edge =
+      [[MDCTriangleEdgeTreatment alloc] initWithSize:(CGFloat)3.2 style:MDCTriangleEdgeStyleCut];
+  MDCTriangleEdgeTreatment *edge2 =
+      [[MDCTriangleEdgeTreatment alloc] initWithSize:(CGFloat)4.3 style:MDCTriangleEdgeStyleHandle];
+
+  // When
+  XCTAssertNotEqualObjects(edge, edge2);
+  edge2.size = (CGFloat)3.2;
+  XCTAssertNotEqualObjects(edge, edge2);
+  edge2.style = MDCTriangleEdgeStyleCut;
+
+  // Then
+  XCTAssertEqual(edge.hash, edge2.hash);
+  XCTAssertEqualObjects(edge, edge2);
+  XCTAssertNotEqualObjects(edge, [[MDCEdgeTreatment alloc] init]);
+}
+
+- (void)testPathCacheDistinguishesRoundedCornerRadii {
+  // Given
+  MDCShapePathCache *pathCache = [[MDCShapePathCache alloc] init];
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  [generator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:4]];
+  generator.pathCache = pathCache;
+  CGPathRef smallRadiusPath = CGPathRetain([generator pathForSize:CGSizeMake(100, 100)]);
+
+  // When
+  [generator setCorners:[[MDCRoundedCornerTreatment alloc] initWithRadius:8]];
+  CGPathRef largeRadiusPath = [generator pathForSize:CGSizeMake(100, 100)];
+
+  // Then
+  XCTAssertEqual(pathCache.missCount, 2U);
+  XCTAssertEqual(pathCache.hitCount, 0U);
+  XCTAssertFalse(CGPathEqualToPath(smallRadiusPath, largeRadiusPath));
+  CGPathRelease(smallRadiusPath);
+}
+
 - (void)testPercentageValueInequalityForCorners {
   // Given
   MDCCutCornerTreatment *corner = [[MDCCutCornerTreatment alloc] initWithCut:(CGFloat)3.2];
@@ -14,42 +14,10 @@
 
 #import "MDCPathGenerator.h"
 
-
-@interface MDCPathCommand : NSObject
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform;
-@end
-
-@interface MDCPathLineCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint point;
-@end
-
-@interface MDCPathArcCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint point;
-@property(nonatomic, assign) CGFloat radius;
-@property(nonatomic, assign) CGFloat startAngle;
-@property(nonatomic, assign) CGFloat endAngle;
-@property(nonatomic, assign) BOOL clockwise;
-@end
-
-@interface MDCPathArcToCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint start;
-@property(nonatomic, assign) CGPoint end;
-@property(nonatomic, assign) CGFloat radius;
-@end
-
-@interface MDCPathCurveCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint control1;
-@property(nonatomic, assign) CGPoint control2;
-@property(nonatomic, assign) CGPoint end;
-@end
-
-@interface MDCPathQuadCurveCommand : MDCPathCommand
-@property(nonatomic, assign) CGPoint control;
-@property(nonatomic, assign) CGPoint end;
-@end
+#import "private/MDCPathCommandBuffer.h"
 
 @implementation MDCPathGenerator {
-  NSMutableArray *_operations;
+  MDCPathCommandBuffer _commands;
   CGPoint _startPoint;
   CGPoint _endPoint;
 }
@@ -64,7 +32,7 @@
 
 - (instancetype)initWithStartPoint:(CGPoint)start {
   if (self = [super init]) {
-    _operations = [NSMutableArray array];
+    MDCPathCommandBufferInit(&_commands);
 
     _startPoint = start;
     _endPoint = start;
@@ -72,10 +40,14 @@
   return self;
 }
 
+- (void)dealloc {
+  MDCPathCommandBufferDestroy(&_commands);
+}
+
 - (void)addLineToPoint:(CGPoint)point {
-  MDCPathLineCommand *op = [[MDCPathLineCommand alloc] init];
-  op.point = point;
-  [_operations addObject:op];
+  MDCPathCommand command = {.type = MDCPathCommandTypeLine};
+  command.line.point = point;
+  MDCPathCommandBufferAppend(&_commands, &command);
 
   _endPoint = point;
 }
@@ -85,13 +57,13 @@
               startAngle:(CGFloat)startAngle
                 endAngle:(CGFloat)endAngle
                clockwise:(BOOL)clockwise {
-  MDCPathArcCommand *op = [[MDCPathArcCommand alloc] init];
-  op.point = center;
-  op.radius = radius;
-  op.startAngle = startAngle;
-  op.endAngle = endAngle;
-  op.clockwise = clockwise;
-  [_operations addObject:op];
+  MDCPathCommand command = {.type = MDCPathCommandTypeArc};
+  command.arc.center = center;
+  command.arc.radius = radius;
+  command.arc.startAngle = startAngle;
+  command.arc.endAngle = endAngle;
+  command.arc.clockwise = clockwise;
+  MDCPathCommandBufferAppend(&_commands, &command);
 
   _endPoint =
       CGPointMake(center.x + radius * cos(endAngle), center.y + radius * sin(endAngle));
@@ -100,11 +72,11 @@
 - (void)addArcWithTangentPoint:(CGPoint)tangentPoint
                        toPoint:(CGPoint)toPoint
                         radius:(CGFloat)radius {
-  MDCPathArcToCommand *op = [[MDCPathArcToCommand alloc] init];
-  op.start = tangentPoint;
-  op.end = toPoint;
-  op.radius = radius;
-  [_operations addObject:op];
+  MDCPathCommand command = {.type = MDCPathCommandTypeArcTo};
+  command.arcTo.tangentPoint = tangentPoint;
+  command.arcTo.toPoint = toPoint;
+  command.arcTo.radius = radius;
+  MDCPathCommandBufferAppend(&_commands, &command);
 
   _endPoint = toPoint;
 }
@@ -112,79 +84,26 @@
 - (void)addCurveWithControlPoint1:(CGPoint)controlPoint1
                     controlPoint2:(CGPoint)controlPoint2
                           toPoint:(CGPoint)toPoint {
-  MDCPathCurveCommand *op = [[MDCPathCurveCommand alloc] init];
-  op.control1 = controlPoint1;
-  op.control2 = controlPoint2;
-  op.end = toPoint;
-  [_operations addObject:op];
+  MDCPathCommand command = {.type = MDCPathCommandTypeCurve};
+  command.curve.controlPoint1 = controlPoint1;
+  command.curve.controlPoint2 = controlPoint2;
+  command.curve.toPoint = toPoint;
+  MDCPathCommandBufferAppend(&_commands, &command);
 
   _endPoint = toPoint;
 }
 
 - (void)addQuadCurveWithControlPoint:(CGPoint)controlPoint toPoint:(CGPoint)toPoint {
-  MDCPathQuadCurveCommand *op = [[MDCPathQuadCurveCommand alloc] init];
-  op.control = controlPoint;
-  op.end = toPoint;
-  [_operations addObject:op];
+  MDCPathCommand command = {.type = MDCPathCommandTypeQuadCurve};
+  command.quadCurve.controlPoint = controlPoint;
+  command.quadCurve.toPoint = toPoint;
+  MDCPathCommandBufferAppend(&_commands, &command);
 
   _endPoint = toPoint;
 }
 
 - (void)appendToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  for (MDCPathCommand *op in _operations) {
-    [op applyToCGPath:cgPath transform:transform];
-  }
-}
-
-@end
-
-@implementation MDCPathCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)__unused cgPath
-            transform:(CGAffineTransform *)__unused transform {
-  // no-op
-}
-
-@end
-
-@implementation MDCPathLineCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddLineToPoint(cgPath, transform, self.point.x, self.point.y);
-}
-
-@end
-
-@implementation MDCPathArcCommand
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddArc(cgPath, transform, self.point.x, self.point.y, self.radius, self.startAngle,
-               self.endAngle, self.clockwise);
-}
-@end
-
-@implementation MDCPathArcToCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddArcToPoint(cgPath, transform, self.start.x, self.start.y, self.end.x, self.end.y,
-                      self.radius);
-}
-
-@end
-
-@implementation MDCPathCurveCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddCurveToPoint(cgPath, transform, self.control1.x, self.control1.y, self.control2.x,
-                        self.control2.y, self.end.x, self.end.y);
-}
-
-@end
-
-@implementation MDCPathQuadCurveCommand
-
-- (void)applyToCGPath:(CGMutablePathRef)cgPath transform:(CGAffineTransform *)transform {
-  CGPathAddQuadCurveToPoint(cgPath, transform, self.control.x, self.control.y, self.end.x,
-                            self.end.y);
+  MDCPathCommandBufferAppendToCGPath(&_commands, cgPath, transform);
 }
 
 @end
@@ -18,6 +18,7 @@
 
 @class MDCCornerTreatment;
 @class MDCEdgeTreatment;
+@class MDCShapePathCache;
 
 /**
  An MDCShapeGenerating for creating shaped rectanglular CGPaths.
@@ -51,6 +52,22 @@
 @property(nonatomic, strong) MDCEdgeTreatment *bottomEdge;
 @property(nonatomic, strong) MDCEdgeTreatment *leftEdge;
 
+/**
+ An optional cache of generated paths.
+
+ When set, @c pathForSize: looks up its result by the requested size and the current corner
+ offsets and corner and edge treatments before generating a new path. Set this to
+ @c MDCShapePathCache.sharedCache to share generated paths between every generator describing the
+ same shape, such as the identically shaped cards of a collection.
+
+ Corner treatments must implement @c isEqual: and @c hash so that treatments producing different
+ paths are never equal. Edge treatments other than plain @c MDCEdgeTreatment instances only share
+ cached paths if they implement value equality, as the ShapeLibrary edge treatments do.
+
+ Defaults to nil, meaning paths are generated on every call.
+ */
+@property(nonatomic, strong) MDCShapePathCache *pathCache;
+
 /**
  Convenience to set all corners to the same MDCCornerTreatment instance.
  */
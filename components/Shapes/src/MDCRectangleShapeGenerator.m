@@ -17,6 +17,7 @@
 #import "MDCCornerTreatment.h"
 #import "MDCEdgeTreatment.h"
 #import "MDCPathGenerator.h"
+#import "MDCShapePathCache.h"
 
 static inline CGFloat CGPointDistanceToPoint(CGPoint a, CGPoint b) {
   return hypot(a.x - b.x, a.y - b.y);
@@ -38,7 +39,123 @@ typedef enum : NSUInteger {
   MDCShapeCornerBottomLeft,
 } MDCShapeCornerPosition;
 
-@implementation MDCRectangleShapeGenerator
+/**
+ Whether two edge treatments generate the same path. Plain MDCEdgeTreatments are stateless straight
+ edges, so any two of them are interchangeable. Other treatments compare with @c isEqual:, which is
+ identity unless the treatment opts in to value equality.
+ */
+static BOOL EdgeTreatmentsAreEquivalent(MDCEdgeTreatment *edge, MDCEdgeTreatment *otherEdge) {
+  if (edge == otherEdge) {
+    return YES;
+  }
+  if ([edge class] == [MDCEdgeTreatment class] && [otherEdge class] == [MDCEdgeTreatment class]) {
+    return YES;
+  }
+  return [edge isEqual:otherEdge];
+}
+
+/** A hash consistent with EdgeTreatmentsAreEquivalent. */
+static NSUInteger EdgeTreatmentHash(MDCEdgeTreatment *edge) {
+  if ([edge class] == [MDCEdgeTreatment class]) {
+    return [MDCEdgeTreatment hash];
+  }
+  return edge.hash;
+}
+
+/**
+ Describes everything a MDCRectangleShapeGenerator path depends on. Lookup keys reference the
+ generator's live treatments; copies (which are what MDCShapePathCache stores) snapshot them.
+ */
+@interface MDCRectangleShapePathCacheKey : NSObject <NSCopying>
+/** Refills the key in place, so a generator can reuse one lookup key across calls. */
+- (void)updateWithGenerator:(MDCRectangleShapeGenerator *)generator size:(CGSize)size;
+@end
+
+@implementation MDCRectangleShapePathCacheKey {
+  Class _generatorClass;
+  CGSize _size;
+  CGPoint _cornerOffsets[4];
+  MDCCornerTreatment *_corners[4];
+  MDCEdgeTreatment *_edges[4];
+  NSUInteger _hash;
+}
+
+- (void)updateWithGenerator:(MDCRectangleShapeGenerator *)generator size:(CGSize)size {
+  _generatorClass = [generator class];
+  _size = size;
+  _corners[MDCShapeCornerTopLeft] = generator.topLeftCorner;
+  _corners[MDCShapeCornerTopRight] = generator.topRightCorner;
+  _corners[MDCShapeCornerBottomRight] = generator.bottomRightCorner;
+  _corners[MDCShapeCornerBottomLeft] = generator.bottomLeftCorner;
+  _cornerOffsets[MDCShapeCornerTopLeft] = generator.topLeftCornerOffset;
+  _cornerOffsets[MDCShapeCornerTopRight] = generator.topRightCornerOffset;
+  _cornerOffsets[MDCShapeCornerBottomRight] = generator.bottomRightCornerOffset;
+  _cornerOffsets[MDCShapeCornerBottomLeft] = generator.bottomLeftCornerOffset;
+  _edges[MDCShapeEdgeTop] = generator.topEdge;
+  _edges[MDCShapeEdgeRight] = generator.rightEdge;
+  _edges[MDCShapeEdgeBottom] = generator.bottomEdge;
+  _edges[MDCShapeEdgeLeft] = generator.leftEdge;
+  [self computeHash];
+}
+
+- (void)computeHash {
+  NSUInteger hash = [_generatorClass hash];
+  hash = hash * 31 + @(_size.width).hash;
+  hash = hash * 31 + @(_size.height).hash;
+  for (NSInteger i = 0; i < 4; i++) {
+    hash = hash * 31 + _corners[i].hash;
+    hash = hash * 31 + EdgeTreatmentHash(_edges[i]);
+    hash = hash * 31 + @(_cornerOffsets[i].x).hash;
+    hash = hash * 31 + @(_cornerOffsets[i].y).hash;
+  }
+  _hash = hash;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  MDCRectangleShapePathCacheKey *copy = [[[self class] alloc] init];
+  copy->_generatorClass = _generatorClass;
+  copy->_size = _size;
+  for (NSInteger i = 0; i < 4; i++) {
+    copy->_corners[i] = [_corners[i] copyWithZone:zone];
+    copy->_edges[i] = [_edges[i] copyWithZone:zone];
+    copy->_cornerOffsets[i] = _cornerOffsets[i];
+  }
+  copy->_hash = _hash;
+  return copy;
+}
+
+- (BOOL)isEqual:(id)object {
+  if (object == self) {
+    return YES;
+  }
+  if (![object isKindOfClass:[MDCRectangleShapePathCacheKey class]]) {
+    return NO;
+  }
+  MDCRectangleShapePathCacheKey *otherKey = (MDCRectangleShapePathCacheKey *)object;
+  if (_hash != otherKey->_hash || _generatorClass != otherKey->_generatorClass ||
+      !CGSizeEqualToSize(_size, otherKey->_size)) {
+    return NO;
+  }
+  for (NSInteger i = 0; i < 4; i++) {
+    if (!CGPointEqualToPoint(_cornerOffsets[i], otherKey->_cornerOffsets[i]) ||
+        !(_corners[i] == otherKey->_corners[i] || [_corners[i] isEqual:otherKey->_corners[i]]) ||
+        !EdgeTreatmentsAreEquivalent(_edges[i], otherKey->_edges[i])) {
+      return NO;
+    }
+  }
+  return YES;
+}
+
+- (NSUInteger)hash {
+  return _hash;
+}
+
+@end
+
+@implementation MDCRectangleShapeGenerator {
+  // Reused for every cache lookup; MDCShapePathCache copies it only when a path is stored.
+  MDCRectangleShapePathCacheKey *_pathCacheLookupKey;
+}
 
 - (instancetype)init {
   if (self = [super init]) {
@@ -66,6 +183,8 @@ typedef enum : NSUInteger {
   copy.bottomEdge = [copy.bottomEdge copyWithZone:zone];
   copy.leftEdge = [copy.leftEdge copyWithZone:zone];
 
+  copy.pathCache = self.pathCache;
+
   return copy;
 }
 
@@ -123,6 +242,27 @@ typedef enum : NSUInteger {
 }
 
 - (CGPathRef)pathForSize:(CGSize)size {
+  MDCShapePathCache *pathCache = self.pathCache;
+  if (!pathCache) {
+    return [self generatePathForSize:size];
+  }
+
+  // Key cached paths by the same size the path is generated for, so a negative size and its
+  // standardized counterpart can't map to different entries.
+  CGSize standardizedSize = CGRectStandardize(CGRectMake(0, 0, size.width, size.height)).size;
+  if (!_pathCacheLookupKey) {
+    _pathCacheLookupKey = [[MDCRectangleShapePathCacheKey alloc] init];
+  }
+  [_pathCacheLookupKey updateWithGenerator:self size:standardizedSize];
+  CGPathRef path = [pathCache pathForKey:_pathCacheLookupKey];
+  if (!path) {
+    path = [self generatePathForSize:standardizedSize];
+    [pathCache setPath:path forKey:_pathCacheLookupKey];
+  }
+  return path;
+}
+
+- (CGPathRef)generatePathForSize:(CGSize)size {
   CGMutablePathRef path = CGPathCreateMutable();
   MDCPathGenerator *cornerPaths[4];
   CGAffineTransform cornerTransforms[4];
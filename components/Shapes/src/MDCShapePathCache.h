@@ -0,0 +1,82 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ A bounded, least-recently-used cache of generated CGPaths.
+
+ Shape generators that opt in to a path cache look up their generated path by a key describing
+ everything the path depends on (for example the size and the corner and edge treatments). Shape
+ generators that share a cache and describe identical shapes will share a single generated path.
+
+ Keys are copied when a path is stored, so mutating the objects a key was built from after the
+ fact does not affect the cached entry.
+
+ MDCShapePathCache is thread-safe.
+ */
+@interface MDCShapePathCache : NSObject
+
+/**
+ A process-wide cache that can be shared by every shape generator in the app.
+ */
+@property(class, nonatomic, readonly, nonnull) MDCShapePathCache *sharedCache;
+
+/**
+ The maximum number of paths held by the cache. When the limit is exceeded, the least recently
+ used path is evicted.
+
+ Defaults to 128.
+ */
+@property(nonatomic, assign) NSUInteger countLimit;
+
+/**
+ The number of paths currently held by the cache.
+ */
+@property(nonatomic, readonly) NSUInteger count;
+
+/**
+ The number of lookups that found a cached path.
+ */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of lookups that did not find a cached path.
+ */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns the path stored for @c key, or NULL if there is none, and updates the hit/miss counters.
+ The returned path is autoreleased, so it stays valid even if it is evicted afterwards.
+ */
+- (nullable CGPathRef)pathForKey:(nonnull id<NSCopying>)key;
+
+/**
+ Stores an immutable copy of @c path for @c key, evicting the least recently used path if the
+ count limit is exceeded.
+ */
+- (void)setPath:(nonnull CGPathRef)path forKey:(nonnull id<NSCopying>)key;
+
+/**
+ Removes every cached path. Does not reset the hit/miss counters.
+ */
+- (void)removeAllPaths;
+
+/**
+ Resets the hit and miss counters to zero.
+ */
+- (void)resetStatistics;
+
+@end
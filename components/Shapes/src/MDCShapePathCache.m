@@ -0,0 +1,177 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCShapePathCache.h"
+
+static const NSUInteger kDefaultCountLimit = 128;
+
+/**
+ A cached path and its copied key, linked into the cache's recency list so a hit can be moved to the
+ most recently used end without searching for it.
+ */
+@interface MDCShapePathCacheEntry : NSObject {
+ @public
+  id _key;
+  CGPathRef _path;
+  __unsafe_unretained MDCShapePathCacheEntry *_previous;
+  __unsafe_unretained MDCShapePathCacheEntry *_next;
+}
+@end
+
+@implementation MDCShapePathCacheEntry
+
+- (void)dealloc {
+  CGPathRelease(_path);
+}
+
+@end
+
+@implementation MDCShapePathCache {
+  // Maps copied keys to their entries, and owns the entries. NSMapTable is used because, unlike
+  // NSDictionary, it does not copy keys a second time.
+  NSMapTable<id, MDCShapePathCacheEntry *> *_entries;
+  // The ends of the recency list threaded through the entries.
+  __unsafe_unretained MDCShapePathCacheEntry *_leastRecentlyUsedEntry;
+  __unsafe_unretained MDCShapePathCacheEntry *_mostRecentlyUsedEntry;
+  NSUInteger _hitCount;
+  NSUInteger _missCount;
+}
+
++ (MDCShapePathCache *)sharedCache {
+  static MDCShapePathCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCShapePathCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _countLimit = kDefaultCountLimit;
+    _entries = [NSMapTable strongToStrongObjectsMapTable];
+  }
+  return self;
+}
+
+- (NSUInteger)count {
+  @synchronized(self) {
+    return _entries.count;
+  }
+}
+
+- (NSUInteger)hitCount {
+  @synchronized(self) {
+    return _hitCount;
+  }
+}
+
+- (NSUInteger)missCount {
+  @synchronized(self) {
+    return _missCount;
+  }
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit {
+  @synchronized(self) {
+    _countLimit = countLimit;
+    [self evictPathsExceedingCountLimit];
+  }
+}
+
+- (CGPathRef)pathForKey:(id<NSCopying>)key {
+  @synchronized(self) {
+    MDCShapePathCacheEntry *entry = [_entries objectForKey:key];
+    if (!entry) {
+      _missCount++;
+      return NULL;
+    }
+    _hitCount++;
+    [self unlinkEntry:entry];
+    [self appendEntry:entry];
+    return (CGPathRef)CFAutorelease(CGPathRetain(entry->_path));
+  }
+}
+
+- (void)setPath:(CGPathRef)path forKey:(id<NSCopying>)key {
+  MDCShapePathCacheEntry *entry = [[MDCShapePathCacheEntry alloc] init];
+  entry->_key = [(id)key copyWithZone:NULL];
+  entry->_path = CGPathCreateCopy(path);
+  @synchronized(self) {
+    MDCShapePathCacheEntry *existingEntry = [_entries objectForKey:entry->_key];
+    if (existingEntry) {
+      [self unlinkEntry:existingEntry];
+      [_entries removeObjectForKey:existingEntry->_key];
+    }
+    [_entries setObject:entry forKey:entry->_key];
+    [self appendEntry:entry];
+    [self evictPathsExceedingCountLimit];
+  }
+}
+
+- (void)removeAllPaths {
+  @synchronized(self) {
+    [_entries removeAllObjects];
+    _leastRecentlyUsedEntry = nil;
+    _mostRecentlyUsedEntry = nil;
+  }
+}
+
+- (void)resetStatistics {
+  @synchronized(self) {
+    _hitCount = 0;
+    _missCount = 0;
+  }
+}
+
+#pragma mark - Private
+
+// The following must be called while synchronized on self.
+
+- (void)appendEntry:(MDCShapePathCacheEntry *)entry {
+  entry->_previous = _mostRecentlyUsedEntry;
+  entry->_next = nil;
+  if (_mostRecentlyUsedEntry) {
+    _mostRecentlyUsedEntry->_next = entry;
+  } else {
+    _leastRecentlyUsedEntry = entry;
+  }
+  _mostRecentlyUsedEntry = entry;
+}
+
+- (void)unlinkEntry:(MDCShapePathCacheEntry *)entry {
+  if (entry->_previous) {
+    entry->_previous->_next = entry->_next;
+  } else {
+    _leastRecentlyUsedEntry = entry->_next;
+  }
+  if (entry->_next) {
+    entry->_next->_previous = entry->_previous;
+  } else {
+    _mostRecentlyUsedEntry = entry->_previous;
+  }
+  entry->_previous = nil;
+  entry->_next = nil;
+}
+
+- (void)evictPathsExceedingCountLimit {
+  while (_entries.count > _countLimit) {
+    MDCShapePathCacheEntry *leastRecentlyUsedEntry = _leastRecentlyUsedEntry;
+    [self unlinkEntry:leastRecentlyUsedEntry];
+    [_entries removeObjectForKey:leastRecentlyUsedEntry->_key];
+  }
+}
+
+@end
@@ -20,7 +20,30 @@
 // An epsilon for use with width/height values.
 static const CGFloat kDimensionalEpsilon = 0.001;
 
-@implementation MDCShapedShadowLayer
+static BOOL MDCShapedShadowLayerPathsAreEqual(CGPathRef path, CGPathRef otherPath) {
+  if (path == otherPath) {
+    return YES;
+  }
+  if (path == NULL || otherPath == NULL) {
+    return NO;
+  }
+  return CGPathEqualToPath(path, otherPath);
+}
+
+static BOOL MDCShapedShadowLayerColorsAreEqual(CGColorRef color, CGColorRef otherColor) {
+  if (color == otherColor) {
+    return YES;
+  }
+  if (color == NULL || otherColor == NULL) {
+    return NO;
+  }
+  return CGColorEqualToColor(color, otherColor);
+}
+
+@implementation MDCShapedShadowLayer {
+  // The shaped border width that the color and shape layer paths were last generated for.
+  CGFloat _colorPathBorderWidth;
+}
 
 - (instancetype)init {
   self = [super init];
@@ -87,6 +110,16 @@ static const CGFloat kDimensionalEpsilon = 0.001;
 }
 
 - (void)setPath:(CGPathRef)path {
+  // Layout passes frequently regenerate an identical path. Every sublayer already reflects the
+  // current colors and border width, so there is nothing to update as long as the layers still hold
+  // that path. Views reset shadowPath directly before applying a shape generator, so compare
+  // against the layers rather than against the last path passed in.
+  if (path != NULL && MDCShapedShadowLayerPathsAreEqual(path, self.shadowPath) &&
+      _colorLayer.path != NULL && _shapeLayer.path != NULL) {
+    _pathRebuildsAvoidedCount++;
+    return;
+  }
+
   self.shadowPath = path;
   _colorLayer.path = path;
   _shapeLayer.path = path;
@@ -112,6 +145,7 @@ static const CGFloat kDimensionalEpsilon = 0.001;
 }
 
 - (void)generateColorPathGivenLineWidth {
+  _colorPathBorderWidth = self.shapedBorderWidth;
   if (CGPathIsEmpty(self.path) || _colorLayer.lineWidth <= 0) {
     _colorLayer.path = self.shadowPath;
     _shapeLayer.path = self.shadowPath;
@@ -174,13 +208,20 @@ static const CGFloat kDimensionalEpsilon = 0.001;
 }
 
 - (void)setShapedBackgroundColor:(UIColor *)shapedBackgroundColor {
-  _shapedBackgroundColor = shapedBackgroundColor;
-
   if ([self.delegate isKindOfClass:[UIView class]]) {
     UIView *view = (UIView *)self.delegate;
-    _shapedBackgroundColor =
-        [_shapedBackgroundColor mdc_resolvedColorWithTraitCollection:view.traitCollection];
+    shapedBackgroundColor =
+        [shapedBackgroundColor mdc_resolvedColorWithTraitCollection:view.traitCollection];
+  }
+  // A dynamic color can resolve differently than when it was applied, so compare the resolved
+  // color with the one on the layers too.
+  CGColorRef appliedColor = CGPathIsEmpty(self.path) ? self.backgroundColor : _colorLayer.fillColor;
+  if ((shapedBackgroundColor == _shapedBackgroundColor ||
+       [shapedBackgroundColor isEqual:_shapedBackgroundColor]) &&
+      MDCShapedShadowLayerColorsAreEqual(shapedBackgroundColor.CGColor, appliedColor)) {
+    return;
   }
+  _shapedBackgroundColor = [shapedBackgroundColor copy];
 
   if (CGPathIsEmpty(self.path)) {
     self.backgroundColor = _shapedBackgroundColor.CGColor;
@@ -192,13 +233,17 @@ static const CGFloat kDimensionalEpsilon = 0.001;
 }
 
 - (void)setShapedBorderColor:(UIColor *)shapedBorderColor {
-  _shapedBorderColor = shapedBorderColor;
-
   if ([self.delegate isKindOfClass:[UIView class]]) {
     UIView *view = (UIView *)self.delegate;
-    _shapedBorderColor =
-        [_shapedBorderColor mdc_resolvedColorWithTraitCollection:view.traitCollection];
+    shapedBorderColor =
+        [shapedBorderColor mdc_resolvedColorWithTraitCollection:view.traitCollection];
+  }
+  CGColorRef appliedColor = CGPathIsEmpty(self.path) ? self.borderColor : _colorLayer.strokeColor;
+  if ((shapedBorderColor == _shapedBorderColor || [shapedBorderColor isEqual:_shapedBorderColor]) &&
+      MDCShapedShadowLayerColorsAreEqual(shapedBorderColor.CGColor, appliedColor)) {
+    return;
   }
+  _shapedBorderColor = [shapedBorderColor copy];
   if (CGPathIsEmpty(self.path)) {
     self.borderColor = _shapedBorderColor.CGColor;
     _colorLayer.strokeColor = nil;
@@ -217,7 +262,12 @@ static const CGFloat kDimensionalEpsilon = 0.001;
   } else {
     self.borderWidth = 0;
     _colorLayer.lineWidth = _shapedBorderWidth;
-    [self generateColorPathGivenLineWidth];
+    // The color and shape layer paths only depend on the border width, not on the border color.
+    if (_shapedBorderWidth == _colorPathBorderWidth) {
+      _pathRebuildsAvoidedCount++;
+    } else {
+      [self generateColorPathGivenLineWidth];
+    }
   }
 }
 
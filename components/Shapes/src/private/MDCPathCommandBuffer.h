@@ -0,0 +1,104 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/*
+ A contiguous buffer of plain-old-data path commands backing MDCPathGenerator.
+
+ Each command is a tagged union, so recording a line, arc or curve is a struct copy into the
+ buffer rather than an object allocation. The first kMDCPathCommandBufferInlineCapacity commands
+ are stored inline, which covers the four corners and four edges of a rectangle shape without
+ touching the heap. Larger paths spill over into a single malloc'd array that grows geometrically.
+
+ The buffer is UIKit-free; only MDCPathCommandBufferAppendToCGPath depends on CoreGraphics. A
+ buffer refers to its own inline storage, so it must not be copied by value once initialized.
+ */
+
+/** The number of commands that can be recorded before the buffer allocates. */
+#define kMDCPathCommandBufferInlineCapacity 8
+
+typedef NS_ENUM(uint8_t, MDCPathCommandType) {
+  MDCPathCommandTypeLine = 0,
+  MDCPathCommandTypeArc,
+  MDCPathCommandTypeArcTo,
+  MDCPathCommandTypeCurve,
+  MDCPathCommandTypeQuadCurve,
+};
+
+typedef struct MDCPathCommand {
+  MDCPathCommandType type;
+  union {
+    struct {
+      CGPoint point;
+    } line;
+    struct {
+      CGPoint center;
+      CGFloat radius;
+      CGFloat startAngle;
+      CGFloat endAngle;
+      BOOL clockwise;
+    } arc;
+    struct {
+      CGPoint tangentPoint;
+      CGPoint toPoint;
+      CGFloat radius;
+    } arcTo;
+    struct {
+      CGPoint controlPoint1;
+      CGPoint controlPoint2;
+      CGPoint toPoint;
+    } curve;
+    struct {
+      CGPoint controlPoint;
+      CGPoint toPoint;
+    } quadCurve;
+  };
+} MDCPathCommand;
+
+typedef struct MDCPathCommandBuffer {
+  NSUInteger count;
+  NSUInteger capacity;
+  /** Points at @c inlineCommands until the buffer outgrows it, then at a heap allocation. */
+  MDCPathCommand *commands;
+  MDCPathCommand inlineCommands[kMDCPathCommandBufferInlineCapacity];
+} MDCPathCommandBuffer;
+
+/** Prepares an empty buffer that uses its inline storage. */
+void MDCPathCommandBufferInit(MDCPathCommandBuffer *_Nonnull buffer);
+
+/** Releases any heap storage owned by the buffer and resets it to empty. */
+void MDCPathCommandBufferDestroy(MDCPathCommandBuffer *_Nonnull buffer);
+
+/** Appends a copy of @c command to the end of the buffer. */
+void MDCPathCommandBufferAppend(MDCPathCommandBuffer *_Nonnull buffer,
+                                const MDCPathCommand *_Nonnull command);
+
+/** Returns YES if the buffer has spilled over into heap storage. */
+static inline BOOL MDCPathCommandBufferUsesHeapStorage(
+    const MDCPathCommandBuffer *_Nonnull buffer) {
+  return buffer->commands != buffer->inlineCommands;
+}
+
+/**
+ Replays every recorded command onto @c cgPath, applying @c transform to each one.
+
+ @param buffer The recorded commands.
+ @param cgPath A mutable CGPath to which the commands will be appended.
+ @param transform The transform applied to each command, or NULL.
+ */
+void MDCPathCommandBufferAppendToCGPath(const MDCPathCommandBuffer *_Nonnull buffer,
+                                        CGMutablePathRef _Nonnull cgPath,
+                                        const CGAffineTransform *_Nullable transform);
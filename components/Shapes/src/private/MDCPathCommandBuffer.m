@@ -0,0 +1,93 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCPathCommandBuffer.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+void MDCPathCommandBufferInit(MDCPathCommandBuffer *buffer) {
+  buffer->count = 0;
+  buffer->capacity = kMDCPathCommandBufferInlineCapacity;
+  buffer->commands = buffer->inlineCommands;
+}
+
+void MDCPathCommandBufferDestroy(MDCPathCommandBuffer *buffer) {
+  if (MDCPathCommandBufferUsesHeapStorage(buffer)) {
+    free(buffer->commands);
+  }
+  MDCPathCommandBufferInit(buffer);
+}
+
+static void MDCPathCommandBufferGrow(MDCPathCommandBuffer *buffer) {
+  NSUInteger newCapacity = buffer->capacity * 2;
+  MDCPathCommand *newCommands;
+  if (MDCPathCommandBufferUsesHeapStorage(buffer)) {
+    newCommands = realloc(buffer->commands, newCapacity * sizeof(MDCPathCommand));
+  } else {
+    newCommands = malloc(newCapacity * sizeof(MDCPathCommand));
+    if (newCommands) {
+      memcpy(newCommands, buffer->inlineCommands, buffer->count * sizeof(MDCPathCommand));
+    }
+  }
+  if (!newCommands) {
+    [NSException raise:NSMallocException
+                format:@"Unable to grow path command buffer to %lu commands.",
+                       (unsigned long)newCapacity];
+  }
+  buffer->commands = newCommands;
+  buffer->capacity = newCapacity;
+}
+
+void MDCPathCommandBufferAppend(MDCPathCommandBuffer *buffer, const MDCPathCommand *command) {
+  if (buffer->count == buffer->capacity) {
+    MDCPathCommandBufferGrow(buffer);
+  }
+  buffer->commands[buffer->count] = *command;
+  buffer->count++;
+}
+
+void MDCPathCommandBufferAppendToCGPath(const MDCPathCommandBuffer *buffer,
+                                        CGMutablePathRef cgPath,
+                                        const CGAffineTransform *transform) {
+  for (NSUInteger i = 0; i < buffer->count; ++i) {
+    const MDCPathCommand *command = &buffer->commands[i];
+    switch (command->type) {
+      case MDCPathCommandTypeLine:
+        CGPathAddLineToPoint(cgPath, transform, command->line.point.x, command->line.point.y);
+        break;
+      case MDCPathCommandTypeArc:
+        CGPathAddArc(cgPath, transform, command->arc.center.x, command->arc.center.y,
+                     command->arc.radius, command->arc.startAngle, command->arc.endAngle,
+                     command->arc.clockwise);
+        break;
+      case MDCPathCommandTypeArcTo:
+        CGPathAddArcToPoint(cgPath, transform, command->arcTo.tangentPoint.x,
+                            command->arcTo.tangentPoint.y, command->arcTo.toPoint.x,
+                            command->arcTo.toPoint.y, command->arcTo.radius);
+        break;
+      case MDCPathCommandTypeCurve:
+        CGPathAddCurveToPoint(cgPath, transform, command->curve.controlPoint1.x,
+                              command->curve.controlPoint1.y, command->curve.controlPoint2.x,
+                              command->curve.controlPoint2.y, command->curve.toPoint.x,
+                              command->curve.toPoint.y);
+        break;
+      case MDCPathCommandTypeQuadCurve:
+        CGPathAddQuadCurveToPoint(cgPath, transform, command->quadCurve.controlPoint.x,
+                                  command->quadCurve.controlPoint.y, command->quadCurve.toPoint.x,
+                                  command->quadCurve.toPoint.y);
+        break;
+    }
+  }
+}
@@ -0,0 +1,138 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCPathCommandBuffer.h"
+#import "MaterialShapes.h"
+
+@interface MDCPathGeneratorTests : XCTestCase
+@end
+
+@implementation MDCPathGeneratorTests
+
+- (void)testAppendToCGPathMatchesEquivalentCoreGraphicsCalls {
+  // Given
+  MDCPathGenerator *generator = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointZero];
+  CGMutablePathRef expectedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(expectedPath, NULL, 0, 0);
+
+  // When
+  [generator addLineToPoint:CGPointMake(10, 0)];
+  CGPathAddLineToPoint(expectedPath, NULL, 10, 0);
+  [generator addArcWithCenter:CGPointMake(10, 10)
+                       radius:10
+                   startAngle:(CGFloat)-M_PI_2
+                     endAngle:0
+                    clockwise:NO];
+  CGPathAddArc(expectedPath, NULL, 10, 10, 10, (CGFloat)-M_PI_2, 0, NO);
+  [generator addArcWithTangentPoint:CGPointMake(20, 30) toPoint:CGPointMake(10, 30) radius:5];
+  CGPathAddArcToPoint(expectedPath, NULL, 20, 30, 10, 30, 5);
+  [generator addCurveWithControlPoint1:CGPointMake(5, 30)
+                         controlPoint2:CGPointMake(0, 25)
+                               toPoint:CGPointMake(0, 20)];
+  CGPathAddCurveToPoint(expectedPath, NULL, 5, 30, 0, 25, 0, 20);
+  [generator addQuadCurveWithControlPoint:CGPointMake(-5, 10) toPoint:CGPointMake(0, 0)];
+  CGPathAddQuadCurveToPoint(expectedPath, NULL, -5, 10, 0, 0);
+
+  CGMutablePathRef generatedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(generatedPath, NULL, 0, 0);
+  [generator appendToCGPath:generatedPath transform:NULL];
+
+  // Then
+  XCTAssertTrue(CGPathEqualToPath(generatedPath, expectedPath));
+  XCTAssertTrue(CGPointEqualToPoint(generator.endPoint, CGPointZero));
+  CGPathRelease(generatedPath);
+  CGPathRelease(expectedPath);
+}
+
+- (void)testAppendToCGPathAppliesTransform {
+  // Given
+  MDCPathGenerator *generator = [MDCPathGenerator pathGenerator];
+  [generator addLineToPoint:CGPointMake(10, 0)];
+  CGAffineTransform transform = CGAffineTransformMakeTranslation(5, 5);
+
+  // When
+  CGMutablePathRef generatedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(generatedPath, &transform, 0, 0);
+  [generator appendToCGPath:generatedPath transform:&transform];
+
+  // Then
+  CGMutablePathRef expectedPath = CGPathCreateMutable();
+  CGPathMoveToPoint(expectedPath, NULL, 5, 5);
+  CGPathAddLineToPoint(expectedPath, NULL, 15, 5);
+  XCTAssertTrue(CGPathEqualToPath(generatedPath, expectedPath));
+  CGPathRelease(generatedPath);
+  CGPathRelease(expectedPath);
+}
+
+- (void)testCommandBufferStaysInlineUpToInlineCapacity {
+  // Given
+  MDCPathCommandBuffer buffer;
+  MDCPathCommandBufferInit(&buffer);
+  MDCPathCommand command = {.type = MDCPathCommandTypeLine};
+
+  // When
+  for (NSUInteger i = 0; i < kMDCPathCommandBufferInlineCapacity; ++i) {
+    command.line.point = CGPointMake(i, i);
+    MDCPathCommandBufferAppend(&buffer, &command);
+  }
+
+  // Then
+  XCTAssertFalse(MDCPathCommandBufferUsesHeapStorage(&buffer));
+  XCTAssertEqual(buffer.count, (NSUInteger)kMDCPathCommandBufferInlineCapacity);
+  MDCPathCommandBufferDestroy(&buffer);
+}
+
+- (void)testCommandBufferPreservesCommandsWhenGrowingPastInlineCapacity {
+  // Given
+  MDCPathCommandBuffer buffer;
+  MDCPathCommandBufferInit(&buffer);
+  MDCPathCommand command = {.type = MDCPathCommandTypeLine};
+  NSUInteger commandCount = kMDCPathCommandBufferInlineCapacity * 5 + 1;
+
+  // When
+  for (NSUInteger i = 0; i < commandCount; ++i) {
+    command.line.point = CGPointMake(i, -(CGFloat)i);
+    MDCPathCommandBufferAppend(&buffer, &command);
+  }
+
+  // Then
+  XCTAssertTrue(MDCPathCommandBufferUsesHeapStorage(&buffer));
+  XCTAssertEqual(buffer.count, commandCount);
+  for (NSUInteger i = 0; i < commandCount; ++i) {
+    XCTAssertEqual(buffer.commands[i].type, MDCPathCommandTypeLine);
+    XCTAssertTrue(CGPointEqualToPoint(buffer.commands[i].line.point, CGPointMake(i, -(CGFloat)i)));
+  }
+  MDCPathCommandBufferDestroy(&buffer);
+  XCTAssertFalse(MDCPathCommandBufferUsesHeapStorage(&buffer));
+  XCTAssertEqual(buffer.count, 0U);
+}
+
+- (void)testRectangleShapeGeneratorPathPerformance {
+  // Given
+  MDCRectangleShapeGenerator *shapeGenerator = [[MDCRectangleShapeGenerator alloc] init];
+
+  // Then
+  [self measureBlock:^{
+    for (NSInteger i = 0; i < 10000; ++i) {
+      @autoreleasepool {
+        CGPathRef path = [shapeGenerator pathForSize:CGSizeMake(320, 100 + i % 50)];
+        (void)path;
+      }
+    }
+  }];
+}
+
+@end
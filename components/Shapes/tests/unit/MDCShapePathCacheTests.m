@@ -0,0 +1,232 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialShapes.h"
+
+/** An edge treatment with state that does not opt in to value equality. */
+@interface MDCShapePathCacheTestsNotchEdge : MDCEdgeTreatment
+@property(nonatomic, assign) CGFloat depth;
+@end
+
+@implementation MDCShapePathCacheTestsNotchEdge
+
+- (MDCPathGenerator *)pathGeneratorForEdgeWithLength:(CGFloat)length {
+  MDCPathGenerator *path = [MDCPathGenerator pathGeneratorWithStartPoint:CGPointZero];
+  [path addLineToPoint:CGPointMake(length / 2, self.depth)];
+  [path addLineToPoint:CGPointMake(length, 0)];
+  return path;
+}
+
+- (id)copyWithZone:(NSZone *)zone {
+  MDCShapePathCacheTestsNotchEdge *copy = [super copyWithZone:zone];
+  copy.depth = self.depth;
+  return copy;
+}
+
+@end
+
+@interface MDCShapePathCacheTests : XCTestCase
+@property(nonatomic, strong) MDCShapePathCache *pathCache;
+@end
+
+@implementation MDCShapePathCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.pathCache = [[MDCShapePathCache alloc] init];
+}
+
+- (void)tearDown {
+  self.pathCache = nil;
+
+  [super tearDown];
+}
+
+- (MDCRectangleShapeGenerator *)cachingGenerator {
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  generator.pathCache = self.pathCache;
+  return generator;
+}
+
+- (void)testGeneratorWithoutCacheDoesNotTouchCache {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+
+  // When
+  [generator pathForSize:CGSizeMake(100, 100)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 0U);
+  XCTAssertEqual(self.pathCache.missCount, 0U);
+}
+
+- (void)testGeneratorWithoutCacheDoesNotStandardizeSize {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+
+  // When
+  CGPathRef path = [generator pathForSize:CGSizeMake(-100, -50)];
+
+  // Then
+  XCTAssertTrue(CGRectEqualToRect(CGPathGetBoundingBox(path), CGRectMake(-100, -50, 100, 50)));
+}
+
+- (void)testIdenticalGeneratorsShareOneCachedPath {
+  // Given
+  NSMutableArray<MDCRectangleShapeGenerator *> *generators = [NSMutableArray array];
+  for (NSInteger i = 0; i < 100; i++) {
+    [generators addObject:[self cachingGenerator]];
+  }
+
+  // When
+  for (MDCRectangleShapeGenerator *generator in generators) {
+    [generator pathForSize:CGSizeMake(320, 120)];
+  }
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 1U);
+  XCTAssertEqual(self.pathCache.missCount, 1U);
+  XCTAssertEqual(self.pathCache.hitCount, 99U);
+}
+
+- (void)testCachedPathMatchesGeneratedPath {
+  // Given
+  MDCRectangleShapeGenerator *uncachedGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  CGPathRef cachedPath = [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.hitCount, 1U);
+  XCTAssertTrue(
+      CGPathEqualToPath(cachedPath, [uncachedGenerator pathForSize:CGSizeMake(100, 50)]));
+}
+
+- (void)testDifferentSizesAndOffsetsMiss {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  [generator pathForSize:CGSizeMake(100, 51)];
+  generator.topLeftCornerOffset = CGPointMake(2, 2);
+  [generator pathForSize:CGSizeMake(100, 51)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.missCount, 3U);
+  XCTAssertEqual(self.pathCache.hitCount, 0U);
+}
+
+- (void)testMutatingTreatmentAfterCachingMisses {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  generator.topLeftCorner.valueType = MDCCornerTreatmentValueTypePercentage;
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.missCount, 2U);
+  XCTAssertEqual(self.pathCache.count, 2U);
+}
+
+- (void)testMutatingEdgeWithoutValueEqualityMisses {
+  // Given
+  MDCShapePathCacheTestsNotchEdge *edge = [[MDCShapePathCacheTestsNotchEdge alloc] init];
+  edge.depth = 4;
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  generator.topEdge = edge;
+  [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  edge.depth = 8;
+  CGPathRef path = [generator pathForSize:CGSizeMake(100, 50)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.hitCount, 0U);
+  MDCRectangleShapeGenerator *uncachedGenerator = [[MDCRectangleShapeGenerator alloc] init];
+  uncachedGenerator.topEdge = edge;
+  XCTAssertTrue(CGPathEqualToPath(path, [uncachedGenerator pathForSize:CGSizeMake(100, 50)]));
+}
+
+- (void)testNegativeSizeSharesStandardizedSizeEntry {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  CGPathRef path = [generator pathForSize:CGSizeMake(100, 50)];
+
+  // When
+  CGPathRef negativeSizePath = [generator pathForSize:CGSizeMake(-100, -50)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 1U);
+  XCTAssertEqual(self.pathCache.hitCount, 1U);
+  XCTAssertTrue(CGPathEqualToPath(path, negativeSizePath));
+}
+
+- (void)testLeastRecentlyUsedPathIsEvicted {
+  // Given
+  self.pathCache.countLimit = 2;
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  [generator pathForSize:CGSizeMake(10, 10)];
+  [generator pathForSize:CGSizeMake(20, 20)];
+
+  // When
+  [generator pathForSize:CGSizeMake(10, 10)];
+  [generator pathForSize:CGSizeMake(30, 30)];
+  [self.pathCache resetStatistics];
+  [generator pathForSize:CGSizeMake(10, 10)];
+  [generator pathForSize:CGSizeMake(20, 20)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 2U);
+  XCTAssertEqual(self.pathCache.hitCount, 1U);
+  XCTAssertEqual(self.pathCache.missCount, 1U);
+}
+
+- (void)testStoringPathForExistingKeyReplacesEntry {
+  // Given
+  MDCRectangleShapeGenerator *generator = [[MDCRectangleShapeGenerator alloc] init];
+  CGPathRef smallPath = [generator pathForSize:CGSizeMake(10, 10)];
+  CGPathRef largePath = [generator pathForSize:CGSizeMake(20, 20)];
+  [self.pathCache setPath:smallPath forKey:@"key"];
+
+  // When
+  [self.pathCache setPath:largePath forKey:@"key"];
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 1U);
+  XCTAssertTrue(CGPathEqualToPath([self.pathCache pathForKey:@"key"], largePath));
+}
+
+- (void)testRemoveAllPaths {
+  // Given
+  MDCRectangleShapeGenerator *generator = [self cachingGenerator];
+  [generator pathForSize:CGSizeMake(10, 10)];
+
+  // When
+  [self.pathCache removeAllPaths];
+  [generator pathForSize:CGSizeMake(10, 10)];
+
+  // Then
+  XCTAssertEqual(self.pathCache.count, 1U);
+  XCTAssertEqual(self.pathCache.missCount, 2U);
+}
+
+@end
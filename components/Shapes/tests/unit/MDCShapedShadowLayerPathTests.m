@@ -2,6 +2,9 @@
 
 #import <XCTest/XCTest.h>
 
+#import "MaterialAvailability.h"
+#import "UIColor+MaterialDynamic.h"
+
 @interface MDCShapedShadowLayer (UnitTesting)
 
 - (void)setPath:(CGPathRef)path;
@@ -60,4 +63,122 @@
   XCTAssertTrue(CGPathEqualToPath(shadowLayer.shapeLayer.path, fullInsetPath.CGPath));
 }
 
+- (void)testSettingEqualPathDoesNotRegenerateSublayerPaths {
+  // Given
+  MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+  shadowLayer.shapedBorderWidth = 2;
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+  CGPathRef colorLayerPath = shadowLayer.colorLayer.path;
+  CGPathRef shapeLayerPath = shadowLayer.shapeLayer.path;
+
+  // When
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+
+  // Then
+  XCTAssertEqual(shadowLayer.pathRebuildsAvoidedCount, 1U);
+  XCTAssertEqual(shadowLayer.colorLayer.path, colorLayerPath);
+  XCTAssertEqual(shadowLayer.shapeLayer.path, shapeLayerPath);
+}
+
+- (void)testSettingEqualPathAfterResettingShadowPathReappliesShadowPath {
+  // Given
+  MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+  UIBezierPath *bezierPath = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)];
+  shadowLayer.path = bezierPath.CGPath;
+
+  // When
+  shadowLayer.shadowPath = nil;
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+
+  // Then
+  XCTAssertEqual(shadowLayer.pathRebuildsAvoidedCount, 0U);
+  XCTAssertTrue(CGPathEqualToPath(shadowLayer.shadowPath, bezierPath.CGPath));
+  XCTAssertTrue(CGPathEqualToPath(shadowLayer.colorLayer.path, bezierPath.CGPath));
+}
+
+- (void)testSettingDifferentPathRegeneratesSublayerPaths {
+  // Given
+  MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+
+  // When
+  UIBezierPath *newPath = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 50, 50)];
+  shadowLayer.path = newPath.CGPath;
+
+  // Then
+  XCTAssertEqual(shadowLayer.pathRebuildsAvoidedCount, 0U);
+  XCTAssertTrue(CGPathEqualToPath(shadowLayer.colorLayer.path, newPath.CGPath));
+  XCTAssertTrue(CGPathEqualToPath(shadowLayer.shadowPath, newPath.CGPath));
+}
+
+- (void)testSettingBorderColorDoesNotRegenerateSublayerPaths {
+  // Given
+  MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+  shadowLayer.shapedBorderWidth = 2;
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+  CGPathRef colorLayerPath = shadowLayer.colorLayer.path;
+
+  // When
+  shadowLayer.shapedBorderColor = UIColor.redColor;
+  shadowLayer.shapedBorderWidth = 2;
+
+  // Then
+  XCTAssertEqual(shadowLayer.pathRebuildsAvoidedCount, 1U);
+  XCTAssertEqual(shadowLayer.colorLayer.path, colorLayerPath);
+  XCTAssertTrue(CGColorEqualToColor(shadowLayer.colorLayer.strokeColor, UIColor.redColor.CGColor));
+}
+
+- (void)testSettingSameDynamicColorsAppliesColorsResolvedForCurrentTraits {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+    shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+    shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+    UIColor *dynamicColor = [UIColor colorWithUserInterfaceStyleDarkColor:UIColor.blackColor
+                                                             defaultColor:UIColor.whiteColor];
+    UITraitCollection *lightTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleLight];
+    UITraitCollection *darkTraits =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    [lightTraits performAsCurrentTraitCollection:^{
+      shadowLayer.shapedBackgroundColor = dynamicColor;
+      shadowLayer.shapedBorderColor = dynamicColor;
+    }];
+
+    // When
+    [darkTraits performAsCurrentTraitCollection:^{
+      shadowLayer.shapedBackgroundColor = dynamicColor;
+      shadowLayer.shapedBorderColor = dynamicColor;
+    }];
+
+    // Then
+    XCTAssertTrue(
+        CGColorEqualToColor(shadowLayer.colorLayer.fillColor, UIColor.blackColor.CGColor));
+    XCTAssertTrue(
+        CGColorEqualToColor(shadowLayer.colorLayer.strokeColor, UIColor.blackColor.CGColor));
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+}
+
+- (void)testChangingBorderWidthRegeneratesColorLayerPath {
+  // Given
+  MDCShapedShadowLayer *shadowLayer = [[MDCShapedShadowLayer alloc] init];
+  shadowLayer.frame = CGRectMake(0, 0, 100, 100);
+  shadowLayer.shapedBorderWidth = 2;
+  shadowLayer.path = [UIBezierPath bezierPathWithRect:CGRectMake(0, 0, 100, 100)].CGPath;
+
+  // When
+  shadowLayer.shapedBorderWidth = 6;
+
+  // Then
+  UIBezierPath *halfInsetPath = [UIBezierPath bezierPathWithRect:CGRectMake(3, 3, 94, 94)];
+  XCTAssertTrue(CGPathEqualToPath(shadowLayer.colorLayer.path, halfInsetPath.CGPath));
+  XCTAssertEqual(shadowLayer.pathRebuildsAvoidedCount, 0U);
+}
+
 @end
@@ -18,6 +18,7 @@
 #import "MDCTextControlHorizontalPositioning.h"
 #import "MDCTextControlLabelPosition.h"
 #import "MDCTextControlSideViewSupport.h"
+#import "MDCTextControlTextMeasurementCache.h"
 #import "MDCTextControlVerticalPositioningReference.h"
 
 #import <MDFInternationalization/MDFInternationalization.h>
@@ -342,24 +343,21 @@ static const CGFloat kGradientBlurLength = (CGFloat)4.0;
 }
 
 - (CGSize)textSizeWithText:(NSString *)text font:(UIFont *)font maxWidth:(CGFloat)maxWidth {
-  CGSize fittingSize = CGSizeMake(CGFLOAT_MAX, CGFLOAT_MAX);
-  NSDictionary *attributes = @{NSFontAttributeName : font};
-  CGRect rect = [text boundingRectWithSize:fittingSize
-                                   options:NSStringDrawingUsesLineFragmentOrigin
-                                attributes:attributes
-                                   context:nil];
+  CGSize size = [[MDCTextControlTextMeasurementCache sharedCache] boundingSizeOfText:text
+                                                                               font:font
+                                                                       fittingWidth:CGFLOAT_MAX];
   CGFloat maxTextFieldHeight = font.lineHeight;
-  CGFloat textFieldWidth = CGRectGetWidth(rect);
-  CGFloat textFieldHeight = CGRectGetHeight(rect);
+  CGFloat textFieldWidth = size.width;
+  CGFloat textFieldHeight = size.height;
   if (textFieldWidth > maxWidth) {
     textFieldWidth = maxWidth;
   }
   if (textFieldHeight > maxTextFieldHeight) {
     textFieldHeight = maxTextFieldHeight;
   }
-  rect.size.width = textFieldWidth;
-  rect.size.height = textFieldHeight;
-  return rect.size;
+  size.width = textFieldWidth;
+  size.height = textFieldHeight;
+  return size;
 }
 
 - (NSArray<NSNumber *> *)
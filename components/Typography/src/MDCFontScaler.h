@@ -58,11 +58,14 @@ UIKIT_EXTERN MDCTextStyle const MDCTextStyleOverline;
 - (nonnull instancetype)initForMaterialTextStyle:(MDCTextStyle)textStyle NS_DESIGNATED_INITIALIZER;
 
 /**
- Creates and returns a font scaler object with the specified text style.
+ Returns the shared font scaler object for the specified text style.
+
+ Font scalers are immutable, so every call with the same standard text style returns the same
+ object. Unknown text styles return a new scaler that uses the Body1 scaling curve.
 
  @param textStyle The style that will be used to determine the scaling curver associated with the
  returned font. For example, MaterialTextStyleBody1.
- @return An initialized font scaler object.
+ @return A font scaler object.
  */
 + (nonnull instancetype)scalerForMaterialTextStyle:(MDCTextStyle)textStyle;
 
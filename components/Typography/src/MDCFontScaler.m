@@ -18,6 +18,7 @@
 
 #import "UIFont+MaterialScalable.h"
 #import "private/MDCFontTraits.h"
+#import "private/MDCScalingCurveTable.h"
 #import "private/MDCTypographyUtilities.h"
 
 MDCTextStyle const MDCTextStyleHeadline1 = @"MDC.TextStyle.Headline1";
@@ -34,235 +35,137 @@ MDCTextStyle const MDCTextStyleButton = @"MDC.TextStyle.Button";
 MDCTextStyle const MDCTextStyleCaption = @"MDC.TextStyle.Caption";
 MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
 
+/** The standard text styles, in the order of the rows of @c kScalingCurves. */
+typedef NS_ENUM(NSInteger, FontScalerTextStyle) {
+  FontScalerTextStyleHeadline1,
+  FontScalerTextStyleHeadline2,
+  FontScalerTextStyleHeadline3,
+  FontScalerTextStyleHeadline4,
+  FontScalerTextStyleHeadline5,
+  FontScalerTextStyleHeadline6,
+  FontScalerTextStyleSubtitle1,
+  FontScalerTextStyleSubtitle2,
+  FontScalerTextStyleBody1,
+  FontScalerTextStyleBody2,
+  FontScalerTextStyleButton,
+  FontScalerTextStyleCaption,
+  FontScalerTextStyleOverline,
+  FontScalerTextStyleCount,
+};
+
+// NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory
+// values. This values must not decrease as the category size increases. To put it another
+// way, the value for UIContentSizeCategoryLarge must not be smaller than the value for
+// UIContentSizeCategoryMedium.
+//
+// Columns are indexed by MDCFontTraitsSizeCategory.
+static const CGFloat kScalingCurves[FontScalerTextStyleCount][MDCFontTraitsSizeCategoryCount] = {
+    [FontScalerTextStyleHeadline1] = {84, 88, 92, 96, 100, 104, 108, 108, 108, 108, 108, 108},
+    [FontScalerTextStyleHeadline2] = {54, 56, 58, 60, 62, 64, 66, 66, 66, 66, 66, 66},
+    [FontScalerTextStyleHeadline3] = {42, 44, 46, 48, 50, 52, 54, 54, 54, 54, 54, 54},
+    [FontScalerTextStyleHeadline4] = {28, 30, 32, 34, 36, 38, 40, 42, 42, 42, 42, 42},
+    [FontScalerTextStyleHeadline5] = {21, 22, 23, 24, 26, 28, 30, 32, 32, 32, 32, 32},
+    [FontScalerTextStyleHeadline6] = {17, 18, 19, 20, 22, 24, 26, 28, 28, 28, 28, 28},
+    [FontScalerTextStyleSubtitle1] = {13, 14, 15, 16, 18, 20, 22, 25, 30, 37, 44, 52},
+    [FontScalerTextStyleSubtitle2] = {11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42},
+    [FontScalerTextStyleBody1] = {13, 14, 15, 16, 18, 20, 22, 26, 30, 34, 38, 42},
+    [FontScalerTextStyleBody2] = {11, 12, 13, 14, 16, 18, 20, 22, 25, 30, 36, 42},
+    [FontScalerTextStyleButton] = {11, 12, 13, 14, 16, 18, 20, 22, 24, 26, 28, 30},
+    [FontScalerTextStyleCaption] = {11, 11, 11, 12, 14, 16, 18, 20, 22, 24, 26, 28},
+    [FontScalerTextStyleOverline] = {8, 8, 9, 10, 12, 14, 16, 18, 20, 22, 24, 26},
+};
+
+/** The scaling curve tables of the standard text styles, shared by all scalers. */
+static MDCScalingCurveTable *gScalingCurveTables[FontScalerTextStyleCount];
+
+/** The scalers returned by +scalerForMaterialTextStyle:. */
+static MDCFontScaler *gScalers[FontScalerTextStyleCount];
+
+static MDCTextStyle TextStyleName(FontScalerTextStyle textStyle) {
+  switch (textStyle) {
+    case FontScalerTextStyleHeadline1:
+      return MDCTextStyleHeadline1;
+    case FontScalerTextStyleHeadline2:
+      return MDCTextStyleHeadline2;
+    case FontScalerTextStyleHeadline3:
+      return MDCTextStyleHeadline3;
+    case FontScalerTextStyleHeadline4:
+      return MDCTextStyleHeadline4;
+    case FontScalerTextStyleHeadline5:
+      return MDCTextStyleHeadline5;
+    case FontScalerTextStyleHeadline6:
+      return MDCTextStyleHeadline6;
+    case FontScalerTextStyleSubtitle1:
+      return MDCTextStyleSubtitle1;
+    case FontScalerTextStyleSubtitle2:
+      return MDCTextStyleSubtitle2;
+    case FontScalerTextStyleBody1:
+      return MDCTextStyleBody1;
+    case FontScalerTextStyleBody2:
+      return MDCTextStyleBody2;
+    case FontScalerTextStyleButton:
+      return MDCTextStyleButton;
+    case FontScalerTextStyleCaption:
+      return MDCTextStyleCaption;
+    case FontScalerTextStyleOverline:
+      return MDCTextStyleOverline;
+    case FontScalerTextStyleCount:
+      break;
+  }
+  return MDCTextStyleBody1;
+}
+
+/** Returns the standard text style named @c textStyle, or Body1 if there is none. */
+static FontScalerTextStyle TextStyleForName(NSString *textStyle) {
+  // Text styles almost always come from the constants above, so compare pointers first.
+  for (NSInteger i = 0; i < FontScalerTextStyleCount; ++i) {
+    if (textStyle == TextStyleName(i)) {
+      return i;
+    }
+  }
+  for (NSInteger i = 0; i < FontScalerTextStyleCount; ++i) {
+    if ([textStyle isEqualToString:TextStyleName(i)]) {
+      return i;
+    }
+  }
+  return FontScalerTextStyleBody1;
+}
+
 @implementation MDCFontScaler {
-  NSDictionary<UIContentSizeCategory, NSNumber *> *_scalingCurve;
+  MDCScalingCurveTable *_scalingCurveTable;
+  const CGFloat *_pointSizes;
   MDCTextStyle _textStyle;
 }
 
++ (void)initialize {
+  if (self != [MDCFontScaler class]) {
+    return;
+  }
+  for (NSInteger i = 0; i < FontScalerTextStyleCount; ++i) {
+    gScalingCurveTables[i] = [[MDCScalingCurveTable alloc] initWithPointSizes:kScalingCurves[i]];
+  }
+  for (NSInteger i = 0; i < FontScalerTextStyleCount; ++i) {
+    gScalers[i] = [[MDCFontScaler alloc] initForMaterialTextStyle:TextStyleName(i)];
+  }
+}
+
 + (instancetype)scalerForMaterialTextStyle:(MDCTextStyle)textStyle {
-  return [[MDCFontScaler alloc] initForMaterialTextStyle:textStyle];
+  MDCFontScaler *scaler = gScalers[TextStyleForName(textStyle)];
+  if (scaler->_textStyle != textStyle && ![scaler->_textStyle isEqualToString:textStyle]) {
+    // Unknown text styles get their own scaler so that it keeps their name.
+    return [[MDCFontScaler alloc] initForMaterialTextStyle:textStyle];
+  }
+  return scaler;
 }
 
 - (instancetype)initForMaterialTextStyle:(MDCTextStyle)textStyle {
   self = [super init];
   if (self) {
+    // Unknown text styles scale with the Body1 curve, but keep their own name.
+    FontScalerTextStyle style = TextStyleForName(textStyle);
+    _scalingCurveTable = gScalingCurveTables[style];
+    _pointSizes = kScalingCurves[style];
     _textStyle = [textStyle copy];
-
-    // NOTE: All scaling curves MUST include a full set of values for ALL UIContentSizeCategory
-    // values. This values must not decrease as the category size increases. To put it another
-    // way, the value for UIContentSizeCategoryLarge must not be smaller than the value for
-    // UIContentSizeCategoryMedium.
-    if ([MDCTextStyleHeadline1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @84,
-        UIContentSizeCategorySmall : @88,
-        UIContentSizeCategoryMedium : @92,
-        UIContentSizeCategoryLarge : @96,
-        UIContentSizeCategoryExtraLarge : @100,
-        UIContentSizeCategoryExtraExtraLarge : @104,
-        UIContentSizeCategoryExtraExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityMedium : @108,
-        UIContentSizeCategoryAccessibilityLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @108,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @108
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @54,
-        UIContentSizeCategorySmall : @56,
-        UIContentSizeCategoryMedium : @58,
-        UIContentSizeCategoryLarge : @60,
-        UIContentSizeCategoryExtraLarge : @62,
-        UIContentSizeCategoryExtraExtraLarge : @64,
-        UIContentSizeCategoryExtraExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityMedium : @66,
-        UIContentSizeCategoryAccessibilityLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @66,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @66
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline3 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @42,
-        UIContentSizeCategorySmall : @44,
-        UIContentSizeCategoryMedium : @46,
-        UIContentSizeCategoryLarge : @48,
-        UIContentSizeCategoryExtraLarge : @50,
-        UIContentSizeCategoryExtraExtraLarge : @52,
-        UIContentSizeCategoryExtraExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityMedium : @54,
-        UIContentSizeCategoryAccessibilityLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @54,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @54
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline4 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @28,
-        UIContentSizeCategorySmall : @30,
-        UIContentSizeCategoryMedium : @32,
-        UIContentSizeCategoryLarge : @34,
-        UIContentSizeCategoryExtraLarge : @36,
-        UIContentSizeCategoryExtraExtraLarge : @38,
-        UIContentSizeCategoryExtraExtraExtraLarge : @40,
-        UIContentSizeCategoryAccessibilityMedium : @42,
-        UIContentSizeCategoryAccessibilityLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @42,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline5 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @21,
-        UIContentSizeCategorySmall : @22,
-        UIContentSizeCategoryMedium : @23,
-        UIContentSizeCategoryLarge : @24,
-        UIContentSizeCategoryExtraLarge : @26,
-        UIContentSizeCategoryExtraExtraLarge : @28,
-        UIContentSizeCategoryExtraExtraExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityMedium : @32,
-        UIContentSizeCategoryAccessibilityLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @32,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @32
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleHeadline6 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @17,
-        UIContentSizeCategorySmall : @18,
-        UIContentSizeCategoryMedium : @19,
-        UIContentSizeCategoryLarge : @20,
-        UIContentSizeCategoryExtraLarge : @22,
-        UIContentSizeCategoryExtraExtraLarge : @24,
-        UIContentSizeCategoryExtraExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityMedium : @28,
-        UIContentSizeCategoryAccessibilityLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle1 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @25,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @37,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @44,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @52
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleSubtitle2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleBody2 isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @25,
-        UIContentSizeCategoryAccessibilityExtraLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @36,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleButton isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @12,
-        UIContentSizeCategoryMedium : @13,
-        UIContentSizeCategoryLarge : @14,
-        UIContentSizeCategoryExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraExtraLarge : @20,
-        UIContentSizeCategoryAccessibilityMedium : @22,
-        UIContentSizeCategoryAccessibilityLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @28,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @30
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleCaption isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @11,
-        UIContentSizeCategorySmall : @11,
-        UIContentSizeCategoryMedium : @11,
-        UIContentSizeCategoryLarge : @12,
-        UIContentSizeCategoryExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraLarge : @16,
-        UIContentSizeCategoryExtraExtraExtraLarge : @18,
-        UIContentSizeCategoryAccessibilityMedium : @20,
-        UIContentSizeCategoryAccessibilityLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @26,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @28
-      };
-      _scalingCurve = scalingCurve;
-    } else if ([MDCTextStyleOverline isEqualToString:textStyle]) {
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @8,
-        UIContentSizeCategorySmall : @8,
-        UIContentSizeCategoryMedium : @9,
-        UIContentSizeCategoryLarge : @10,
-        UIContentSizeCategoryExtraLarge : @12,
-        UIContentSizeCategoryExtraExtraLarge : @14,
-        UIContentSizeCategoryExtraExtraExtraLarge : @16,
-        UIContentSizeCategoryAccessibilityMedium : @18,
-        UIContentSizeCategoryAccessibilityLarge : @20,
-        UIContentSizeCategoryAccessibilityExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @24,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @26
-      };
-      _scalingCurve = scalingCurve;
-    } else {
-      // If nothing matches, return the metrics for MDCTextStyleBody1
-      _textStyle = [MDCTextStyleBody1 copy];
-      NSDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve = @{
-        UIContentSizeCategoryExtraSmall : @13,
-        UIContentSizeCategorySmall : @14,
-        UIContentSizeCategoryMedium : @15,
-        UIContentSizeCategoryLarge : @16,
-        UIContentSizeCategoryExtraLarge : @18,
-        UIContentSizeCategoryExtraExtraLarge : @20,
-        UIContentSizeCategoryExtraExtraExtraLarge : @22,
-        UIContentSizeCategoryAccessibilityMedium : @26,
-        UIContentSizeCategoryAccessibilityLarge : @30,
-        UIContentSizeCategoryAccessibilityExtraLarge : @34,
-        UIContentSizeCategoryAccessibilityExtraExtraLarge : @38,
-        UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @42
-      };
-      _scalingCurve = scalingCurve;
-    }
   }
 
   return self;
@@ -272,36 +175,39 @@ MDCTextStyle const MDCTextStyleOverline = @"MDC.TextStyle.Overline";
   // If it is available, query the preferredContentSizeCategory.
   UIContentSizeCategory sizeCategory = GetCurrentSizeCategory();
 
+  // Offset the variant so these results don't collide with mdc_scaledFontForSizeCategory:'s.
+  NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  NSInteger variant = MDCFontTraitsSizeCategoryCount + ordinal;
+  if (ordinal != NSNotFound) {
+    UIFont *cachedFont = MDCScaledFontCacheLookup(font, _scalingCurveTable, variant);
+    if (cachedFont.mdc_scalingCurveTable == _scalingCurveTable) {
+      return cachedFont;
+    }
+  }
+
   // We create a new font to ensure we have a complete set of font traits.
   // They we apply our new scaling curve before returning a scaled font.
   UIFont *templateFont = [UIFont fontWithDescriptor:font.fontDescriptor size:0.0];
-  templateFont.mdc_scalingCurve = _scalingCurve;
+  templateFont.mdc_scalingCurveTable = _scalingCurveTable;
   UIFont *scaledFont = [templateFont mdc_scaledFontForSizeCategory:sizeCategory];
+  if (ordinal != NSNotFound) {
+    MDCScaledFontCacheStore(font, _scalingCurveTable, variant, scaledFont);
+  }
 
   return scaledFont;
 }
 
 - (CGFloat)scaledValueForValue:(CGFloat)value {
-  UIContentSizeCategory defaultSizeCategory = UIContentSizeCategoryLarge;
   // If it is available, query the preferredContentSizeCategory.
-  UIContentSizeCategory currentSizeCategory = GetCurrentSizeCategory();
-
-  NSNumber *defaultFontSizeNumber = _scalingCurve[defaultSizeCategory];
-  NSNumber *currentFontSizeNumber = _scalingCurve[currentSizeCategory];
-
-  // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
-  if (currentFontSizeNumber == nil || defaultFontSizeNumber == nil) {
-    return value;
-  }
-
-  CGFloat currentFontSize = (CGFloat)currentFontSizeNumber.doubleValue;
-  CGFloat defaultFontSize = (CGFloat)defaultFontSizeNumber.doubleValue;
+  NSInteger sizeCategory = MDCFontTraitsSizeCategoryOrdinal(GetCurrentSizeCategory());
 
-  // Guard against broken / incomplete scaling curves by returning self if fontSize <= 0.0.
-  if (currentFontSize <= 0.0 || defaultFontSize <= 0.0) {
+  // Size categories without a point size on the curve don't scale values.
+  if (sizeCategory == NSNotFound) {
     return value;
   }
 
+  CGFloat currentFontSize = _pointSizes[sizeCategory];
+  CGFloat defaultFontSize = _pointSizes[MDCFontTraitsSizeCategoryLarge];
   return (currentFontSize / defaultFontSize) * value;
 }
 
@@ -14,6 +14,9 @@
 
 #import "MDCTypography.h"
 
+#import <os/lock.h>
+
+#import "private/MDCSystemFontLoader+Private.h"
 #import "private/UIFont+MaterialTypographyPrivate.h"
 #import <MDFTextAccessibility/MDFTextAccessibility.h>
 
@@ -182,13 +185,63 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
 
 @end
 
-@interface MDCSystemFontLoader ()
+/** The fonts cached by MDCSystemFontLoader, stored in the low bits of a font cache key. */
+typedef NS_ENUM(uint64_t, MDCSystemFontLoaderFont) {
+  MDCSystemFontLoaderFontLight = 1,
+  MDCSystemFontLoaderFontRegular,
+  MDCSystemFontLoaderFontMedium,
+  MDCSystemFontLoaderFontBold,
+  MDCSystemFontLoaderFontItalic,
+  MDCSystemFontLoaderFontBoldItalic,
+};
+
+static const int kFontCacheKeyFontBits = 3;
+
+/** The number of slots in the font cache. Must be a power of two. */
+static const NSUInteger kFontCacheCapacity = 256;
 
-/*
- In collectionView scrolling tests, manually caching UIFonts performs around 4.5 times better
- (e.g. 230 ms vs. 1,080 ms in one test) than calling [UIFont systemFontForSize:weight:] every time.
+/**
+ The font cache is cleared rather than allowed to fill more than this many slots, three quarters of
+ kFontCacheCapacity.
  */
-@property(nonatomic, strong) NSCache *fontCache;
+static const NSUInteger kFontCacheMaximumCount = 192;
+
+/**
+ Returns a key for the font at @c fontSize, or 0 if the size can't be cached.
+
+ The size is stored as fixed point with six fractional digits, matching the precision of the string
+ keys that the cache used previously.
+ */
+static uint64_t FontCacheKey(MDCSystemFontLoaderFont font, CGFloat fontSize) {
+  static const CGFloat kMaximumCachedFontSize = 1000000;
+  if (!(fontSize >= 0 && fontSize <= kMaximumCachedFontSize)) {
+    return 0;
+  }
+  uint64_t fixedPointSize = (uint64_t)llround(fontSize * 1000000);
+  return (fixedPointSize << kFontCacheKeyFontBits) | font;
+}
+
+static NSUInteger FontCacheSlot(uint64_t key) {
+  // Fibonacci hashing spreads sequential sizes across the table.
+  return (NSUInteger)((key * 0x9E3779B97F4A7C15ULL) >> 56) & (kFontCacheCapacity - 1);
+}
+
+@interface MDCSystemFontLoader () {
+  /*
+   In collectionView scrolling tests, manually caching UIFonts performs around 4.5 times better
+   (e.g. 230 ms vs. 1,080 ms in one test) than calling [UIFont systemFontForSize:weight:] every
+   time.
+
+   The cache is an open-addressing table of kFontCacheCapacity slots keyed by font and fixed-point
+   size, so a hit allocates nothing. A key of 0 marks an empty slot.
+   */
+  uint64_t *_fontCacheKeys;
+  UIFont *__strong *_fontCacheFonts;
+  NSUInteger _fontCacheCount;
+  NSUInteger _fontCacheHitCount;
+  NSUInteger _fontCacheMissCount;
+  os_unfair_lock _fontCacheLock;
+}
 
 @end
 
@@ -197,7 +250,9 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
 - (instancetype)init {
   self = [super init];
   if (self) {
-    _fontCache = [[NSCache alloc] init];
+    _fontCacheLock = OS_UNFAIR_LOCK_INIT;
+    _fontCacheKeys = calloc(kFontCacheCapacity, sizeof(*_fontCacheKeys));
+    _fontCacheFonts = (UIFont *__strong *)calloc(kFontCacheCapacity, sizeof(*_fontCacheFonts));
     [[NSNotificationCenter defaultCenter] addObserver:self
                                              selector:@selector(didChangeContentSizeCategory)
                                                  name:UIContentSizeCategoryDidChangeNotification
@@ -206,82 +261,156 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   return self;
 }
 
+- (void)dealloc {
+  // Release the cached fonts before freeing the table that holds them.
+  [self removeAllCachedFonts];
+  free(_fontCacheKeys);
+  free((void *)_fontCacheFonts);
+}
+
+- (NSUInteger)fontCacheHitCount {
+  os_unfair_lock_lock(&_fontCacheLock);
+  NSUInteger hitCount = _fontCacheHitCount;
+  os_unfair_lock_unlock(&_fontCacheLock);
+  return hitCount;
+}
+
+- (NSUInteger)fontCacheMissCount {
+  os_unfair_lock_lock(&_fontCacheLock);
+  NSUInteger missCount = _fontCacheMissCount;
+  os_unfair_lock_unlock(&_fontCacheLock);
+  return missCount;
+}
+
 - (void)didChangeContentSizeCategory {
-  [_fontCache removeAllObjects];
+  os_unfair_lock_lock(&_fontCacheLock);
+  [self removeAllCachedFonts];
+  os_unfair_lock_unlock(&_fontCacheLock);
+}
+
+/** Must be called with the font cache lock held, or from dealloc. */
+- (void)removeAllCachedFonts {
+  for (NSUInteger i = 0; i < kFontCacheCapacity; ++i) {
+    _fontCacheKeys[i] = 0;
+    _fontCacheFonts[i] = nil;
+  }
+  _fontCacheCount = 0;
+}
+
+- (nullable UIFont *)cachedFontForKey:(uint64_t)key {
+  UIFont *font = nil;
+  os_unfair_lock_lock(&_fontCacheLock);
+  if (key != 0) {
+    for (NSUInteger slot = FontCacheSlot(key); _fontCacheKeys[slot] != 0;
+         slot = (slot + 1) & (kFontCacheCapacity - 1)) {
+      if (_fontCacheKeys[slot] == key) {
+        font = _fontCacheFonts[slot];
+        break;
+      }
+    }
+  }
+  if (font) {
+    ++_fontCacheHitCount;
+  } else {
+    ++_fontCacheMissCount;
+  }
+  os_unfair_lock_unlock(&_fontCacheLock);
+  return font;
+}
+
+- (void)cacheFont:(UIFont *)font forKey:(uint64_t)key {
+  if (key == 0 || font == nil) {
+    return;
+  }
+  os_unfair_lock_lock(&_fontCacheLock);
+  NSUInteger slot = FontCacheSlot(key);
+  while (_fontCacheKeys[slot] != 0 && _fontCacheKeys[slot] != key) {
+    slot = (slot + 1) & (kFontCacheCapacity - 1);
+  }
+  if (_fontCacheKeys[slot] == 0) {
+    if (_fontCacheCount == kFontCacheMaximumCount) {
+      [self removeAllCachedFonts];
+      slot = FontCacheSlot(key);
+    }
+    ++_fontCacheCount;
+  }
+  _fontCacheKeys[slot] = key;
+  _fontCacheFonts[slot] = font;
+  os_unfair_lock_unlock(&_fontCacheLock);
 }
 
 - (nullable UIFont *)lightFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontLight, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont systemFontOfSize:fontSize weight:UIFontWeightLight];
   if (font) {
-    [self.fontCache setObject:font forKey:cacheKey];
+    [self cacheFont:font forKey:cacheKey];
   }
   return font;
 }
 
 - (UIFont *)regularFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontRegular, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont systemFontOfSize:fontSize weight:UIFontWeightRegular];
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return (UIFont *)font;
 }
 
 - (nullable UIFont *)mediumFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontMedium, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont systemFontOfSize:fontSize weight:UIFontWeightMedium];
   if (font) {
-    [self.fontCache setObject:font forKey:cacheKey];
+    [self cacheFont:font forKey:cacheKey];
   }
   return font;
 }
 
 - (UIFont *)boldFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontBold, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont systemFontOfSize:fontSize weight:UIFontWeightSemibold];
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
 
 - (UIFont *)italicFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontItalic, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
 
   font = [UIFont italicSystemFontOfSize:fontSize];
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
 
 - (nullable UIFont *)boldItalicFontOfSize:(CGFloat)fontSize {
-  NSString *cacheKey = [NSString stringWithFormat:@"%@-%06f", NSStringFromSelector(_cmd), fontSize];
-  UIFont *font = [self.fontCache objectForKey:cacheKey];
+  uint64_t cacheKey = FontCacheKey(MDCSystemFontLoaderFontBoldItalic, fontSize);
+  UIFont *font = [self cachedFontForKey:cacheKey];
   if (font) {
     return font;
   }
@@ -295,7 +424,7 @@ const CGFloat MDCTypographySecondaryOpacity = (CGFloat)0.54;
   UIFontDescriptor *nonnullDescriptor = descriptor;
   font = [UIFont fontWithDescriptor:nonnullDescriptor size:fontSize];
 
-  [self.fontCache setObject:font forKey:cacheKey];
+  [self cacheFont:font forKey:cacheKey];
 
   return font;
 }
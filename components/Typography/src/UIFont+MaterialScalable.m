@@ -19,6 +19,7 @@
 #import "MaterialApplication.h"
 
 #import "MDCTypography.h"
+#import "private/MDCScalingCurveTable.h"
 #import "private/MDCTypographyUtilities.h"
 
 static char MDCFontScaleObjectKey;
@@ -26,34 +27,41 @@ static char MDCFontScaleObjectKey;
 @implementation UIFont (MaterialScalable)
 
 - (UIFont *)mdc_scaledFontForSizeCategory:(UIContentSizeCategory)sizeCategory {
-  if (!self.mdc_scalingCurve) {
+  MDCScalingCurveTable *scalingCurveTable = self.mdc_scalingCurveTable;
+  if (!scalingCurveTable) {
     return self;
   }
 
-  NSNumber *fontSizeNumber;
+  CGFloat fontSize = 0;
   if (sizeCategory) {
     // Pick the correct font size from the pre-attached scaling curve that
     // fits the specific size category. The scaling curve is attached based on
     // the type of font, so a button font has a different scaling curve than
     // a headline font, and the two will therefore see different font size numbers
     // for the same size category.
-    fontSizeNumber = self.mdc_scalingCurve[sizeCategory];
+    fontSize = [scalingCurveTable pointSizeForSizeCategory:sizeCategory];
   }
 
-  // Guard against broken / incomplete scaling curves by returning self if fontSizeNumber is nil.
-  if (fontSizeNumber == nil) {
+  // Guard against broken / incomplete scaling curves encoded with missing, 0.0 or negative values.
+  if (fontSize <= 0.0) {
     return self;
   }
 
-  CGFloat fontSize = (CGFloat)fontSizeNumber.doubleValue;
-
-  // Guard against broken scaling curves encoded with 0.0 or negative values
-  if (fontSize <= 0.0) {
-    return self;
+  // Only the known size categories are cached, since they are the only ones with a compact key.
+  NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  if (ordinal != NSNotFound) {
+    UIFont *cachedFont = MDCScaledFontCacheLookup(self, scalingCurveTable, ordinal);
+    // Fonts are shared, so the cached font's curve may have been replaced since it was cached.
+    if (cachedFont.mdc_scalingCurveTable == scalingCurveTable) {
+      return cachedFont;
+    }
   }
 
   UIFont *scaledFont = [UIFont fontWithDescriptor:self.fontDescriptor size:fontSize];
-  scaledFont.mdc_scalingCurve = self.mdc_scalingCurve;
+  scaledFont.mdc_scalingCurveTable = scalingCurveTable;
+  if (ordinal != NSNotFound) {
+    MDCScaledFontCacheStore(self, scalingCurveTable, ordinal, scaledFont);
+  }
 
   return scaledFont;
 }
@@ -79,13 +87,21 @@ static char MDCFontScaleObjectKey;
 }
 
 - (NSDictionary<UIContentSizeCategory, NSNumber *> *)mdc_scalingCurve {
-  return (NSDictionary<UIContentSizeCategory, NSNumber *> *)objc_getAssociatedObject(
-      self, &MDCFontScaleObjectKey);
+  return self.mdc_scalingCurveTable.scalingCurve;
 }
 
 - (void)mdc_setScalingCurve:(NSDictionary<UIContentSizeCategory, NSNumber *> *)scalingCurve {
-  objc_setAssociatedObject(self, &MDCFontScaleObjectKey, scalingCurve,
-                           OBJC_ASSOCIATION_COPY_NONATOMIC);
+  self.mdc_scalingCurveTable =
+      scalingCurve ? [[MDCScalingCurveTable alloc] initWithScalingCurve:scalingCurve] : nil;
+}
+
+- (MDCScalingCurveTable *)mdc_scalingCurveTable {
+  return (MDCScalingCurveTable *)objc_getAssociatedObject(self, &MDCFontScaleObjectKey);
+}
+
+- (void)mdc_setScalingCurveTable:(MDCScalingCurveTable *)scalingCurveTable {
+  objc_setAssociatedObject(self, &MDCFontScaleObjectKey, scalingCurveTable,
+                           OBJC_ASSOCIATION_RETAIN_NONATOMIC);
 }
 
 @end
@@ -36,6 +36,22 @@
  */
 + (nonnull UIFont *)mdc_standardFontForMaterialTextStyle:(MDCFontTextStyle)style;
 
+/**
+ Resolves the font descriptors and fonts of every Material text style on a background queue, so that
+ the first calls to @c +mdc_standardFontForMaterialTextStyle:,
+ @c +mdc_preferredFontForMaterialTextStyle: and
+ @c +[UIFontDescriptor mdc_preferredFontDescriptorForMaterialTextStyle:] don't do that work on the
+ main thread.
+
+ Call this early during launch, on the main thread.
+
+ @param allSizeCategories Whether to resolve the text styles for every content size category rather
+ than only the current one.
+ @param completion Called on the main queue once every text style has been resolved.
+ */
++ (void)mdc_prewarmMaterialTextStylesForAllSizeCategories:(BOOL)allSizeCategories
+                                               completion:(nullable void (^)(void))completion;
+
 /**
  Returns an new instance of the font sized according to the text-style and whether the content
  size category (Dynamic Type) should be taken into account.
@@ -16,6 +16,8 @@
 
 #import "MDCTypography.h"
 #import "UIFontDescriptor+MaterialTypography.h"
+#import "private/MDCFontTraits.h"
+#import "private/MDCTypographyUtilities.h"
 
 @implementation UIFont (MaterialTypography)
 
@@ -65,6 +67,45 @@
   return font;
 }
 
++ (void)mdc_prewarmMaterialTextStylesForAllSizeCategories:(BOOL)allSizeCategories
+                                               completion:(void (^)(void))completion {
+  // The preferred size category can only be queried on the main thread.
+  NSString *preferredSizeCategory = GetPreferredContentSizeCategory();
+  NSArray<NSString *> *sizeCategories = @[ preferredSizeCategory ?: UIContentSizeCategoryLarge ];
+  if (allSizeCategories) {
+    sizeCategories = @[
+      UIContentSizeCategoryExtraSmall,
+      UIContentSizeCategorySmall,
+      UIContentSizeCategoryMedium,
+      UIContentSizeCategoryLarge,
+      UIContentSizeCategoryExtraLarge,
+      UIContentSizeCategoryExtraExtraLarge,
+      UIContentSizeCategoryExtraExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityMedium,
+      UIContentSizeCategoryAccessibilityLarge,
+      UIContentSizeCategoryAccessibilityExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+    ];
+  }
+
+  dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+    for (MDCFontTextStyle style = 0; style < MDCFontTraitsTextStyleCount; ++style) {
+      [UIFont mdc_standardFontForMaterialTextStyle:style];
+      for (NSString *sizeCategory in sizeCategories) {
+        UIFontDescriptor *fontDescriptor =
+            [UIFontDescriptor mdc_fontDescriptorForMaterialTextStyle:style
+                                                        sizeCategory:sizeCategory];
+        // Creating the font once loads the font data that later fonts with this descriptor reuse.
+        [UIFont fontWithDescriptor:fontDescriptor size:0.0];
+      }
+    }
+    if (completion) {
+      dispatch_async(dispatch_get_main_queue(), completion);
+    }
+  });
+}
+
 - (nonnull UIFont *)mdc_fontSizedForMaterialTextStyle:(MDCFontTextStyle)style
                                  scaledForDynamicType:(BOOL)scaled {
   UIFontDescriptor *fontDescriptor;
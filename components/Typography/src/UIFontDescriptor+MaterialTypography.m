@@ -14,14 +14,21 @@
 
 #import "UIFontDescriptor+MaterialTypography.h"
 
-#import "MaterialApplication.h"
+#import <os/lock.h>
 
 #import "private/MDCFontTraits.h"
+#import "private/MDCTypographyUtilities.h"
+#import "private/UIFontDescriptor+MaterialTypographyPrivate.h"
 
-@implementation UIFontDescriptor (MaterialTypography)
+/**
+ Font descriptors by MDCFontTextStyle and MDCFontTraitsSizeCategory. Descriptors are immutable and
+ only depend on their style and size category, so they are never invalidated.
+ */
+static UIFontDescriptor *gFontDescriptors[MDCFontTraitsTextStyleCount]
+                                         [MDCFontTraitsSizeCategoryCount];
+static os_unfair_lock gFontDescriptorsLock = OS_UNFAIR_LOCK_INIT;
 
-+ (nonnull UIFontDescriptor *)mdc_fontDescriptorForMaterialTextStyle:(MDCFontTextStyle)style
-                                                        sizeCategory:(NSString *)sizeCategory {
+static UIFontDescriptor *MakeFontDescriptor(MDCFontTextStyle style, NSString *sizeCategory) {
   // TODO(#1179): We should include our leading and tracking metrics when creating this descriptor.
   MDCFontTraits *materialTraits = [MDCFontTraits traitsForTextStyle:style
                                                        sizeCategory:sizeCategory];
@@ -56,18 +63,34 @@
   return fontDescriptor;
 }
 
-+ (nonnull UIFontDescriptor *)mdc_preferredFontDescriptorForMaterialTextStyle:
-    (MDCFontTextStyle)style {
-  // iOS' default UIContentSizeCategory is Large.
-  NSString *sizeCategory = UIContentSizeCategoryLarge;
+@implementation UIFontDescriptor (MaterialTypography)
 
-  // If we are within an application, query the preferredContentSizeCategory.
-  if ([UIApplication mdc_safeSharedApplication]) {
-    sizeCategory = [UIApplication mdc_safeSharedApplication].preferredContentSizeCategory;
-  } else if (@available(iOS 10.0, *)) {
-    sizeCategory = UIScreen.mainScreen.traitCollection.preferredContentSizeCategory;
++ (nonnull UIFontDescriptor *)mdc_fontDescriptorForMaterialTextStyle:(MDCFontTextStyle)style
+                                                        sizeCategory:(NSString *)sizeCategory {
+  NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  BOOL isCacheable = ordinal != NSNotFound && style >= 0 && style < MDCFontTraitsTextStyleCount;
+  if (isCacheable) {
+    os_unfair_lock_lock(&gFontDescriptorsLock);
+    UIFontDescriptor *fontDescriptor = gFontDescriptors[style][ordinal];
+    os_unfair_lock_unlock(&gFontDescriptorsLock);
+    if (fontDescriptor) {
+      return fontDescriptor;
+    }
   }
 
+  UIFontDescriptor *fontDescriptor = MakeFontDescriptor(style, sizeCategory);
+  if (isCacheable) {
+    os_unfair_lock_lock(&gFontDescriptorsLock);
+    gFontDescriptors[style][ordinal] = fontDescriptor;
+    os_unfair_lock_unlock(&gFontDescriptorsLock);
+  }
+  return fontDescriptor;
+}
+
++ (nonnull UIFontDescriptor *)mdc_preferredFontDescriptorForMaterialTextStyle:
+    (MDCFontTextStyle)style {
+  NSString *sizeCategory = GetPreferredContentSizeCategory();
+
   return [UIFontDescriptor mdc_fontDescriptorForMaterialTextStyle:style sizeCategory:sizeCategory];
 }
 
@@ -81,3 +104,30 @@
 }
 
 @end
+
+@implementation UIFontDescriptor (MaterialTypographyPrivate)
+
++ (nullable UIFontDescriptor *)mdc_cachedFontDescriptorForMaterialTextStyle:(MDCFontTextStyle)style
+                                                               sizeCategory:
+                                                                   (NSString *)sizeCategory {
+  NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  if (ordinal == NSNotFound || style < 0 || style >= MDCFontTraitsTextStyleCount) {
+    return nil;
+  }
+  os_unfair_lock_lock(&gFontDescriptorsLock);
+  UIFontDescriptor *fontDescriptor = gFontDescriptors[style][ordinal];
+  os_unfair_lock_unlock(&gFontDescriptorsLock);
+  return fontDescriptor;
+}
+
++ (void)mdc_removeAllCachedFontDescriptors {
+  os_unfair_lock_lock(&gFontDescriptorsLock);
+  for (NSInteger style = 0; style < MDCFontTraitsTextStyleCount; ++style) {
+    for (NSInteger ordinal = 0; ordinal < MDCFontTraitsSizeCategoryCount; ++ordinal) {
+      gFontDescriptors[style][ordinal] = nil;
+    }
+  }
+  os_unfair_lock_unlock(&gFontDescriptorsLock);
+}
+
+@end
@@ -16,6 +16,40 @@
 
 #import "MDCFontTextStyle.h"
 
+/** The number of MDCFontTextStyle values. */
+#define MDCFontTraitsTextStyleCount (MDCFontTextStyleButton + 1)
+
+/**
+ The content size categories that have font traits, in increasing order of size.
+
+ Used as the column index of the font traits table.
+ */
+typedef NS_ENUM(NSInteger, MDCFontTraitsSizeCategory) {
+  MDCFontTraitsSizeCategoryExtraSmall,
+  MDCFontTraitsSizeCategorySmall,
+  MDCFontTraitsSizeCategoryMedium,
+  MDCFontTraitsSizeCategoryLarge,
+  MDCFontTraitsSizeCategoryExtraLarge,
+  MDCFontTraitsSizeCategoryExtraExtraLarge,
+  MDCFontTraitsSizeCategoryExtraExtraExtraLarge,
+  MDCFontTraitsSizeCategoryAccessibilityMedium,
+  MDCFontTraitsSizeCategoryAccessibilityLarge,
+  MDCFontTraitsSizeCategoryAccessibilityExtraLarge,
+  MDCFontTraitsSizeCategoryAccessibilityExtraExtraLarge,
+  MDCFontTraitsSizeCategoryAccessibilityExtraExtraExtraLarge,
+  MDCFontTraitsSizeCategoryCount,
+};
+
+/**
+ Returns the @c MDCFontTraitsSizeCategory of @c sizeCategory, or @c NSNotFound if it is nil or not
+ one of the UIContentSizeCategory constants with font traits.
+ */
+FOUNDATION_EXTERN NSInteger MDCFontTraitsSizeCategoryOrdinal(NSString *_Nullable sizeCategory);
+
+/** Returns the UIContentSizeCategory of @c sizeCategory, which must be less than the count. */
+FOUNDATION_EXTERN UIContentSizeCategory _Nonnull MDCFontTraitsSizeCategoryName(
+    MDCFontTraitsSizeCategory sizeCategory);
+
 /**
  Provides a means of storing defining font metrics based on size categories.
 
@@ -14,459 +14,271 @@
 
 #import "MDCFontTraits.h"
 
-static NSDictionary<NSString *, MDCFontTraits *> *_body1Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_body2Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_buttonTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_captionTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display1Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display2Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display3Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_display4Traits;
-static NSDictionary<NSString *, MDCFontTraits *> *_headlineTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_subheadlineTraits;
-static NSDictionary<NSString *, MDCFontTraits *> *_titleTraits;
+/**
+ The font weights used by the traits table.
 
-static NSDictionary<NSNumber *, NSDictionary *> *_styleTable;
+ UIFontWeight constants aren't compile-time constants, so the table stores these instead.
+ */
+typedef NS_ENUM(uint8_t, FontWeight) {
+  FontWeightRegular,
+  FontWeightLight,
+  FontWeightMedium,
+};
 
-@interface MDCFontTraits (MaterialTypographyPrivate)
+/** The font metrics for a single text style and size category. */
+typedef struct {
+  CGFloat pointSize;
+  FontWeight weight;
+  CGFloat leading;
+  CGFloat tracking;
+} FontTraitsEntry;
 
-+ (instancetype)traitsWithPointSize:(CGFloat)pointSize
-                             weight:(CGFloat)weight
-                            leading:(CGFloat)leading
-                           tracking:(CGFloat)tracking;
+/**
+ The font metrics of each text style, indexed by MDCFontTextStyle and MDCFontTraitsSizeCategory.
 
-- (instancetype)initWithPointSize:(CGFloat)pointSize
-                           weight:(CGFloat)weight
-                          leading:(CGFloat)leading
-                         tracking:(CGFloat)tracking;
-
-@end
+ Entries with a @c pointSize of 0 are not defined. Accessibility size categories are only defined
+ for the Body styles.
+ */
+static const FontTraitsEntry
+    kFontTraitsTable[MDCFontTraitsTextStyleCount][MDCFontTraitsSizeCategoryCount] = {
+        [MDCFontTextStyleBody1] =
+            {
+                {11, FontWeightRegular, 0, 0},  // ExtraSmall
+                {12, FontWeightRegular, 0, 0},  // Small
+                {13, FontWeightRegular, 0, 0},  // Medium
+                {14, FontWeightRegular, 0, 0},  // Large
+                {16, FontWeightRegular, 0, 0},  // ExtraLarge
+                {18, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {20, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+                {25, FontWeightRegular, 0, 0},  // AccessibilityMedium
+                {30, FontWeightRegular, 0, 0},  // AccessibilityLarge
+                {37, FontWeightRegular, 0, 0},  // AccessibilityExtraLarge
+                {44, FontWeightRegular, 0, 0},  // AccessibilityExtraExtraLarge
+                {52, FontWeightRegular, 0, 0},  // AccessibilityExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleBody2] =
+            {
+                {11, FontWeightMedium, 0, 0},  // ExtraSmall
+                {12, FontWeightMedium, 0, 0},  // Small
+                {13, FontWeightMedium, 0, 0},  // Medium
+                {14, FontWeightMedium, 0, 0},  // Large
+                {16, FontWeightMedium, 0, 0},  // ExtraLarge
+                {18, FontWeightMedium, 0, 0},  // ExtraExtraLarge
+                {20, FontWeightMedium, 0, 0},  // ExtraExtraExtraLarge
+                {25, FontWeightMedium, 0, 0},  // AccessibilityMedium
+                {30, FontWeightMedium, 0, 0},  // AccessibilityLarge
+                {37, FontWeightMedium, 0, 0},  // AccessibilityExtraLarge
+                {44, FontWeightMedium, 0, 0},  // AccessibilityExtraExtraLarge
+                {52, FontWeightMedium, 0, 0},  // AccessibilityExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleCaption] =
+            {
+                {11, FontWeightRegular, 0, 0},  // ExtraSmall
+                {11, FontWeightRegular, 0, 0},  // Small
+                {11, FontWeightRegular, 0, 0},  // Medium
+                {12, FontWeightRegular, 0, 0},  // Large
+                {14, FontWeightRegular, 0, 0},  // ExtraLarge
+                {16, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {18, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleHeadline] =
+            {
+                {21, FontWeightRegular, 0, 0},  // ExtraSmall
+                {22, FontWeightRegular, 0, 0},  // Small
+                {23, FontWeightRegular, 0, 0},  // Medium
+                {24, FontWeightRegular, 0, 0},  // Large
+                {26, FontWeightRegular, 0, 0},  // ExtraLarge
+                {28, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {30, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleSubheadline] =
+            {
+                {13, FontWeightRegular, 0, 0},  // ExtraSmall
+                {14, FontWeightRegular, 0, 0},  // Small
+                {15, FontWeightRegular, 0, 0},  // Medium
+                {16, FontWeightRegular, 0, 0},  // Large
+                {18, FontWeightRegular, 0, 0},  // ExtraLarge
+                {20, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {22, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleTitle] =
+            {
+                {17, FontWeightMedium, 0, 0},  // ExtraSmall
+                {18, FontWeightMedium, 0, 0},  // Small
+                {19, FontWeightMedium, 0, 0},  // Medium
+                {20, FontWeightMedium, 0, 0},  // Large
+                {22, FontWeightMedium, 0, 0},  // ExtraLarge
+                {24, FontWeightMedium, 0, 0},  // ExtraExtraLarge
+                {26, FontWeightMedium, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleDisplay1] =
+            {
+                {28, FontWeightRegular, 0, 0},  // ExtraSmall
+                {30, FontWeightRegular, 0, 0},  // Small
+                {32, FontWeightRegular, 0, 0},  // Medium
+                {34, FontWeightRegular, 0, 0},  // Large
+                {36, FontWeightRegular, 0, 0},  // ExtraLarge
+                {38, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {40, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleDisplay2] =
+            {
+                {39, FontWeightRegular, 0, 0},  // ExtraSmall
+                {41, FontWeightRegular, 0, 0},  // Small
+                {43, FontWeightRegular, 0, 0},  // Medium
+                {45, FontWeightRegular, 0, 0},  // Large
+                {47, FontWeightRegular, 0, 0},  // ExtraLarge
+                {49, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {51, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleDisplay3] =
+            {
+                {50, FontWeightRegular, 0, 0},  // ExtraSmall
+                {52, FontWeightRegular, 0, 0},  // Small
+                {54, FontWeightRegular, 0, 0},  // Medium
+                {56, FontWeightRegular, 0, 0},  // Large
+                {58, FontWeightRegular, 0, 0},  // ExtraLarge
+                {60, FontWeightRegular, 0, 0},  // ExtraExtraLarge
+                {62, FontWeightRegular, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleDisplay4] =
+            {
+                {100, FontWeightLight, 0, 0},  // ExtraSmall
+                {104, FontWeightLight, 0, 0},  // Small
+                {108, FontWeightLight, 0, 0},  // Medium
+                {112, FontWeightLight, 0, 0},  // Large
+                {116, FontWeightLight, 0, 0},  // ExtraLarge
+                {120, FontWeightLight, 0, 0},  // ExtraExtraLarge
+                {124, FontWeightLight, 0, 0},  // ExtraExtraExtraLarge
+            },
+        [MDCFontTextStyleButton] =
+            {
+                {11, FontWeightMedium, 0, 0},  // ExtraSmall
+                {12, FontWeightMedium, 0, 0},  // Small
+                {13, FontWeightMedium, 0, 0},  // Medium
+                {14, FontWeightMedium, 0, 0},  // Large
+                {16, FontWeightMedium, 0, 0},  // ExtraLarge
+                {18, FontWeightMedium, 0, 0},  // ExtraExtraLarge
+                {20, FontWeightMedium, 0, 0},  // ExtraExtraExtraLarge
+            },
+};
 
-@implementation MDCFontTraits
-
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wpartial-availability"
-+ (void)initialize {
-  _body1Traits = @{
-    UIContentSizeCategoryExtraSmall : [MDCFontTraits traitsWithPointSize:11
-                                                                  weight:UIFontWeightRegular
-                                                                 leading:0.0
-                                                                tracking:0.0],
-    UIContentSizeCategorySmall : [MDCFontTraits traitsWithPointSize:12
-                                                             weight:UIFontWeightRegular
-                                                            leading:0.0
-                                                           tracking:0.0],
-    UIContentSizeCategoryMedium : [MDCFontTraits traitsWithPointSize:13
-                                                              weight:UIFontWeightRegular
-                                                             leading:0.0
-                                                            tracking:0.0],
-    UIContentSizeCategoryLarge : [MDCFontTraits traitsWithPointSize:14
-                                                             weight:UIFontWeightRegular
-                                                            leading:0.0
-                                                           tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [MDCFontTraits traitsWithPointSize:16
-                                                                  weight:UIFontWeightRegular
-                                                                 leading:0.0
-                                                                tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge : [MDCFontTraits traitsWithPointSize:18
-                                                                       weight:UIFontWeightRegular
-                                                                      leading:0.0
-                                                                     tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:20 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityMedium :
-        [MDCFontTraits traitsWithPointSize:25 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityLarge : [MDCFontTraits traitsWithPointSize:30
-                                                                          weight:UIFontWeightRegular
-                                                                         leading:0.0
-                                                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraLarge :
-        [MDCFontTraits traitsWithPointSize:37 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:44 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge :
-        [MDCFontTraits traitsWithPointSize:52 weight:UIFontWeightRegular leading:0.0 tracking:0.0],
-  };
-
-  _body2Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityMedium :
-        [[MDCFontTraits alloc] initWithPointSize:25
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityLarge :
-        [[MDCFontTraits alloc] initWithPointSize:30
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:37
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:44
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:52
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+static MDCFontTraits *gTraitsTable[MDCFontTraitsTextStyleCount][MDCFontTraitsSizeCategoryCount];
 
-  _buttonTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
-
-  _captionTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:11
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:12
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:16
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:18
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+static CGFloat FontWeightValue(FontWeight weight) {
+  switch (weight) {
+    case FontWeightRegular:
+      return UIFontWeightRegular;
+    case FontWeightLight:
+      return UIFontWeightLight;
+    case FontWeightMedium:
+      return UIFontWeightMedium;
+  }
+  return UIFontWeightRegular;
+}
 
-  _display1Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:28
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:30
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:32
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:34
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:36
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:38
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:40
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
+NSInteger MDCFontTraitsSizeCategoryOrdinal(NSString *sizeCategory) {
+  if (sizeCategory == nil) {
+    return NSNotFound;
+  }
+  NSString *const sizeCategories[MDCFontTraitsSizeCategoryCount] = {
+      UIContentSizeCategoryExtraSmall,
+      UIContentSizeCategorySmall,
+      UIContentSizeCategoryMedium,
+      UIContentSizeCategoryLarge,
+      UIContentSizeCategoryExtraLarge,
+      UIContentSizeCategoryExtraExtraLarge,
+      UIContentSizeCategoryExtraExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityMedium,
+      UIContentSizeCategoryAccessibilityLarge,
+      UIContentSizeCategoryAccessibilityExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraLarge,
+      UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
   };
 
-  _display2Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:39
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:41
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:43
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:45
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:47
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:49
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:51
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+  // Size categories almost always come from the UIKit constants, so compare pointers first.
+  for (NSInteger i = 0; i < MDCFontTraitsSizeCategoryCount; ++i) {
+    if (sizeCategory == sizeCategories[i]) {
+      return i;
+    }
+  }
+  for (NSInteger i = 0; i < MDCFontTraitsSizeCategoryCount; ++i) {
+    if ([sizeCategory isEqualToString:sizeCategories[i]]) {
+      return i;
+    }
+  }
+  return NSNotFound;
+}
 
-  _display3Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:50
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:52
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:54
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:56
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:58
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:60
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:62
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+UIContentSizeCategory MDCFontTraitsSizeCategoryName(MDCFontTraitsSizeCategory sizeCategory) {
+  switch (sizeCategory) {
+    case MDCFontTraitsSizeCategoryExtraSmall:
+      return UIContentSizeCategoryExtraSmall;
+    case MDCFontTraitsSizeCategorySmall:
+      return UIContentSizeCategorySmall;
+    case MDCFontTraitsSizeCategoryMedium:
+      return UIContentSizeCategoryMedium;
+    case MDCFontTraitsSizeCategoryLarge:
+      return UIContentSizeCategoryLarge;
+    case MDCFontTraitsSizeCategoryExtraLarge:
+      return UIContentSizeCategoryExtraLarge;
+    case MDCFontTraitsSizeCategoryExtraExtraLarge:
+      return UIContentSizeCategoryExtraExtraLarge;
+    case MDCFontTraitsSizeCategoryExtraExtraExtraLarge:
+      return UIContentSizeCategoryExtraExtraExtraLarge;
+    case MDCFontTraitsSizeCategoryAccessibilityMedium:
+      return UIContentSizeCategoryAccessibilityMedium;
+    case MDCFontTraitsSizeCategoryAccessibilityLarge:
+      return UIContentSizeCategoryAccessibilityLarge;
+    case MDCFontTraitsSizeCategoryAccessibilityExtraLarge:
+      return UIContentSizeCategoryAccessibilityExtraLarge;
+    case MDCFontTraitsSizeCategoryAccessibilityExtraExtraLarge:
+      return UIContentSizeCategoryAccessibilityExtraExtraLarge;
+    case MDCFontTraitsSizeCategoryAccessibilityExtraExtraExtraLarge:
+      return UIContentSizeCategoryAccessibilityExtraExtraExtraLarge;
+    case MDCFontTraitsSizeCategoryCount:
+      break;
+  }
+  NSCAssert(NO, @"Size category %@ is out of range.", @(sizeCategory));
+  return UIContentSizeCategoryLarge;
+}
 
-  _display4Traits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:100
-                                                                        weight:UIFontWeightLight
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:104
-                                                                   weight:UIFontWeightLight
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:108
-                                                                    weight:UIFontWeightLight
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:112
-                                                                   weight:UIFontWeightLight
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:116
-                                                                        weight:UIFontWeightLight
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:120
-                                          weight:UIFontWeightLight
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:124
-                                          weight:UIFontWeightLight
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@interface MDCFontTraits (MaterialTypographyPrivate)
 
-  _headlineTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:21
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:22
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:23
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:24
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:26
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:28
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:30
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+- (instancetype)initWithPointSize:(CGFloat)pointSize
+                           weight:(CGFloat)weight
+                          leading:(CGFloat)leading
+                         tracking:(CGFloat)tracking;
 
-  _subheadlineTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:13
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:14
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:15
-                                                                    weight:UIFontWeightRegular
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:16
-                                                                   weight:UIFontWeightRegular
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:18
-                                                                        weight:UIFontWeightRegular
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:20
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:22
-                                          weight:UIFontWeightRegular
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@end
 
-  _titleTraits = @{
-    UIContentSizeCategoryExtraSmall : [[MDCFontTraits alloc] initWithPointSize:17
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategorySmall : [[MDCFontTraits alloc] initWithPointSize:18
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryMedium : [[MDCFontTraits alloc] initWithPointSize:19
-                                                                    weight:UIFontWeightMedium
-                                                                   leading:0.0
-                                                                  tracking:0.0],
-    UIContentSizeCategoryLarge : [[MDCFontTraits alloc] initWithPointSize:20
-                                                                   weight:UIFontWeightMedium
-                                                                  leading:0.0
-                                                                 tracking:0.0],
-    UIContentSizeCategoryExtraLarge : [[MDCFontTraits alloc] initWithPointSize:22
-                                                                        weight:UIFontWeightMedium
-                                                                       leading:0.0
-                                                                      tracking:0.0],
-    UIContentSizeCategoryExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:24
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-    UIContentSizeCategoryExtraExtraExtraLarge :
-        [[MDCFontTraits alloc] initWithPointSize:26
-                                          weight:UIFontWeightMedium
-                                         leading:0.0
-                                        tracking:0.0],
-  };
+@implementation MDCFontTraits
 
-  _styleTable = @{
-    @(MDCFontTextStyleBody1) : _body1Traits,
-    @(MDCFontTextStyleBody2) : _body2Traits,
-    @(MDCFontTextStyleButton) : _buttonTraits,
-    @(MDCFontTextStyleCaption) : _captionTraits,
-    @(MDCFontTextStyleDisplay1) : _display1Traits,
-    @(MDCFontTextStyleDisplay2) : _display2Traits,
-    @(MDCFontTextStyleDisplay3) : _display3Traits,
-    @(MDCFontTextStyleDisplay4) : _display4Traits,
-    @(MDCFontTextStyleHeadline) : _headlineTraits,
-    @(MDCFontTextStyleSubheadline) : _subheadlineTraits,
-    @(MDCFontTextStyleTitle) : _titleTraits
-  };
-}
-#pragma clang diagnostic pop
++ (void)initialize {
+  if (self != [MDCFontTraits class]) {
+    return;
+  }
 
-+ (instancetype)traitsWithPointSize:(CGFloat)pointSize
-                             weight:(CGFloat)weight
-                            leading:(CGFloat)leading
-                           tracking:(CGFloat)tracking {
-  return [[MDCFontTraits alloc] initWithPointSize:pointSize
-                                           weight:weight
-                                          leading:leading
-                                         tracking:tracking];
+  for (NSInteger style = 0; style < MDCFontTraitsTextStyleCount; ++style) {
+    for (NSInteger category = 0; category < MDCFontTraitsSizeCategoryCount; ++category) {
+      const FontTraitsEntry *entry = &kFontTraitsTable[style][category];
+      if (entry->pointSize > 0) {
+        gTraitsTable[style][category] =
+            [[MDCFontTraits alloc] initWithPointSize:entry->pointSize
+                                              weight:FontWeightValue(entry->weight)
+                                             leading:entry->leading
+                                            tracking:entry->tracking];
+      } else {
+        // If you have queried the table for a sizeCategory that doesn't exist, we will return the
+        // traits for XXXL. This handles the case where the values are requested for one of the
+        // accessibility size categories beyond XXXL such as
+        // UIContentSizeCategoryAccessibilityExtraLarge. Accessibility size categories are only
+        // defined for the Body Font Style.
+        gTraitsTable[style][category] =
+            gTraitsTable[style][MDCFontTraitsSizeCategoryExtraExtraExtraLarge];
+      }
+    }
+  }
 }
 
 - (instancetype)initWithPointSize:(CGFloat)pointSize
@@ -486,26 +298,17 @@ static NSDictionary<NSNumber *, NSDictionary *> *_styleTable;
 
 + (MDCFontTraits *)traitsForTextStyle:(MDCFontTextStyle)style
                          sizeCategory:(NSString *)sizeCategory {
-  NSDictionary *traitsTable = _styleTable[@(style)];
-  NSCAssert(traitsTable, @"traitsTable cannot be nil. Is style valid?");
-
-  MDCFontTraits *traits;
-  if (traitsTable) {
-    if (sizeCategory) {
-      traits = traitsTable[sizeCategory];
-    }
-
-    // If you have queried the table for a sizeCategory that doesn't exist, we will return the
-    // traits for XXXL.  This handles the case where the values are requested for one of the
-    // accessibility size categories beyond XXXL such as
-    // UIContentSizeCategoryAccessibilityExtraLarge.  Accessbility size categories are only
-    // defined for the Body Font Style.
-    if (traits == nil) {
-      traits = traitsTable[UIContentSizeCategoryExtraExtraExtraLarge];
-    }
+  BOOL isStyleValid = style >= 0 && style < MDCFontTraitsTextStyleCount;
+  NSCAssert(isStyleValid, @"traitsTable cannot be nil. Is style valid?");
+  if (!isStyleValid) {
+    return nil;
   }
 
-  return traits;
+  NSInteger category = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  if (category == NSNotFound) {
+    category = MDCFontTraitsSizeCategoryExtraExtraExtraLarge;
+  }
+  return gTraitsTable[style][category];
 }
 
 @end
@@ -0,0 +1,83 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "MDCFontTraits.h"
+#import "UIFont+MaterialScalable.h"
+
+/**
+ An immutable scaling curve stored as one point size per @c MDCFontTraitsSizeCategory, so that
+ looking up a size category is an array index rather than a dictionary lookup.
+
+ The identity of a table also identifies its curve: fonts scaled with a table share that table.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCScalingCurveTable : NSObject
+
+/** The scaling curve the table was created with. */
+@property(nonatomic, readonly, nonnull) MDCScalingCurve scalingCurve;
+
+/**
+ Creates a table from @c scalingCurve. Size categories missing from the curve have a point size
+ of 0.
+ */
+- (nonnull instancetype)initWithScalingCurve:(nonnull MDCScalingCurve)scalingCurve
+    NS_DESIGNATED_INITIALIZER;
+
+/**
+ Creates a table from @c pointSizes, which must hold one point size per
+ @c MDCFontTraitsSizeCategory. The point sizes are copied.
+ */
+- (nonnull instancetype)initWithPointSizes:(const CGFloat *_Nonnull)pointSizes
+    NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+/**
+ Returns the point size for @c sizeCategory, or 0 if the curve doesn't define one.
+
+ Size categories without an @c MDCFontTraitsSizeCategory are looked up in @c scalingCurve.
+ */
+- (CGFloat)pointSizeForSizeCategory:(nonnull UIContentSizeCategory)sizeCategory;
+
+/** Returns the point size for @c sizeCategory, which must be less than the category count. */
+- (CGFloat)pointSizeForSizeCategoryOrdinal:(MDCFontTraitsSizeCategory)sizeCategory;
+
+@end
+
+/**
+ Returns the cached result of scaling @c font with @c scalingCurveTable, or nil.
+
+ @c variant distinguishes different ways of scaling the same font, such as the size category the
+ font was scaled to.
+ */
+FOUNDATION_EXTERN UIFont *_Nullable MDCScaledFontCacheLookup(
+    UIFont *_Nonnull font, MDCScalingCurveTable *_Nonnull scalingCurveTable, NSInteger variant);
+
+/**
+ Caches @c scaledFont as the result of scaling @c font with @c scalingCurveTable.
+
+ The cache holds a bounded number of fonts and is cleared when the content size category changes.
+ */
+FOUNDATION_EXTERN void MDCScaledFontCacheStore(UIFont *_Nonnull font,
+                                               MDCScalingCurveTable *_Nonnull scalingCurveTable,
+                                               NSInteger variant, UIFont *_Nonnull scaledFont);
+
+@interface UIFont (MaterialScalablePrivate)
+
+/** The table backing @c mdc_scalingCurve. */
+@property(nonatomic, strong, nullable, setter=mdc_setScalingCurveTable:)
+    MDCScalingCurveTable *mdc_scalingCurveTable;
+
+@end
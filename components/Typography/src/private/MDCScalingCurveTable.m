@@ -0,0 +1,141 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCScalingCurveTable.h"
+
+#import <os/lock.h>
+
+/** The number of entries of the scaled font cache. Must be a power of 2. */
+#define kScaledFontCacheSize 256
+
+@implementation MDCScalingCurveTable {
+  CGFloat _pointSizes[MDCFontTraitsSizeCategoryCount];
+}
+
+- (instancetype)initWithScalingCurve:(MDCScalingCurve)scalingCurve {
+  self = [super init];
+  if (self) {
+    _scalingCurve = [scalingCurve copy];
+    for (UIContentSizeCategory sizeCategory in _scalingCurve) {
+      NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+      if (ordinal != NSNotFound) {
+        _pointSizes[ordinal] = (CGFloat)_scalingCurve[sizeCategory].doubleValue;
+      }
+    }
+  }
+  return self;
+}
+
+- (instancetype)initWithPointSizes:(const CGFloat *)pointSizes {
+  self = [super init];
+  if (self) {
+    NSMutableDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve =
+        [NSMutableDictionary dictionaryWithCapacity:MDCFontTraitsSizeCategoryCount];
+    for (NSInteger i = 0; i < MDCFontTraitsSizeCategoryCount; ++i) {
+      _pointSizes[i] = pointSizes[i];
+      scalingCurve[MDCFontTraitsSizeCategoryName(i)] = @(pointSizes[i]);
+    }
+    _scalingCurve = [scalingCurve copy];
+  }
+  return self;
+}
+
+- (CGFloat)pointSizeForSizeCategory:(UIContentSizeCategory)sizeCategory {
+  NSInteger ordinal = MDCFontTraitsSizeCategoryOrdinal(sizeCategory);
+  if (ordinal != NSNotFound) {
+    return _pointSizes[ordinal];
+  }
+  return (CGFloat)_scalingCurve[sizeCategory].doubleValue;
+}
+
+- (CGFloat)pointSizeForSizeCategoryOrdinal:(MDCFontTraitsSizeCategory)sizeCategory {
+  NSCAssert(sizeCategory >= 0 && sizeCategory < MDCFontTraitsSizeCategoryCount,
+            @"Size category %@ is out of range.", @(sizeCategory));
+  return _pointSizes[sizeCategory];
+}
+
+@end
+
+#pragma mark - Scaled font cache
+
+/**
+ A process-wide, direct-mapped cache of scaled fonts. The cache retains the fonts and tables of its
+ keys, so their addresses can't be reused by other objects while an entry refers to them.
+ */
+static UIFont *gCachedFonts[kScaledFontCacheSize];
+static MDCScalingCurveTable *gCachedScalingCurveTables[kScaledFontCacheSize];
+static NSInteger gCachedVariants[kScaledFontCacheSize];
+static UIFont *gCachedScaledFonts[kScaledFontCacheSize];
+static os_unfair_lock gScaledFontCacheLock = OS_UNFAIR_LOCK_INIT;
+
+static void ClearScaledFontCache(void) {
+  os_unfair_lock_lock(&gScaledFontCacheLock);
+  for (NSUInteger i = 0; i < kScaledFontCacheSize; ++i) {
+    gCachedFonts[i] = nil;
+    gCachedScalingCurveTables[i] = nil;
+    gCachedScaledFonts[i] = nil;
+  }
+  os_unfair_lock_unlock(&gScaledFontCacheLock);
+}
+
+static void ObserveContentSizeCategoryChanges(void) {
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    [[NSNotificationCenter defaultCenter]
+        addObserverForName:UIContentSizeCategoryDidChangeNotification
+                    object:nil
+                     queue:nil
+                usingBlock:^(__unused NSNotification *notification) {
+                  ClearScaledFontCache();
+                }];
+  });
+}
+
+static NSUInteger ScaledFontCacheSlot(UIFont *font,
+                                      MDCScalingCurveTable *scalingCurveTable,
+                                      NSInteger variant) {
+  uint64_t hash = (uint64_t)(uintptr_t)(__bridge void *)font;
+  hash ^= (uint64_t)(uintptr_t)(__bridge void *)scalingCurveTable * 0x9E3779B97F4A7C15ULL;
+  hash ^= (uint64_t)variant * 0xC2B2AE3D27D4EB4FULL;
+  hash ^= hash >> 29;
+  return (NSUInteger)hash & (kScaledFontCacheSize - 1);
+}
+
+UIFont *MDCScaledFontCacheLookup(UIFont *font,
+                                 MDCScalingCurveTable *scalingCurveTable,
+                                 NSInteger variant) {
+  NSUInteger slot = ScaledFontCacheSlot(font, scalingCurveTable, variant);
+  UIFont *scaledFont = nil;
+  os_unfair_lock_lock(&gScaledFontCacheLock);
+  if (gCachedFonts[slot] == font && gCachedScalingCurveTables[slot] == scalingCurveTable &&
+      gCachedVariants[slot] == variant) {
+    scaledFont = gCachedScaledFonts[slot];
+  }
+  os_unfair_lock_unlock(&gScaledFontCacheLock);
+  return scaledFont;
+}
+
+void MDCScaledFontCacheStore(UIFont *font,
+                             MDCScalingCurveTable *scalingCurveTable,
+                             NSInteger variant,
+                             UIFont *scaledFont) {
+  ObserveContentSizeCategoryChanges();
+  NSUInteger slot = ScaledFontCacheSlot(font, scalingCurveTable, variant);
+  os_unfair_lock_lock(&gScaledFontCacheLock);
+  gCachedFonts[slot] = font;
+  gCachedScalingCurveTables[slot] = scalingCurveTable;
+  gCachedVariants[slot] = variant;
+  gCachedScaledFonts[slot] = scaledFont;
+  os_unfair_lock_unlock(&gScaledFontCacheLock);
+}
@@ -15,3 +15,9 @@
 #import <UIKit/UIKit.h>
 
 UIContentSizeCategory GetCurrentSizeCategory(void);
+
+/**
+ @return The shared application's preferredContentSizeCategory, or the main screen's if there is no
+ shared application. Must be called on the main thread.
+ */
+UIContentSizeCategory GetPreferredContentSizeCategory(void);
@@ -30,3 +30,17 @@ UIContentSizeCategory GetCurrentSizeCategory(void) {
 
   return sizeCategory;
 }
+
+UIContentSizeCategory GetPreferredContentSizeCategory(void) {
+  // iOS' default UIContentSizeCategory is Large.
+  UIContentSizeCategory sizeCategory = UIContentSizeCategoryLarge;
+
+  // If we are within an application, query the preferredContentSizeCategory.
+  if ([UIApplication mdc_safeSharedApplication]) {
+    sizeCategory = [UIApplication mdc_safeSharedApplication].preferredContentSizeCategory;
+  } else if (@available(iOS 10.0, *)) {
+    sizeCategory = UIScreen.mainScreen.traitCollection.preferredContentSizeCategory;
+  }
+
+  return sizeCategory;
+}
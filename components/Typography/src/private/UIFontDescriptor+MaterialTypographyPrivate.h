@@ -0,0 +1,32 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "MDCFontTextStyle.h"
+
+@interface UIFontDescriptor (MaterialTypographyPrivate)
+
+/**
+ Returns the font descriptor cached for @c style and @c sizeCategory, or nil if it hasn't been
+ created yet. Unlike @c +mdc_fontDescriptorForMaterialTextStyle:sizeCategory:, never creates one.
+ */
++ (nullable UIFontDescriptor *)mdc_cachedFontDescriptorForMaterialTextStyle:(MDCFontTextStyle)style
+                                                               sizeCategory:
+                                                                   (nonnull NSString *)sizeCategory;
+
+/** Removes every cached font descriptor, so that the next request for each one creates it. */
++ (void)mdc_removeAllCachedFontDescriptors;
+
+@end
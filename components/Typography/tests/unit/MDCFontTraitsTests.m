@@ -0,0 +1,146 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "../../src/private/MDCFontTraits.h"
+#import "MaterialTypography.h"
+
+/**
+ The point sizes of every text style and size category, as defined by the dictionary tables that
+ MDCFontTraits used before it was backed by a struct table.
+ */
+static const CGFloat
+    kExpectedPointSizes[MDCFontTraitsTextStyleCount][MDCFontTraitsSizeCategoryCount] = {
+        [MDCFontTextStyleBody1] = {11, 12, 13, 14, 16, 18, 20, 25, 30, 37, 44, 52},
+        [MDCFontTextStyleBody2] = {11, 12, 13, 14, 16, 18, 20, 25, 30, 37, 44, 52},
+        [MDCFontTextStyleCaption] = {11, 11, 11, 12, 14, 16, 18, 18, 18, 18, 18, 18},
+        [MDCFontTextStyleHeadline] = {21, 22, 23, 24, 26, 28, 30, 30, 30, 30, 30, 30},
+        [MDCFontTextStyleSubheadline] = {13, 14, 15, 16, 18, 20, 22, 22, 22, 22, 22, 22},
+        [MDCFontTextStyleTitle] = {17, 18, 19, 20, 22, 24, 26, 26, 26, 26, 26, 26},
+        [MDCFontTextStyleDisplay1] = {28, 30, 32, 34, 36, 38, 40, 40, 40, 40, 40, 40},
+        [MDCFontTextStyleDisplay2] = {39, 41, 43, 45, 47, 49, 51, 51, 51, 51, 51, 51},
+        [MDCFontTextStyleDisplay3] = {50, 52, 54, 56, 58, 60, 62, 62, 62, 62, 62, 62},
+        [MDCFontTextStyleDisplay4] = {100, 104, 108, 112, 116, 120, 124, 124, 124, 124, 124, 124},
+        [MDCFontTextStyleButton] = {11, 12, 13, 14, 16, 18, 20, 20, 20, 20, 20, 20},
+};
+
+static CGFloat ExpectedWeight(MDCFontTextStyle style) {
+  switch (style) {
+    case MDCFontTextStyleBody1:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleBody2:
+      return UIFontWeightMedium;
+    case MDCFontTextStyleCaption:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleHeadline:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleSubheadline:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleTitle:
+      return UIFontWeightMedium;
+    case MDCFontTextStyleDisplay1:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleDisplay2:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleDisplay3:
+      return UIFontWeightRegular;
+    case MDCFontTextStyleDisplay4:
+      return UIFontWeightLight;
+    case MDCFontTextStyleButton:
+      return UIFontWeightMedium;
+  }
+  return UIFontWeightRegular;
+}
+
+static NSArray<UIContentSizeCategory> *SizeCategories(void) {
+  return @[
+    UIContentSizeCategoryExtraSmall,
+    UIContentSizeCategorySmall,
+    UIContentSizeCategoryMedium,
+    UIContentSizeCategoryLarge,
+    UIContentSizeCategoryExtraLarge,
+    UIContentSizeCategoryExtraExtraLarge,
+    UIContentSizeCategoryExtraExtraExtraLarge,
+    UIContentSizeCategoryAccessibilityMedium,
+    UIContentSizeCategoryAccessibilityLarge,
+    UIContentSizeCategoryAccessibilityExtraLarge,
+    UIContentSizeCategoryAccessibilityExtraExtraLarge,
+    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge,
+  ];
+}
+
+@interface MDCFontTraitsTests : XCTestCase
+@end
+
+@implementation MDCFontTraitsTests
+
+- (void)testTraitsMatchExpectedValuesForEveryStyleAndSizeCategory {
+  NSArray<UIContentSizeCategory> *sizeCategories = SizeCategories();
+  for (NSInteger style = 0; style < MDCFontTraitsTextStyleCount; ++style) {
+    for (NSInteger category = 0; category < MDCFontTraitsSizeCategoryCount; ++category) {
+      // When
+      MDCFontTraits *traits = [MDCFontTraits traitsForTextStyle:style
+                                                   sizeCategory:sizeCategories[category]];
+
+      // Then
+      XCTAssertEqual(traits.pointSize, kExpectedPointSizes[style][category], @"style %@, %@",
+                     @(style), sizeCategories[category]);
+      XCTAssertEqual(traits.weight, ExpectedWeight(style), @"style %@", @(style));
+      XCTAssertEqual(traits.leading, 0.0);
+      XCTAssertEqual(traits.tracking, 0.0);
+    }
+  }
+}
+
+- (void)testSizeCategoryOrdinalMatchesEqualStringsThatAreNotTheUIKitConstants {
+  NSArray<UIContentSizeCategory> *sizeCategories = SizeCategories();
+  for (NSInteger category = 0; category < MDCFontTraitsSizeCategoryCount; ++category) {
+    // Given
+    NSString *sizeCategory = [sizeCategories[category] mutableCopy];
+
+    // Then
+    XCTAssertEqual(MDCFontTraitsSizeCategoryOrdinal(sizeCategory), category);
+  }
+}
+
+- (void)testUnknownSizeCategoryFallsBackToExtraExtraExtraLarge {
+  // When
+  MDCFontTraits *unknownTraits = [MDCFontTraits traitsForTextStyle:MDCFontTextStyleBody1
+                                                      sizeCategory:@"notASizeCategory"];
+  MDCFontTraits *unspecifiedTraits =
+      [MDCFontTraits traitsForTextStyle:MDCFontTextStyleBody1
+                           sizeCategory:UIContentSizeCategoryUnspecified];
+
+  // Then
+  MDCFontTraits *expectedTraits =
+      [MDCFontTraits traitsForTextStyle:MDCFontTextStyleBody1
+                           sizeCategory:UIContentSizeCategoryExtraExtraExtraLarge];
+  XCTAssertEqual(MDCFontTraitsSizeCategoryOrdinal(@"notASizeCategory"), NSNotFound);
+  XCTAssertEqual(unknownTraits, expectedTraits);
+  XCTAssertEqual(unspecifiedTraits, expectedTraits);
+}
+
+- (void)testRepeatedLookupsReturnTheSameInstance {
+  // When
+  MDCFontTraits *first = [MDCFontTraits traitsForTextStyle:MDCFontTextStyleHeadline
+                                              sizeCategory:UIContentSizeCategoryLarge];
+  MDCFontTraits *second = [MDCFontTraits traitsForTextStyle:MDCFontTextStyleHeadline
+                                               sizeCategory:UIContentSizeCategoryLarge];
+
+  // Then
+  XCTAssertEqual(first, second);
+}
+
+@end
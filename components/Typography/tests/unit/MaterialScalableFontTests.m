@@ -182,6 +182,98 @@
   XCTAssertNotNil(bodyScalableFont.mdc_scalingCurve);
 }
 
+- (void)testScalerForMaterialTextStyleReturnsTheSameScaler {
+  // When
+  MDCFontScaler *scaler1 = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline1];
+  MDCFontScaler *scaler2 = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleHeadline1];
+  MDCFontScaler *bodyScaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+  MDCFontScaler *invalidScaler =
+      [MDCFontScaler scalerForMaterialTextStyle:@"IntentionallyNonTextStyleString"];
+
+  // Then
+  XCTAssertEqual(scaler1, scaler2);
+  XCTAssertNotEqual(scaler1, bodyScaler);
+  XCTAssertNotEqual(invalidScaler, bodyScaler);
+}
+
+- (void)testInvalidStyleScalerKeepsItsTextStyle {
+  // When
+  MDCFontScaler *scaler =
+      [[MDCFontScaler alloc] initForMaterialTextStyle:@"IntentionallyNonTextStyleString"];
+  MDCFontScaler *sharedScaler =
+      [MDCFontScaler scalerForMaterialTextStyle:@"IntentionallyNonTextStyleString"];
+
+  // Then
+  XCTAssertTrue([scaler.description hasSuffix:@"IntentionallyNonTextStyleString"]);
+  XCTAssertTrue([sharedScaler.description hasSuffix:@"IntentionallyNonTextStyleString"]);
+  XCTAssertFalse([scaler.description containsString:MDCTextStyleBody1]);
+}
+
+- (void)testScalersOfTheSameTextStyleAttachTheSameScalingCurve {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  MDCFontScaler *scaler1 = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleCaption];
+  MDCFontScaler *scaler2 = [[MDCFontScaler alloc] initForMaterialTextStyle:MDCTextStyleCaption];
+
+  // When
+  UIFont *scaledFont1 = [scaler1 scaledFontWithFont:font];
+  UIFont *scaledFont2 = [scaler2 scaledFontWithFont:font];
+
+  // Then
+  XCTAssertEqual(scaledFont1.mdc_scalingCurve, scaledFont2.mdc_scalingCurve);
+}
+
+- (void)testScalingCurveOfStandardTextStyle {
+  // Given
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleOverline];
+
+  // When
+  UIFont *scaledFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:18.0]];
+
+  // Then
+  NSDictionary<UIContentSizeCategory, NSNumber *> *expectedScalingCurve = @{
+    UIContentSizeCategoryExtraSmall : @8,
+    UIContentSizeCategorySmall : @8,
+    UIContentSizeCategoryMedium : @9,
+    UIContentSizeCategoryLarge : @10,
+    UIContentSizeCategoryExtraLarge : @12,
+    UIContentSizeCategoryExtraExtraLarge : @14,
+    UIContentSizeCategoryExtraExtraExtraLarge : @16,
+    UIContentSizeCategoryAccessibilityMedium : @18,
+    UIContentSizeCategoryAccessibilityLarge : @20,
+    UIContentSizeCategoryAccessibilityExtraLarge : @22,
+    UIContentSizeCategoryAccessibilityExtraExtraLarge : @24,
+    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @26
+  };
+  XCTAssertEqualObjects(scaledFont.mdc_scalingCurve, expectedScalingCurve);
+}
+
+- (void)testScaledValueMatchesScaledFontPointSize {
+  // Given
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+  UIFont *scaledFont = [scaler scaledFontWithFont:[UIFont systemFontOfSize:16.0]];
+
+  // When
+  CGFloat scaledValue = [scaler scaledValueForValue:16.0];
+
+  // Then
+  XCTAssertEqualWithAccuracy(scaledValue, scaledFont.pointSize, 0.001);
+}
+
+- (void)testPerformanceOfScalingValues {
+  // Given
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+
+  // Then
+  [self measureBlock:^{
+    CGFloat value = 0.0;
+    for (NSUInteger i = 0; i < 100000; ++i) {
+      value += [scaler scaledValueForValue:(CGFloat)i];
+    }
+    XCTAssertGreaterThanOrEqual(value, 0.0);
+  }];
+}
+
 @end
 
 @interface MaterialScalableFontTests : XCTestCase
@@ -303,4 +395,107 @@
 }
  */
 
+#pragma mark - Scaled font cache
+
+- (NSDictionary<UIContentSizeCategory, NSNumber *> *)linearScalingCurve {
+  return @{
+    UIContentSizeCategoryExtraSmall : @10,
+    UIContentSizeCategorySmall : @11,
+    UIContentSizeCategoryMedium : @12,
+    UIContentSizeCategoryLarge : @13,
+    UIContentSizeCategoryExtraLarge : @14,
+    UIContentSizeCategoryExtraExtraLarge : @15,
+    UIContentSizeCategoryExtraExtraExtraLarge : @16,
+    UIContentSizeCategoryAccessibilityMedium : @17,
+    UIContentSizeCategoryAccessibilityLarge : @18,
+    UIContentSizeCategoryAccessibilityExtraLarge : @19,
+    UIContentSizeCategoryAccessibilityExtraExtraLarge : @20,
+    UIContentSizeCategoryAccessibilityExtraExtraExtraLarge : @21,
+  };
+}
+
+- (void)testRepeatedScalingReturnsTheCachedFont {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  font.mdc_scalingCurve = [self linearScalingCurve];
+
+  // When
+  UIFont *scaledFont = [font mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraLarge];
+  UIFont *rescaledFont = [font mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraLarge];
+
+  // Then
+  XCTAssertEqual(scaledFont, rescaledFont);
+  XCTAssertEqualWithAccuracy(rescaledFont.pointSize, 14, 0.001);
+  XCTAssertEqualObjects(rescaledFont.mdc_scalingCurve, [self linearScalingCurve]);
+}
+
+- (void)testScalingAfterTheCurveChangesUsesTheNewCurve {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  font.mdc_scalingCurve = [self linearScalingCurve];
+  (void)[font mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraLarge];
+  NSMutableDictionary<UIContentSizeCategory, NSNumber *> *largerScalingCurve =
+      [[self linearScalingCurve] mutableCopy];
+  largerScalingCurve[UIContentSizeCategoryExtraLarge] = @30;
+
+  // When
+  font.mdc_scalingCurve = largerScalingCurve;
+  UIFont *scaledFont = [font mdc_scaledFontForSizeCategory:UIContentSizeCategoryExtraLarge];
+
+  // Then
+  XCTAssertEqualWithAccuracy(scaledFont.pointSize, 30, 0.001);
+  XCTAssertEqualObjects(scaledFont.mdc_scalingCurve, largerScalingCurve);
+}
+
+- (void)testScalingForACustomSizeCategoryReadsTheScalingCurve {
+  // Given
+  UIContentSizeCategory customSizeCategory = @"customSizeCategory";
+  NSMutableDictionary<UIContentSizeCategory, NSNumber *> *scalingCurve =
+      [[self linearScalingCurve] mutableCopy];
+  scalingCurve[customSizeCategory] = @40;
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  font.mdc_scalingCurve = scalingCurve;
+
+  // When
+  UIFont *scaledFont = [font mdc_scaledFontForSizeCategory:customSizeCategory];
+
+  // Then
+  XCTAssertEqualWithAccuracy(scaledFont.pointSize, 40, 0.001);
+}
+
+- (void)testScalingAfterContentSizeCategoryChangeReturnsCorrectFonts {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  font.mdc_scalingCurve = [self linearScalingCurve];
+  MDCFontScaler *scaler = [MDCFontScaler scalerForMaterialTextStyle:MDCTextStyleBody1];
+  UIFont *scalerFont = [scaler scaledFontWithFont:font];
+  (void)[font mdc_scaledFontForSizeCategory:UIContentSizeCategorySmall];
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIContentSizeCategoryDidChangeNotification
+                    object:nil];
+
+  // Then
+  XCTAssertEqualWithAccuracy(
+      [font mdc_scaledFontForSizeCategory:UIContentSizeCategorySmall].pointSize, 11, 0.001);
+  XCTAssertTrue([[scaler scaledFontWithFont:font] mdc_isSimplyEqual:scalerFont]);
+}
+
+- (void)testPerformanceOfScalingForEverySizeCategory {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:18.0];
+  font.mdc_scalingCurve = [self linearScalingCurve];
+  NSArray<UIContentSizeCategory> *sizeCategories = [self linearScalingCurve].allKeys;
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 1000; ++i) {
+      for (UIContentSizeCategory sizeCategory in sizeCategories) {
+        (void)[font mdc_scaledFontForSizeCategory:sizeCategory];
+      }
+    }
+  }];
+}
+
 @end
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #import <XCTest/XCTest.h>
+#import "../../src/private/MDCSystemFontLoader+Private.h"
 #import "MaterialTypography.h"
 
 @interface SystemFontLoaderTests : XCTestCase
@@ -108,4 +109,97 @@
 #pragma clang diagnostic pop
 }
 
+#pragma mark - Font cache
+
+- (void)testRepeatedRequestsReturnTheCachedFont {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  // Then
+  XCTAssertEqual([fontLoader regularFontOfSize:14], [fontLoader regularFontOfSize:14]);
+  XCTAssertEqual([fontLoader boldItalicFontOfSize:14], [fontLoader boldItalicFontOfSize:14]);
+}
+
+- (void)testFontsAreCachedPerWeightAndSize {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  // When
+  UIFont *regularFont = [fontLoader regularFontOfSize:14];
+  UIFont *mediumFont = [fontLoader mediumFontOfSize:14];
+  UIFont *largerRegularFont = [fontLoader regularFontOfSize:(CGFloat)14.5];
+
+  // Then
+  XCTAssertEqualWithAccuracy(regularFont.pointSize, 14, 0.001);
+  XCTAssertEqualWithAccuracy(largerRegularFont.pointSize, 14.5, 0.001);
+  XCTAssertNotEqualObjects(regularFont, mediumFont);
+  XCTAssertNotEqualObjects(regularFont, largerRegularFont);
+}
+
+- (void)testRequestingMoreSizesThanTheCacheHoldsReturnsCorrectFonts {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  for (NSUInteger pass = 0; pass < 2; ++pass) {
+    for (NSUInteger i = 1; i <= 500; ++i) {
+      // When
+      CGFloat size = (CGFloat)i / 4;
+      UIFont *font = [fontLoader regularFontOfSize:size];
+
+      // Then
+      XCTAssertEqualWithAccuracy(font.pointSize, size, 0.001);
+    }
+  }
+}
+
+- (void)testCachedFontRequestsOnlyHitTheCache {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  [fontLoader regularFontOfSize:14];
+  [fontLoader mediumFontOfSize:14];
+  NSUInteger missCount = fontLoader.fontCacheMissCount;
+  NSUInteger hitCount = fontLoader.fontCacheHitCount;
+
+  // When
+  for (NSUInteger i = 0; i < 1000; ++i) {
+    [fontLoader regularFontOfSize:14];
+    [fontLoader mediumFontOfSize:14];
+  }
+
+  // Then
+  XCTAssertEqual(fontLoader.fontCacheMissCount, missCount);
+  XCTAssertEqual(fontLoader.fontCacheHitCount - hitCount, 2000U);
+}
+
+- (void)testContentSizeCategoryChangeClearsTheCache {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+  UIFont *font = [fontLoader regularFontOfSize:14];
+  NSUInteger missCount = fontLoader.fontCacheMissCount;
+
+  // When
+  [[NSNotificationCenter defaultCenter]
+      postNotificationName:UIContentSizeCategoryDidChangeNotification
+                    object:nil];
+  UIFont *fontAfterChange = [fontLoader regularFontOfSize:14];
+
+  // Then
+  XCTAssertEqual(fontLoader.fontCacheMissCount - missCount, 1U);
+  XCTAssertEqualObjects(fontAfterChange, font);
+}
+
+- (void)testPerformanceOfCachedFontRequests {
+  // Given
+  MDCSystemFontLoader *fontLoader = [[MDCSystemFontLoader alloc] init];
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 10000; ++i) {
+      [fontLoader regularFontOfSize:(CGFloat)(12 + i % 8)];
+      [fontLoader mediumFontOfSize:(CGFloat)(12 + i % 8)];
+      [fontLoader boldFontOfSize:(CGFloat)(12 + i % 8)];
+    }
+  }];
+}
+
 @end
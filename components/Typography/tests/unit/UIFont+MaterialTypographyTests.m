@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #import <XCTest/XCTest.h>
+#import "../../src/private/MDCFontTraits.h"
+#import "../../src/private/UIFontDescriptor+MaterialTypographyPrivate.h"
 #import "MDCTypographyMockTraitEnvironment.h"
 #import "MaterialApplication.h"
 #import "MaterialTypography.h"
@@ -60,4 +62,105 @@
   XCTAssertGreaterThan(scaledFont.pointSize, font.pointSize);
 }
 
+#pragma mark - Prewarming
+
+- (void)testPrewarmingCallsCompletionOnTheMainQueue {
+  // Given
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Prewarming completed"];
+  __block BOOL calledOnMainThread = NO;
+
+  // When
+  [UIFont mdc_prewarmMaterialTextStylesForAllSizeCategories:NO
+                                                 completion:^{
+                                                   calledOnMainThread = NSThread.isMainThread;
+                                                   [expectation fulfill];
+                                                 }];
+
+  // Then
+  [self waitForExpectations:@[ expectation ] timeout:5];
+  XCTAssertTrue(calledOnMainThread);
+}
+
+- (void)testPrewarmingFillsTheFontDescriptorTable {
+  // Given
+  [UIFontDescriptor mdc_removeAllCachedFontDescriptors];
+  XCTAssertNil([UIFontDescriptor
+      mdc_cachedFontDescriptorForMaterialTextStyle:MDCFontTextStyleHeadline
+                                      sizeCategory:UIContentSizeCategorySmall]);
+  XCTestExpectation *expectation = [self expectationWithDescription:@"Prewarming completed"];
+
+  // When
+  [UIFont mdc_prewarmMaterialTextStylesForAllSizeCategories:YES
+                                                 completion:^{
+                                                   [expectation fulfill];
+                                                 }];
+  [self waitForExpectations:@[ expectation ] timeout:5];
+
+  // Then
+  for (MDCFontTextStyle style = 0; style < MDCFontTraitsTextStyleCount; ++style) {
+    for (NSInteger ordinal = 0; ordinal < MDCFontTraitsSizeCategoryCount; ++ordinal) {
+      NSString *sizeCategory = MDCFontTraitsSizeCategoryName(ordinal);
+      UIFontDescriptor *cachedFontDescriptor =
+          [UIFontDescriptor mdc_cachedFontDescriptorForMaterialTextStyle:style
+                                                            sizeCategory:sizeCategory];
+      XCTAssertNotNil(cachedFontDescriptor);
+      XCTAssertEqual([UIFontDescriptor mdc_fontDescriptorForMaterialTextStyle:style
+                                                                 sizeCategory:sizeCategory],
+                     cachedFontDescriptor);
+    }
+  }
+  XCTAssertEqualWithAccuracy(
+      [UIFontDescriptor mdc_cachedFontDescriptorForMaterialTextStyle:MDCFontTextStyleHeadline
+                                                        sizeCategory:UIContentSizeCategorySmall]
+          .pointSize,
+      22, 0.001);
+}
+
+- (void)testPerformanceOfFirstStyledLabelWithoutPrewarming {
+  [self measureMetrics:[[self class] defaultPerformanceMetrics]
+      automaticallyStartMeasuring:NO
+                         forBlock:^{
+                           // Given
+                           [UIFontDescriptor mdc_removeAllCachedFontDescriptors];
+
+                           // When
+                           [self startMeasuring];
+                           [self styleLabelWithEveryMaterialTextStyle];
+                           [self stopMeasuring];
+                         }];
+}
+
+- (void)testPerformanceOfFirstStyledLabelAfterPrewarming {
+  [self measureMetrics:[[self class] defaultPerformanceMetrics]
+      automaticallyStartMeasuring:NO
+                         forBlock:^{
+                           // Given
+                           [UIFontDescriptor mdc_removeAllCachedFontDescriptors];
+                           XCTestExpectation *expectation =
+                               [self expectationWithDescription:@"Prewarming completed"];
+                           [UIFont mdc_prewarmMaterialTextStylesForAllSizeCategories:NO
+                                                                          completion:^{
+                                                                            [expectation fulfill];
+                                                                          }];
+                           [self waitForExpectations:@[ expectation ] timeout:5];
+
+                           // When
+                           [self startMeasuring];
+                           [self styleLabelWithEveryMaterialTextStyle];
+                           [self stopMeasuring];
+                         }];
+}
+
+#pragma mark - Helpers
+
+/** Styles one label with each Material text style, as a screen's first layout would. */
+- (void)styleLabelWithEveryMaterialTextStyle {
+  for (MDCFontTextStyle style = MDCFontTextStyleBody1; style <= MDCFontTextStyleButton; ++style) {
+    UILabel *label = [[UILabel alloc] init];
+    label.font = [UIFont mdc_preferredFontForMaterialTextStyle:style];
+    label.text = @"Material";
+    [label sizeToFit];
+  }
+}
+
 @end
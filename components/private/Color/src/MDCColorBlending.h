@@ -0,0 +1,76 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <CoreGraphics/CoreGraphics.h>
+#import <Foundation/Foundation.h>
+
+/**
+ A UIKit-free core for blending colors over background colors using alpha compositing.
+ More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
+
+ Colors are passed as packed red, green, blue and alpha components. RGBA8 colors are 32-bit
+ integers encoded as 0xRRGGBBAA.
+ */
+
+/**
+ Blends a color over a background color.
+
+ @param color The red, green, blue and alpha components of the color that sits on top.
+ @param backgroundColor The components of the color on the background.
+ @param result Receives the components of the blended color. May be the same array as either input.
+ */
+FOUNDATION_EXTERN void MDCColorBlend(const CGFloat color[_Nonnull 4],
+                                     const CGFloat backgroundColor[_Nonnull 4],
+                                     CGFloat result[_Nonnull 4]);
+
+/**
+ Blends @c count colors over one background color with the same precision as MDCColorBlend.
+
+ @param colors @c count packed colors of four components each.
+ @param count The number of colors.
+ @param backgroundColor The components of the color on the background.
+ @param results Receives @c count packed blended colors. May be the same array as @c colors.
+ */
+FOUNDATION_EXTERN void MDCColorBlendBatch(const CGFloat *_Nonnull colors,
+                                          size_t count,
+                                          const CGFloat backgroundColor[_Nonnull 4],
+                                          CGFloat *_Nonnull results);
+
+/**
+ Blends @c count colors of single precision components over one background color, four components
+ at a time when the compiler supports vector types.
+
+ @param colors @c count packed colors of four components each.
+ @param count The number of colors.
+ @param backgroundColor The components of the color on the background.
+ @param results Receives @c count packed blended colors. May be the same array as @c colors.
+ */
+FOUNDATION_EXTERN void MDCColorBlendFloat4Batch(const float *_Nonnull colors,
+                                                size_t count,
+                                                const float backgroundColor[_Nonnull 4],
+                                                float *_Nonnull results);
+
+/**
+ Blends @c count RGBA8 colors over one RGBA8 background color. Blended components are rounded to
+ the nearest 8-bit value.
+
+ @param colors @c count RGBA8 colors.
+ @param count The number of colors.
+ @param backgroundColor The RGBA8 color on the background.
+ @param results Receives @c count blended RGBA8 colors. May be the same array as @c colors.
+ */
+FOUNDATION_EXTERN void MDCColorBlendRGBA8Batch(const uint32_t *_Nonnull colors,
+                                               size_t count,
+                                               uint32_t backgroundColor,
+                                               uint32_t *_Nonnull results);
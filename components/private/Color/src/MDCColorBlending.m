@@ -0,0 +1,142 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCColorBlending.h"
+
+#include <string.h>
+
+// The compiler's generic vector extension lowers to SSE on x86 and NEON on ARM. Other compilers use
+// the scalar implementation, which performs the same operations one component at a time.
+#if (defined(__clang__) || defined(__GNUC__)) && !defined(MDC_COLOR_BLENDING_SCALAR)
+#define MDC_COLOR_BLENDING_VECTOR 1
+typedef float MDCFloat4 __attribute__((vector_size(16)));
+#else
+#define MDC_COLOR_BLENDING_VECTOR 0
+#endif
+
+/**
+ Helper method to blend a color channel with a background color channel using alpha composition.
+
+ @params value is the value of color channel
+ @params bValue is the value of background color channel
+ @params alpha is the alpha of color channel
+ @params bAlpha is the alpha of background color channel
+ */
+static inline CGFloat BlendColorChannel(CGFloat value,
+                                        CGFloat bValue,
+                                        CGFloat alpha,
+                                        CGFloat bAlpha) {
+  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
+}
+
+void MDCColorBlend(const CGFloat color[4], const CGFloat backgroundColor[4], CGFloat result[4]) {
+  CGFloat alpha = color[3];
+  CGFloat bAlpha = backgroundColor[3];
+  CGFloat red = BlendColorChannel(color[0], backgroundColor[0], alpha, bAlpha);
+  CGFloat green = BlendColorChannel(color[1], backgroundColor[1], alpha, bAlpha);
+  CGFloat blue = BlendColorChannel(color[2], backgroundColor[2], alpha, bAlpha);
+  result[0] = red;
+  result[1] = green;
+  result[2] = blue;
+  result[3] = alpha + bAlpha * (1 - alpha);
+}
+
+void MDCColorBlendBatch(const CGFloat *colors,
+                        size_t count,
+                        const CGFloat backgroundColor[4],
+                        CGFloat *results) {
+  CGFloat background[4] = {backgroundColor[0], backgroundColor[1], backgroundColor[2],
+                           backgroundColor[3]};
+  for (size_t i = 0; i < count; ++i) {
+    MDCColorBlend(colors + i * 4, background, results + i * 4);
+  }
+}
+
+void MDCColorBlendFloat4Batch(const float *colors,
+                              size_t count,
+                              const float backgroundColor[4],
+                              float *results) {
+#if MDC_COLOR_BLENDING_VECTOR
+  MDCFloat4 background;
+  memcpy(&background, backgroundColor, sizeof(background));
+  float bAlpha = background[3];
+  // The background's premultiplied components, shared by every color.
+  MDCFloat4 premultipliedBackground = background * bAlpha;
+  for (size_t i = 0; i < count; ++i) {
+    MDCFloat4 color;
+    memcpy(&color, colors + i * 4, sizeof(color));
+    float alpha = color[3];
+    float blendedAlpha = alpha + bAlpha * (1 - alpha);
+    MDCFloat4 blended = ((1 - alpha) * premultipliedBackground + alpha * color) / blendedAlpha;
+    blended[3] = blendedAlpha;
+    memcpy(results + i * 4, &blended, sizeof(blended));
+  }
+#else
+  float background[4] = {backgroundColor[0], backgroundColor[1], backgroundColor[2],
+                         backgroundColor[3]};
+  float bAlpha = background[3];
+  float premultipliedBackground[3] = {background[0] * bAlpha, background[1] * bAlpha,
+                                      background[2] * bAlpha};
+  for (size_t i = 0; i < count; ++i) {
+    const float *color = colors + i * 4;
+    float alpha = color[3];
+    float blendedAlpha = alpha + bAlpha * (1 - alpha);
+    float blended[4];
+    for (int j = 0; j < 3; ++j) {
+      blended[j] = ((1 - alpha) * premultipliedBackground[j] + alpha * color[j]) / blendedAlpha;
+    }
+    blended[3] = blendedAlpha;
+    memcpy(results + i * 4, blended, sizeof(blended));
+  }
+#endif
+}
+
+static inline void UnpackRGBA8(uint32_t color, float components[4]) {
+  components[0] = (float)((color >> 24) & 0xFF) / 255;
+  components[1] = (float)((color >> 16) & 0xFF) / 255;
+  components[2] = (float)((color >> 8) & 0xFF) / 255;
+  components[3] = (float)(color & 0xFF) / 255;
+}
+
+static inline uint32_t PackComponent(float component) {
+  float scaled = component * 255 + (float)0.5;
+  if (!(scaled > 0)) {
+    return 0;
+  }
+  return scaled >= 255 ? 255 : (uint32_t)scaled;
+}
+
+/** The number of RGBA8 colors that are unpacked and blended together. */
+enum { kRGBA8ChunkSize = 64 };
+
+void MDCColorBlendRGBA8Batch(const uint32_t *colors,
+                             size_t count,
+                             uint32_t backgroundColor,
+                             uint32_t *results) {
+  float background[4];
+  UnpackRGBA8(backgroundColor, background);
+  float chunk[kRGBA8ChunkSize * 4];
+  for (size_t start = 0; start < count; start += kRGBA8ChunkSize) {
+    size_t chunkCount = MIN((size_t)kRGBA8ChunkSize, count - start);
+    for (size_t i = 0; i < chunkCount; ++i) {
+      UnpackRGBA8(colors[start + i], chunk + i * 4);
+    }
+    MDCColorBlendFloat4Batch(chunk, chunkCount, background, chunk);
+    for (size_t i = 0; i < chunkCount; ++i) {
+      const float *blended = chunk + i * 4;
+      results[start + i] = PackComponent(blended[0]) << 24 | PackComponent(blended[1]) << 16 |
+                           PackComponent(blended[2]) << 8 | PackComponent(blended[3]);
+    }
+  }
+}
@@ -12,5 +12,6 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#import "MDCColorBlending.h"
 #import "UIColor+MaterialBlending.h"
 #import "UIColor+MaterialDynamic.h"
@@ -26,4 +26,16 @@
 + (nonnull UIColor *)mdc_blendColor:(nonnull UIColor *)color
                 withBackgroundColor:(nonnull UIColor *)backgroundColor;
 
+/**
+ Blending colors over one background color, for example all the colors of a scheme. The results
+ are equal to blending each color with @c mdc_blendColor:withBackgroundColor:, but the background
+ color is only decomposed once.
+
+ @param colors UIColor values that sit on top.
+ @param backgroundColor UIColor on the background.
+ @return The blended colors, in the order of @c colors.
+ */
++ (nonnull NSArray<UIColor *> *)mdc_blendColors:(nonnull NSArray<UIColor *> *)colors
+                            withBackgroundColor:(nonnull UIColor *)backgroundColor;
+
 @end
@@ -14,32 +14,55 @@
 
 #import "UIColor+MaterialBlending.h"
 
-/**
- Helper method to blend a color channel with a background color channel using alpha composition.
- More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
-
- @params value is the value of color channel
- @params bValue is the value of background color channel
- @params alpha is the alpha of color channel
- @params bAlpha is the alpha of background color channel
- */
-
-static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, CGFloat bAlpha) {
-  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
-}
+#import "MDCColorBlending.h"
 
 @implementation UIColor (MaterialBlending)
 
 + (UIColor *)mdc_blendColor:(UIColor *)color withBackgroundColor:(UIColor *)backgroundColor {
-  CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
-  [color getRed:&red green:&green blue:&blue alpha:&alpha];
-  CGFloat bRed = 0.0, bGreen = 0.0, bBlue = 0.0, bAlpha = 0.0;
-  [backgroundColor getRed:&bRed green:&bGreen blue:&bBlue alpha:&bAlpha];
-
-  return [UIColor colorWithRed:blendColorChannel(red, bRed, alpha, bAlpha)
-                         green:blendColorChannel(green, bGreen, alpha, bAlpha)
-                          blue:blendColorChannel(blue, bBlue, alpha, bAlpha)
-                         alpha:alpha + bAlpha * (1 - alpha)];
+  CGFloat components[4] = {0, 0, 0, 0};
+  [color getRed:&components[0] green:&components[1] blue:&components[2] alpha:&components[3]];
+  CGFloat bComponents[4] = {0, 0, 0, 0};
+  [backgroundColor getRed:&bComponents[0]
+                    green:&bComponents[1]
+                     blue:&bComponents[2]
+                    alpha:&bComponents[3]];
+
+  MDCColorBlend(components, bComponents, components);
+  return [UIColor colorWithRed:components[0]
+                         green:components[1]
+                          blue:components[2]
+                         alpha:components[3]];
+}
+
++ (NSArray<UIColor *> *)mdc_blendColors:(NSArray<UIColor *> *)colors
+                    withBackgroundColor:(UIColor *)backgroundColor {
+  NSUInteger count = colors.count;
+  if (count == 0) {
+    return @[];
+  }
+
+  CGFloat *components = calloc(count * 4, sizeof(CGFloat));
+  for (NSUInteger i = 0; i < count; ++i) {
+    CGFloat *color = components + i * 4;
+    [colors[i] getRed:&color[0] green:&color[1] blue:&color[2] alpha:&color[3]];
+  }
+  CGFloat bComponents[4] = {0, 0, 0, 0};
+  [backgroundColor getRed:&bComponents[0]
+                    green:&bComponents[1]
+                     blue:&bComponents[2]
+                    alpha:&bComponents[3]];
+
+  MDCColorBlendBatch(components, count, bComponents, components);
+  NSMutableArray<UIColor *> *blendedColors = [NSMutableArray arrayWithCapacity:count];
+  for (NSUInteger i = 0; i < count; ++i) {
+    const CGFloat *color = components + i * 4;
+    [blendedColors addObject:[UIColor colorWithRed:color[0]
+                                             green:color[1]
+                                              blue:color[2]
+                                             alpha:color[3]]];
+  }
+  free(components);
+  return blendedColors;
 }
 
 @end
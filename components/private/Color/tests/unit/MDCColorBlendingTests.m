@@ -0,0 +1,245 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCColorBlending.h"
+#import "UIColor+MaterialBlending.h"
+
+static const size_t kBenchmarkColorCount = 100000;
+
+// The test colors take every combination of these component values, which include the extremes
+// that the RGBA8 path rounds and keep the alpha above zero, where transparent blends are undefined.
+static const CGFloat kComponentValues[] = {
+    (CGFloat)1 / 255, (CGFloat)0.1, (CGFloat)0.25, (CGFloat)0.5,
+    (CGFloat)0.6,     (CGFloat)0.75, (CGFloat)0.9, 1,
+};
+enum { kComponentValueCount = sizeof(kComponentValues) / sizeof(kComponentValues[0]) };
+enum {
+  kColorCount =
+      kComponentValueCount * kComponentValueCount * kComponentValueCount * kComponentValueCount,
+};
+
+/** The per-channel formula that UIColor+MaterialBlending used before the blending core. */
+static CGFloat ReferenceBlendColorChannel(CGFloat value,
+                                          CGFloat bValue,
+                                          CGFloat alpha,
+                                          CGFloat bAlpha) {
+  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
+}
+
+/** Writes the RGBA components of the test color at @c index into @c color. */
+static void FillColorAtIndex(size_t index, CGFloat *color) {
+  for (int i = 0; i < 4; ++i) {
+    color[i] = kComponentValues[index % kComponentValueCount];
+    index /= kComponentValueCount;
+  }
+}
+
+/** Returns the test color at @c index packed as RGBA8. */
+static uint32_t RGBA8ColorAtIndex(size_t index) {
+  CGFloat color[4];
+  FillColorAtIndex(index, color);
+  uint32_t packed = 0;
+  for (int i = 0; i < 4; ++i) {
+    packed = (packed << 8) | (uint32_t)lround(color[i] * 255);
+  }
+  return packed;
+}
+
+@interface MDCColorBlendingTests : XCTestCase
+@end
+
+@implementation MDCColorBlendingTests
+
+#pragma mark - Tests
+
+- (void)testBlendIsBitIdenticalToPerChannelFormula {
+  for (size_t i = 0; i < kColorCount; ++i) {
+    // Given
+    CGFloat color[4];
+    CGFloat background[4];
+    FillColorAtIndex(i, color);
+    FillColorAtIndex(kColorCount - 1 - i, background);
+    CGFloat result[4];
+
+    // When
+    MDCColorBlend(color, background, result);
+
+    // Then
+    for (int j = 0; j < 3; ++j) {
+      XCTAssertEqual(result[j],
+                     ReferenceBlendColorChannel(color[j], background[j], color[3], background[3]));
+    }
+    XCTAssertEqual(result[3], color[3] + background[3] * (1 - color[3]));
+  }
+}
+
+- (void)testBatchMatchesSingleBlends {
+  // Given
+  CGFloat *colors = malloc(kColorCount * 4 * sizeof(CGFloat));
+  CGFloat *results = malloc(kColorCount * 4 * sizeof(CGFloat));
+  for (size_t i = 0; i < kColorCount; ++i) {
+    FillColorAtIndex(i, colors + i * 4);
+  }
+  CGFloat background[4] = {(CGFloat)0.2, (CGFloat)0.4, (CGFloat)0.6, (CGFloat)0.8};
+
+  // When
+  MDCColorBlendBatch(colors, kColorCount, background, results);
+
+  // Then
+  for (size_t i = 0; i < kColorCount; ++i) {
+    CGFloat expected[4];
+    MDCColorBlend(colors + i * 4, background, expected);
+    XCTAssertEqual(memcmp(results + i * 4, expected, sizeof(expected)), 0, @"color %zu", i);
+  }
+  free(results);
+  free(colors);
+}
+
+- (void)testFloat4BatchMatchesFormulaWithinSinglePrecision {
+  // Given
+  float *colors = malloc(kColorCount * 4 * sizeof(float));
+  float *results = malloc(kColorCount * 4 * sizeof(float));
+  for (size_t i = 0; i < kColorCount; ++i) {
+    CGFloat color[4];
+    FillColorAtIndex(i, color);
+    for (int j = 0; j < 4; ++j) {
+      colors[i * 4 + j] = (float)color[j];
+    }
+  }
+  float background[4] = {(float)0.2, (float)0.4, (float)0.6, (float)0.8};
+
+  // When
+  MDCColorBlendFloat4Batch(colors, kColorCount, background, results);
+
+  // Then
+  for (size_t i = 0; i < kColorCount; ++i) {
+    const float *color = colors + i * 4;
+    for (int j = 0; j < 3; ++j) {
+      CGFloat expected =
+          ReferenceBlendColorChannel(color[j], background[j], color[3], background[3]);
+      XCTAssertEqualWithAccuracy(results[i * 4 + j], expected, 1e-6, @"color %zu", i);
+    }
+    XCTAssertEqualWithAccuracy(results[i * 4 + 3], color[3] + background[3] * (1 - color[3]),
+                               1e-6);
+  }
+  free(results);
+  free(colors);
+}
+
+- (void)testRGBA8Batch {
+  // Given
+  uint32_t colors[] = {0x000000FF, 0x00000080, 0xFFFFFF80, 0xFF000000};
+
+  // When
+  uint32_t results[4];
+  MDCColorBlendRGBA8Batch(colors, 4, 0xFFFFFFFF, results);
+
+  // Then
+  XCTAssertEqual(results[0], 0x000000FFU);
+  XCTAssertEqual(results[1], 0x7F7F7FFFU);
+  XCTAssertEqual(results[2], 0xFFFFFFFFU);
+  XCTAssertEqual(results[3], 0xFFFFFFFFU);
+}
+
+- (void)testRGBA8BatchIsWithinOneStepOfFormula {
+  // Given
+  uint32_t *colors = malloc(kColorCount * sizeof(uint32_t));
+  uint32_t *results = malloc(kColorCount * sizeof(uint32_t));
+  for (size_t i = 0; i < kColorCount; ++i) {
+    colors[i] = RGBA8ColorAtIndex(i);
+  }
+  uint32_t background = 0x336699CC;
+
+  // When
+  MDCColorBlendRGBA8Batch(colors, kColorCount, background, results);
+
+  // Then
+  for (size_t i = 0; i < kColorCount; ++i) {
+    CGFloat color[4];
+    CGFloat bColor[4];
+    for (int j = 0; j < 4; ++j) {
+      color[j] = (CGFloat)((colors[i] >> (24 - 8 * j)) & 0xFF) / 255;
+      bColor[j] = (CGFloat)((background >> (24 - 8 * j)) & 0xFF) / 255;
+    }
+    CGFloat expected[4];
+    MDCColorBlend(color, bColor, expected);
+    for (int j = 0; j < 4; ++j) {
+      CGFloat component = (CGFloat)((results[i] >> (24 - 8 * j)) & 0xFF);
+      XCTAssertEqualWithAccuracy(component, expected[j] * 255, 1, @"color %zu", i);
+    }
+  }
+  free(results);
+  free(colors);
+}
+
+- (void)testBlendColorsMatchesBlendColor {
+  // Given
+  NSArray<UIColor *> *colors = @[
+    [UIColor colorWithRed:(CGFloat)0.9 green:(CGFloat)0.8 blue:(CGFloat)0.6 alpha:(CGFloat)0.6],
+    [UIColor colorWithWhite:(CGFloat)0.8 alpha:(CGFloat)0.6],
+    [UIColor colorWithRed:0 green:0 blue:0 alpha:1],
+  ];
+  UIColor *backgroundColor = [UIColor colorWithRed:(CGFloat)0.1
+                                             green:(CGFloat)0.2
+                                              blue:(CGFloat)0.3
+                                             alpha:(CGFloat)0.9];
+
+  // When
+  NSArray<UIColor *> *blendedColors = [UIColor mdc_blendColors:colors
+                                           withBackgroundColor:backgroundColor];
+
+  // Then
+  XCTAssertEqual(blendedColors.count, colors.count);
+  for (NSUInteger i = 0; i < colors.count; ++i) {
+    XCTAssertEqualObjects(blendedColors[i], [UIColor mdc_blendColor:colors[i]
+                                                withBackgroundColor:backgroundColor]);
+  }
+}
+
+#pragma mark - Performance
+
+- (void)testRGBA8BatchPerformance {
+  uint32_t *colors = malloc(kBenchmarkColorCount * sizeof(uint32_t));
+  uint32_t *results = malloc(kBenchmarkColorCount * sizeof(uint32_t));
+  for (size_t i = 0; i < kBenchmarkColorCount; ++i) {
+    colors[i] = RGBA8ColorAtIndex(i % kColorCount);
+  }
+
+  [self measureBlock:^{
+    MDCColorBlendRGBA8Batch(colors, kBenchmarkColorCount, 0x121212FF, results);
+  }];
+
+  free(results);
+  free(colors);
+}
+
+- (void)testBlendColorPerformance {
+  UIColor *color = [UIColor colorWithRed:(CGFloat)0.9
+                                   green:(CGFloat)0.8
+                                    blue:(CGFloat)0.6
+                                   alpha:(CGFloat)0.6];
+  UIColor *backgroundColor = UIColor.blackColor;
+
+  [self measureBlock:^{
+    for (NSUInteger i = 0; i < 10000; ++i) {
+      @autoreleasepool {
+        [UIColor mdc_blendColor:color withBackgroundColor:backgroundColor];
+      }
+    }
+  }];
+}
+
+@end
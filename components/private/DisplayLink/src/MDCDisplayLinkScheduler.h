@@ -0,0 +1,102 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+@class MDCDisplayLinkScheduler;
+
+/** An object that is updated once per frame by a display link scheduler. */
+@protocol MDCDisplayLinkSubscriber <NSObject>
+
+/**
+ Called once per frame while the receiver is subscribed to @c scheduler.
+
+ @param scheduler The scheduler the receiver is subscribed to.
+ @param duration The time since the previous frame, including any dropped frames. Subscribers
+ should advance their animations by this amount rather than by a fixed step.
+ */
+- (void)displayLinkScheduler:(nonnull MDCDisplayLinkScheduler *)scheduler
+        didAdvanceByDuration:(NSTimeInterval)duration;
+
+@end
+
+/**
+ Drives per-frame animations of any number of subscribers from a single display link.
+
+ The display link is created when the first subscriber is added and invalidated once no subscribers
+ remain, so an idle scheduler doesn't wake up the main thread. On devices with ProMotion displays,
+ the display link requests the screen's maximum frame rate.
+
+ Subscribers are held weakly. A scheduler must only be used from the main thread.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCDisplayLinkScheduler : NSObject
+
+/** The scheduler shared by all components. */
++ (nonnull instancetype)sharedScheduler;
+
+/**
+ Creates a scheduler.
+
+ @param displayLinkEnabled Whether the scheduler is driven by a display link. A scheduler without a
+ display link only advances when it receives @c -advanceByDuration:, which allows animations to be
+ simulated deterministically.
+ */
+- (nonnull instancetype)initWithDisplayLinkEnabled:(BOOL)displayLinkEnabled
+    NS_DESIGNATED_INITIALIZER;
+
+/** Creates a scheduler that is driven by a display link. */
+- (nonnull instancetype)init;
+
+/** Whether the scheduler is driven by a display link. */
+@property(nonatomic, readonly, getter=isDisplayLinkEnabled) BOOL displayLinkEnabled;
+
+/** Whether the scheduler has any subscribers. The display link only runs while this is YES. */
+@property(nonatomic, readonly, getter=isActive) BOOL active;
+
+/** Adds @c subscriber, which is updated starting with the next frame. */
+- (void)addSubscriber:(nonnull id<MDCDisplayLinkSubscriber>)subscriber;
+
+/** Removes @c subscriber. Subscribers may remove themselves while being updated. */
+- (void)removeSubscriber:(nonnull id<MDCDisplayLinkSubscriber>)subscriber;
+
+/** Returns whether @c subscriber is subscribed to the scheduler. */
+- (BOOL)hasSubscriber:(nonnull id<MDCDisplayLinkSubscriber>)subscriber;
+
+/**
+ Updates all subscribers as if a frame @c duration seconds after the previous one was displayed.
+
+ The display link calls this once per frame. Simulations can call it directly on a scheduler
+ without a display link.
+ */
+- (void)advanceByDuration:(NSTimeInterval)duration;
+
+@end
+
+/**
+ Returns @c value after it has been pulled towards @c destination for @c duration seconds by a force
+ proportional to its distance from @c destination.
+
+ The result is the exact solution of the attachment rather than a fixed step, so advancing by two
+ durations yields the same value as advancing once by their sum, regardless of the frame rate.
+
+ @param value The current value.
+ @param destination The value being approached.
+ @param stiffness How strongly @c value is pulled towards @c destination. Each second the distance
+ shrinks by a factor of e^stiffness.
+ @param duration The time to advance by.
+ */
+FOUNDATION_EXTERN CGFloat MDCAttachedValueAfterDuration(CGFloat value,
+                                                        CGFloat destination,
+                                                        CGFloat stiffness,
+                                                        NSTimeInterval duration);
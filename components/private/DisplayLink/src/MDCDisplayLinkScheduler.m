@@ -0,0 +1,128 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCDisplayLinkScheduler.h"
+
+#import "MaterialAvailability.h"
+
+@implementation MDCDisplayLinkScheduler {
+  NSHashTable<id<MDCDisplayLinkSubscriber>> *_subscribers;
+  CADisplayLink *_displayLink;
+
+  // The target timestamp of the previous frame, or 0 before the first frame.
+  CFTimeInterval _lastTargetTimestamp;
+}
+
++ (instancetype)sharedScheduler {
+  static MDCDisplayLinkScheduler *sharedScheduler;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedScheduler = [[MDCDisplayLinkScheduler alloc] init];
+  });
+  return sharedScheduler;
+}
+
+- (instancetype)initWithDisplayLinkEnabled:(BOOL)displayLinkEnabled {
+  self = [super init];
+  if (self) {
+    _displayLinkEnabled = displayLinkEnabled;
+    _subscribers = [NSHashTable weakObjectsHashTable];
+  }
+  return self;
+}
+
+- (instancetype)init {
+  return [self initWithDisplayLinkEnabled:YES];
+}
+
+- (void)dealloc {
+  [_displayLink invalidate];
+}
+
+- (BOOL)isActive {
+  return _subscribers.anyObject != nil;
+}
+
+- (void)addSubscriber:(id<MDCDisplayLinkSubscriber>)subscriber {
+  [_subscribers addObject:subscriber];
+  [self startDisplayLinkIfNeeded];
+}
+
+- (void)removeSubscriber:(id<MDCDisplayLinkSubscriber>)subscriber {
+  [_subscribers removeObject:subscriber];
+  if (!self.isActive) {
+    [self stopDisplayLink];
+  }
+}
+
+- (BOOL)hasSubscriber:(id<MDCDisplayLinkSubscriber>)subscriber {
+  return [_subscribers containsObject:subscriber];
+}
+
+- (void)advanceByDuration:(NSTimeInterval)duration {
+  for (id<MDCDisplayLinkSubscriber> subscriber in _subscribers.allObjects) {
+    // An earlier subscriber may have removed this one during this frame.
+    if ([_subscribers containsObject:subscriber]) {
+      [subscriber displayLinkScheduler:self didAdvanceByDuration:duration];
+    }
+  }
+  if (!self.isActive) {
+    [self stopDisplayLink];
+  }
+}
+
+#pragma mark - Display link
+
+- (void)startDisplayLinkIfNeeded {
+  if (!_displayLinkEnabled || _displayLink) {
+    return;
+  }
+  // The display link retains the scheduler until it is invalidated, which happens as soon as the
+  // scheduler becomes idle.
+  _displayLink = [CADisplayLink displayLinkWithTarget:self
+                                             selector:@selector(displayLinkDidFire:)];
+#if MDC_AVAILABLE_SDK_IOS(15_0)
+  if (@available(iOS 15.0, *)) {
+    // Display links run at 60 Hz on ProMotion displays unless they ask for more.
+    float maximumFramesPerSecond = (float)UIScreen.mainScreen.maximumFramesPerSecond;
+    _displayLink.preferredFrameRateRange = CAFrameRateRangeMake(
+        MIN(60, maximumFramesPerSecond), maximumFramesPerSecond, maximumFramesPerSecond);
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(15_0)
+  _lastTargetTimestamp = 0;
+  [_displayLink addToRunLoop:[NSRunLoop mainRunLoop] forMode:NSRunLoopCommonModes];
+}
+
+- (void)stopDisplayLink {
+  [_displayLink invalidate];
+  _displayLink = nil;
+}
+
+- (void)displayLinkDidFire:(CADisplayLink *)displayLink {
+  // Measuring from the previous frame rather than using the display link's duration accounts for
+  // dropped frames and frame rate changes.
+  CFTimeInterval previousTargetTimestamp =
+      _lastTargetTimestamp > 0 ? _lastTargetTimestamp : displayLink.timestamp;
+  _lastTargetTimestamp = displayLink.targetTimestamp;
+  [self advanceByDuration:MAX(0, displayLink.targetTimestamp - previousTargetTimestamp)];
+}
+
+@end
+
+CGFloat MDCAttachedValueAfterDuration(CGFloat value,
+                                      CGFloat destination,
+                                      CGFloat stiffness,
+                                      NSTimeInterval duration) {
+  return destination + (value - destination) * (CGFloat)exp(-stiffness * duration);
+}
@@ -0,0 +1,164 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialDisplayLink.h"
+
+/** A subscriber that records the durations it was advanced by. */
+@interface DisplayLinkSchedulerTestsSubscriber : NSObject <MDCDisplayLinkSubscriber>
+@property(nonatomic, readonly, nonnull) NSMutableArray<NSNumber *> *durations;
+@property(nonatomic) BOOL removesItselfWhenAdvanced;
+@end
+
+@implementation DisplayLinkSchedulerTestsSubscriber
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _durations = [NSMutableArray array];
+  }
+  return self;
+}
+
+- (void)displayLinkScheduler:(MDCDisplayLinkScheduler *)scheduler
+        didAdvanceByDuration:(NSTimeInterval)duration {
+  [self.durations addObject:@(duration)];
+  if (self.removesItselfWhenAdvanced) {
+    [scheduler removeSubscriber:self];
+  }
+}
+
+@end
+
+@interface MDCDisplayLinkSchedulerTests : XCTestCase
+@end
+
+@implementation MDCDisplayLinkSchedulerTests
+
+- (void)testSharedSchedulerIsShared {
+  // When
+  MDCDisplayLinkScheduler *scheduler1 = [MDCDisplayLinkScheduler sharedScheduler];
+  MDCDisplayLinkScheduler *scheduler2 = [MDCDisplayLinkScheduler sharedScheduler];
+
+  // Then
+  XCTAssertEqual(scheduler1, scheduler2);
+  XCTAssertTrue(scheduler1.isDisplayLinkEnabled);
+}
+
+- (void)testIsActiveOnlyWhileSubscribed {
+  // Given
+  MDCDisplayLinkScheduler *scheduler = [[MDCDisplayLinkScheduler alloc] init];
+  DisplayLinkSchedulerTestsSubscriber *subscriber =
+      [[DisplayLinkSchedulerTestsSubscriber alloc] init];
+
+  // When
+  [scheduler addSubscriber:subscriber];
+
+  // Then
+  XCTAssertTrue(scheduler.isActive);
+  XCTAssertTrue([scheduler hasSubscriber:subscriber]);
+
+  // When
+  [scheduler removeSubscriber:subscriber];
+
+  // Then
+  XCTAssertFalse(scheduler.isActive);
+  XCTAssertFalse([scheduler hasSubscriber:subscriber]);
+}
+
+- (void)testAdvanceUpdatesEverySubscriber {
+  // Given
+  MDCDisplayLinkScheduler *scheduler =
+      [[MDCDisplayLinkScheduler alloc] initWithDisplayLinkEnabled:NO];
+  DisplayLinkSchedulerTestsSubscriber *subscriber1 =
+      [[DisplayLinkSchedulerTestsSubscriber alloc] init];
+  DisplayLinkSchedulerTestsSubscriber *subscriber2 =
+      [[DisplayLinkSchedulerTestsSubscriber alloc] init];
+  [scheduler addSubscriber:subscriber1];
+  [scheduler addSubscriber:subscriber2];
+
+  // When
+  [scheduler advanceByDuration:0.25];
+
+  // Then
+  XCTAssertEqualObjects(subscriber1.durations, @[ @0.25 ]);
+  XCTAssertEqualObjects(subscriber2.durations, @[ @0.25 ]);
+}
+
+- (void)testSubscriberCanRemoveItselfWhileAdvancing {
+  // Given
+  MDCDisplayLinkScheduler *scheduler =
+      [[MDCDisplayLinkScheduler alloc] initWithDisplayLinkEnabled:NO];
+  DisplayLinkSchedulerTestsSubscriber *subscriber =
+      [[DisplayLinkSchedulerTestsSubscriber alloc] init];
+  subscriber.removesItselfWhenAdvanced = YES;
+  [scheduler addSubscriber:subscriber];
+
+  // When
+  [scheduler advanceByDuration:0.25];
+  [scheduler advanceByDuration:0.25];
+
+  // Then
+  XCTAssertEqual(subscriber.durations.count, 1U);
+  XCTAssertFalse(scheduler.isActive);
+}
+
+- (void)testSubscribersAreHeldWeakly {
+  // Given
+  MDCDisplayLinkScheduler *scheduler =
+      [[MDCDisplayLinkScheduler alloc] initWithDisplayLinkEnabled:NO];
+  __weak DisplayLinkSchedulerTestsSubscriber *weakSubscriber;
+
+  // When
+  @autoreleasepool {
+    DisplayLinkSchedulerTestsSubscriber *subscriber =
+        [[DisplayLinkSchedulerTestsSubscriber alloc] init];
+    weakSubscriber = subscriber;
+    [scheduler addSubscriber:subscriber];
+  }
+
+  // Then
+  XCTAssertNil(weakSubscriber);
+  XCTAssertFalse(scheduler.isActive);
+}
+
+- (void)testAttachedValueIsIndependentOfTheFrameRate {
+  // Given
+  CGFloat valueAt60Hz = 100;
+  CGFloat valueAt120Hz = 100;
+
+  // When
+  for (NSInteger frame = 0; frame < 60; ++frame) {
+    valueAt60Hz = MDCAttachedValueAfterDuration(valueAt60Hz, 0, 12, 1.0 / 60);
+  }
+  for (NSInteger frame = 0; frame < 120; ++frame) {
+    valueAt120Hz = MDCAttachedValueAfterDuration(valueAt120Hz, 0, 12, 1.0 / 120);
+  }
+
+  // Then
+  XCTAssertEqualWithAccuracy(valueAt60Hz, 100 * exp(-12), 1e-9);
+  XCTAssertEqualWithAccuracy(valueAt120Hz, valueAt60Hz, 1e-9);
+}
+
+- (void)testAttachedValueDoesNotOvershootLongFrames {
+  // When
+  CGFloat value = MDCAttachedValueAfterDuration(100, 0, 12, 1);
+
+  // Then
+  XCTAssertGreaterThanOrEqual(value, 0);
+  XCTAssertLessThan(value, 0.001);
+}
+
+@end
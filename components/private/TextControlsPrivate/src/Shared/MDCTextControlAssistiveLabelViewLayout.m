@@ -14,6 +14,8 @@
 
 #import "MDCTextControlAssistiveLabelViewLayout.h"
 
+#import "MDCTextControlTextMeasurementCache.h"
+
 @interface MDCTextControlAssistiveLabelViewLayout ()
 
 @property(nonatomic, assign) CGRect leadingAssistiveLabelFrame;
@@ -156,8 +158,8 @@
   if (maxWidth <= 0 || label.text.length <= 0 || label.hidden) {
     return CGSizeZero;
   }
-  CGSize fittingSize = CGSizeMake(maxWidth, CGFLOAT_MAX);
-  CGSize size = [label sizeThatFits:fittingSize];
+  CGSize size = [[MDCTextControlTextMeasurementCache sharedCache] sizeOfLabel:label
+                                                                fittingWidth:maxWidth];
   if (size.width > maxWidth) {
     size.width = maxWidth;
   }
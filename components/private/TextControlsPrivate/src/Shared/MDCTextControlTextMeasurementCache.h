@@ -0,0 +1,66 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+/**
+ A bounded cache of text measurements shared by the text control layout objects.
+
+ Text controls calculate a new layout on every @c -layoutSubviews, but the text and fonts of their
+ labels rarely change between layouts. Measurements are keyed by the text, the identity of the
+ font, the fitting width and the line limit, so repeated layouts reuse the sizes of unchanged
+ labels instead of measuring them again.
+
+ The cache holds a fixed number of measurements, replacing older ones as new ones are made. It is
+ cleared when the app receives a memory warning.
+ */
+@interface MDCTextControlTextMeasurementCache : NSObject
+
+/** The cache used by the text control layout objects. */
++ (nonnull instancetype)sharedCache;
+
+/** The number of measurements that were answered from the cache. */
+@property(nonatomic, readonly) NSUInteger hitCount;
+
+/** The number of measurements that had to measure text. */
+@property(nonatomic, readonly) NSUInteger missCount;
+
+/**
+ Returns the size of the bounding rect of @c text drawn with @c font, as measured by
+ @c -boundingRectWithSize:options:attributes:context: with
+ @c NSStringDrawingUsesLineFragmentOrigin and a fitting size of @c fittingWidth by
+ @c CGFLOAT_MAX.
+
+ Returns @c CGSizeZero if @c text or @c font is nil.
+ */
+- (CGSize)boundingSizeOfText:(nullable NSString *)text
+                        font:(nullable UIFont *)font
+                fittingWidth:(CGFloat)fittingWidth;
+
+/**
+ Returns the result of @c -sizeThatFits: on @c label with a fitting size of @c fittingWidth by
+ @c CGFLOAT_MAX.
+
+ The measurement is keyed by the label's attributed text, font, number of lines and line break
+ mode.
+ */
+- (CGSize)sizeOfLabel:(nonnull UILabel *)label fittingWidth:(CGFloat)fittingWidth;
+
+/** Removes all measurements from the cache. The hit and miss counts are not reset. */
+- (void)removeAllMeasurements;
+
+/** Sets the hit and miss counts to 0. */
+- (void)resetStatistics;
+
+@end
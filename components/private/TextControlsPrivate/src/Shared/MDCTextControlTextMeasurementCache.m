@@ -0,0 +1,241 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCTextControlTextMeasurementCache.h"
+
+#import <os/lock.h>
+
+/** The number of measurements the cache holds. Must be a power of 2. */
+#define kTextMeasurementCacheSize 256
+
+/** The ways text can be measured. Measurements of different kinds are never shared. */
+typedef NS_ENUM(uint8_t, TextMeasurementKind) {
+  TextMeasurementKindNone,
+  TextMeasurementKindBoundingRect,
+  TextMeasurementKindLabel,
+};
+
+/** Returns the index of the cache entry that holds a measurement. */
+static NSUInteger TextMeasurementSlot(id text,
+                                      UIFont *font,
+                                      CGFloat fittingWidth,
+                                      NSInteger lineLimit,
+                                      TextMeasurementKind kind) {
+  uint64_t widthBits = 0;
+  double width = (double)fittingWidth;
+  memcpy(&widthBits, &width, sizeof(widthBits));
+
+  uint64_t hash = (uint64_t)[text hash];
+  hash ^= (uint64_t)(uintptr_t)(__bridge void *)font * 0x9E3779B97F4A7C15ULL;
+  hash ^= widthBits * 0xC2B2AE3D27D4EB4FULL;
+  hash ^= ((uint64_t)lineLimit << 8 | kind) * 0x165667B19E3779F9ULL;
+  hash ^= hash >> 29;
+  return (NSUInteger)hash & (kTextMeasurementCacheSize - 1);
+}
+
+@implementation MDCTextControlTextMeasurementCache {
+  // Each index is one entry of a direct-mapped cache. The text is an NSString for bounding rect
+  // measurements and an NSAttributedString for label measurements.
+  id _texts[kTextMeasurementCacheSize];
+  UIFont *_fonts[kTextMeasurementCacheSize];
+  CGFloat _fittingWidths[kTextMeasurementCacheSize];
+  NSInteger _lineLimits[kTextMeasurementCacheSize];
+  NSLineBreakMode _lineBreakModes[kTextMeasurementCacheSize];
+  TextMeasurementKind _kinds[kTextMeasurementCacheSize];
+  CGSize _sizes[kTextMeasurementCacheSize];
+  NSUInteger _hitCount;
+  NSUInteger _missCount;
+  os_unfair_lock _lock;
+}
+
++ (instancetype)sharedCache {
+  static MDCTextControlTextMeasurementCache *sharedCache;
+  static dispatch_once_t onceToken;
+  dispatch_once(&onceToken, ^{
+    sharedCache = [[MDCTextControlTextMeasurementCache alloc] init];
+  });
+  return sharedCache;
+}
+
+- (instancetype)init {
+  self = [super init];
+  if (self) {
+    _lock = OS_UNFAIR_LOCK_INIT;
+    [[NSNotificationCenter defaultCenter]
+        addObserver:self
+           selector:@selector(didReceiveMemoryWarning:)
+               name:UIApplicationDidReceiveMemoryWarningNotification
+             object:nil];
+  }
+  return self;
+}
+
+- (void)didReceiveMemoryWarning:(__unused NSNotification *)notification {
+  [self removeAllMeasurements];
+}
+
+#pragma mark - Measuring
+
+- (CGSize)boundingSizeOfText:(NSString *)text
+                        font:(UIFont *)font
+                fittingWidth:(CGFloat)fittingWidth {
+  if (!text || !font) {
+    return CGSizeZero;
+  }
+  NSUInteger slot = 0;
+  CGSize size = CGSizeZero;
+  if ([self lookUpSize:&size
+                  slot:&slot
+                  text:text
+                  font:font
+          fittingWidth:fittingWidth
+             lineLimit:0
+         lineBreakMode:NSLineBreakByWordWrapping
+                  kind:TextMeasurementKindBoundingRect]) {
+    return size;
+  }
+
+  CGSize fittingSize = CGSizeMake(fittingWidth, CGFLOAT_MAX);
+  NSDictionary *attributes = @{NSFontAttributeName : font};
+  CGRect rect = [text boundingRectWithSize:fittingSize
+                                   options:NSStringDrawingUsesLineFragmentOrigin
+                                attributes:attributes
+                                   context:nil];
+  size = rect.size;
+  [self storeSize:size
+               slot:slot
+               text:[text copy]
+               font:font
+       fittingWidth:fittingWidth
+          lineLimit:0
+      lineBreakMode:NSLineBreakByWordWrapping
+               kind:TextMeasurementKindBoundingRect];
+  return size;
+}
+
+- (CGSize)sizeOfLabel:(UILabel *)label fittingWidth:(CGFloat)fittingWidth {
+  NSAttributedString *attributedText = label.attributedText;
+  UIFont *font = label.font;
+  NSInteger numberOfLines = label.numberOfLines;
+  NSLineBreakMode lineBreakMode = label.lineBreakMode;
+  NSUInteger slot = 0;
+  CGSize size = CGSizeZero;
+  if (attributedText &&
+      [self lookUpSize:&size
+                  slot:&slot
+                  text:attributedText
+                  font:font
+          fittingWidth:fittingWidth
+             lineLimit:numberOfLines
+         lineBreakMode:lineBreakMode
+                  kind:TextMeasurementKindLabel]) {
+    return size;
+  }
+
+  size = [label sizeThatFits:CGSizeMake(fittingWidth, CGFLOAT_MAX)];
+  if (attributedText) {
+    [self storeSize:size
+                 slot:slot
+                 text:[attributedText copy]
+                 font:font
+         fittingWidth:fittingWidth
+            lineLimit:numberOfLines
+        lineBreakMode:lineBreakMode
+                 kind:TextMeasurementKindLabel];
+  }
+  return size;
+}
+
+#pragma mark - Cache entries
+
+- (BOOL)lookUpSize:(CGSize *)size
+              slot:(NSUInteger *)slot
+              text:(id)text
+              font:(UIFont *)font
+      fittingWidth:(CGFloat)fittingWidth
+         lineLimit:(NSInteger)lineLimit
+     lineBreakMode:(NSLineBreakMode)lineBreakMode
+              kind:(TextMeasurementKind)kind {
+  NSUInteger index = TextMeasurementSlot(text, font, fittingWidth, lineLimit, kind);
+  *slot = index;
+
+  os_unfair_lock_lock(&_lock);
+  // Widths are compared exactly: any difference in the fitting width can change where text wraps.
+  BOOL hit = _kinds[index] == kind && _fonts[index] == font &&
+             _fittingWidths[index] == fittingWidth && _lineLimits[index] == lineLimit &&
+             _lineBreakModes[index] == lineBreakMode &&
+             (_texts[index] == text || [_texts[index] isEqual:text]);
+  if (hit) {
+    *size = _sizes[index];
+    _hitCount += 1;
+  } else {
+    _missCount += 1;
+  }
+  os_unfair_lock_unlock(&_lock);
+  return hit;
+}
+
+- (void)storeSize:(CGSize)size
+             slot:(NSUInteger)slot
+             text:(id)text
+             font:(UIFont *)font
+     fittingWidth:(CGFloat)fittingWidth
+        lineLimit:(NSInteger)lineLimit
+    lineBreakMode:(NSLineBreakMode)lineBreakMode
+             kind:(TextMeasurementKind)kind {
+  os_unfair_lock_lock(&_lock);
+  _texts[slot] = text;
+  _fonts[slot] = font;
+  _fittingWidths[slot] = fittingWidth;
+  _lineLimits[slot] = lineLimit;
+  _lineBreakModes[slot] = lineBreakMode;
+  _kinds[slot] = kind;
+  _sizes[slot] = size;
+  os_unfair_lock_unlock(&_lock);
+}
+
+- (void)removeAllMeasurements {
+  os_unfair_lock_lock(&_lock);
+  for (NSUInteger i = 0; i < kTextMeasurementCacheSize; ++i) {
+    _texts[i] = nil;
+    _fonts[i] = nil;
+    _kinds[i] = TextMeasurementKindNone;
+  }
+  os_unfair_lock_unlock(&_lock);
+}
+
+#pragma mark - Statistics
+
+- (NSUInteger)hitCount {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger hitCount = _hitCount;
+  os_unfair_lock_unlock(&_lock);
+  return hitCount;
+}
+
+- (NSUInteger)missCount {
+  os_unfair_lock_lock(&_lock);
+  NSUInteger missCount = _missCount;
+  os_unfair_lock_unlock(&_lock);
+  return missCount;
+}
+
+- (void)resetStatistics {
+  os_unfair_lock_lock(&_lock);
+  _hitCount = 0;
+  _missCount = 0;
+  os_unfair_lock_unlock(&_lock);
+}
+
+@end
@@ -23,4 +23,5 @@
 #import "MDCTextControlLabelPosition.h"
 #import "MDCTextControlPlaceholderSupport.h"
 #import "MDCTextControlSideViewSupport.h"
+#import "MDCTextControlTextMeasurementCache.h"
 #import "MDCTextControlVerticalPositioningReference.h"
@@ -315,14 +315,11 @@
   if (!font) {
     return CGSizeZero;
   }
-  CGSize fittingSize = CGSizeMake(maxWidth, CGFLOAT_MAX);
-  NSDictionary *attributes = @{NSFontAttributeName : font};
-  CGRect rect = [placeholder boundingRectWithSize:fittingSize
-                                          options:NSStringDrawingUsesLineFragmentOrigin
-                                       attributes:attributes
-                                          context:nil];
-  rect.size.height = font.lineHeight;
-  return rect.size;
+  CGSize size = [[MDCTextControlTextMeasurementCache sharedCache] boundingSizeOfText:placeholder
+                                                                               font:font
+                                                                       fittingWidth:maxWidth];
+  size.height = font.lineHeight;
+  return size;
 }
 
 - (CGRect)labelFrameWithText:(NSString *)text
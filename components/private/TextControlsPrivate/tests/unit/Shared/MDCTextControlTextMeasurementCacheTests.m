@@ -0,0 +1,181 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MDCTextControlTextMeasurementCache.h"
+
+@interface MDCTextControlTextMeasurementCacheTests : XCTestCase
+@property(nonatomic, strong) MDCTextControlTextMeasurementCache *cache;
+@end
+
+@implementation MDCTextControlTextMeasurementCacheTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.cache = [[MDCTextControlTextMeasurementCache alloc] init];
+}
+
+- (void)tearDown {
+  self.cache = nil;
+
+  [super tearDown];
+}
+
+- (void)testBoundingSizeMatchesBoundingRect {
+  // Given
+  NSString *text = @"Placeholder text";
+  UIFont *font = [UIFont systemFontOfSize:17];
+
+  // When
+  CGSize size = [self.cache boundingSizeOfText:text font:font fittingWidth:60];
+  CGSize cachedSize = [self.cache boundingSizeOfText:text font:font fittingWidth:60];
+
+  // Then
+  CGRect rect = [text boundingRectWithSize:CGSizeMake(60, CGFLOAT_MAX)
+                                   options:NSStringDrawingUsesLineFragmentOrigin
+                                attributes:@{NSFontAttributeName : font}
+                                   context:nil];
+  XCTAssertTrue(CGSizeEqualToSize(size, rect.size));
+  XCTAssertTrue(CGSizeEqualToSize(cachedSize, rect.size));
+  XCTAssertEqual(self.cache.missCount, 1U);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testBoundingSizeOfNilTextIsZero {
+  // When
+  CGSize size = [self.cache boundingSizeOfText:nil
+                                          font:[UIFont systemFontOfSize:17]
+                                  fittingWidth:100];
+
+  // Then
+  XCTAssertTrue(CGSizeEqualToSize(size, CGSizeZero));
+}
+
+- (void)testEqualTextWithADifferentIdentityIsAHit {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:17];
+  NSMutableString *text = [NSMutableString stringWithString:@"Placeholder"];
+  (void)[self.cache boundingSizeOfText:text font:font fittingWidth:100];
+
+  // When
+  [text appendString:@" text"];
+  (void)[self.cache boundingSizeOfText:text font:font fittingWidth:100];
+  (void)[self.cache boundingSizeOfText:[text copy] font:font fittingWidth:100];
+
+  // Then
+  XCTAssertEqual(self.cache.missCount, 2U);
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testChangingTheFontOrWidthMeasuresAgain {
+  // Given
+  NSString *text = @"Placeholder text";
+  (void)[self.cache boundingSizeOfText:text font:[UIFont systemFontOfSize:17] fittingWidth:100];
+
+  // When
+  (void)[self.cache boundingSizeOfText:text font:[UIFont systemFontOfSize:30] fittingWidth:100];
+  (void)[self.cache boundingSizeOfText:text font:[UIFont systemFontOfSize:17] fittingWidth:40];
+
+  // Then
+  XCTAssertEqual(self.cache.missCount, 3U);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+}
+
+- (void)testLabelSizeMatchesSizeThatFits {
+  // Given
+  UILabel *label = [[UILabel alloc] init];
+  label.numberOfLines = 0;
+  label.text = @"Assistive label text that wraps";
+
+  // When
+  CGSize size = [self.cache sizeOfLabel:label fittingWidth:80];
+  CGSize cachedSize = [self.cache sizeOfLabel:label fittingWidth:80];
+
+  // Then
+  CGSize expectedSize = [label sizeThatFits:CGSizeMake(80, CGFLOAT_MAX)];
+  XCTAssertTrue(CGSizeEqualToSize(size, expectedSize));
+  XCTAssertTrue(CGSizeEqualToSize(cachedSize, expectedSize));
+  XCTAssertEqual(self.cache.hitCount, 1U);
+}
+
+- (void)testChangingALabelMeasuresAgain {
+  // Given
+  UILabel *label = [[UILabel alloc] init];
+  label.numberOfLines = 0;
+  label.text = @"Assistive label text that wraps";
+  (void)[self.cache sizeOfLabel:label fittingWidth:80];
+
+  // When
+  label.numberOfLines = 1;
+  CGSize singleLineSize = [self.cache sizeOfLabel:label fittingWidth:80];
+  CGSize expectedSingleLineSize = [label sizeThatFits:CGSizeMake(80, CGFLOAT_MAX)];
+  label.text = @"Text";
+  CGSize shortTextSize = [self.cache sizeOfLabel:label fittingWidth:80];
+  CGSize expectedShortTextSize = [label sizeThatFits:CGSizeMake(80, CGFLOAT_MAX)];
+
+  // Then
+  XCTAssertEqual(self.cache.hitCount, 0U);
+  XCTAssertTrue(CGSizeEqualToSize(singleLineSize, expectedSingleLineSize));
+  XCTAssertTrue(CGSizeEqualToSize(shortTextSize, expectedShortTextSize));
+}
+
+- (void)testRemoveAllMeasurements {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:17];
+  (void)[self.cache boundingSizeOfText:@"Placeholder" font:font fittingWidth:100];
+
+  // When
+  [self.cache removeAllMeasurements];
+  (void)[self.cache boundingSizeOfText:@"Placeholder" font:font fittingWidth:100];
+
+  // Then
+  XCTAssertEqual(self.cache.missCount, 2U);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+}
+
+- (void)testResetStatistics {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:17];
+  (void)[self.cache boundingSizeOfText:@"Placeholder" font:font fittingWidth:100];
+  (void)[self.cache boundingSizeOfText:@"Placeholder" font:font fittingWidth:100];
+
+  // When
+  [self.cache resetStatistics];
+
+  // Then
+  XCTAssertEqual(self.cache.missCount, 0U);
+  XCTAssertEqual(self.cache.hitCount, 0U);
+}
+
+- (void)testPerformanceOfMeasuringThirtyPlaceholders {
+  // Given
+  UIFont *font = [UIFont systemFontOfSize:17];
+  NSMutableArray<NSString *> *placeholders = [NSMutableArray array];
+  for (NSUInteger i = 0; i < 30; ++i) {
+    [placeholders addObject:[NSString stringWithFormat:@"Placeholder %@", @(i)]];
+  }
+
+  // Then
+  [self measureBlock:^{
+    for (NSUInteger pass = 0; pass < 100; ++pass) {
+      for (NSString *placeholder in placeholders) {
+        (void)[self.cache boundingSizeOfText:placeholder font:font fittingWidth:200];
+      }
+    }
+  }];
+}
+
+@end
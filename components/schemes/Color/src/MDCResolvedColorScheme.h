@@ -0,0 +1,62 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <UIKit/UIKit.h>
+
+#import "MDCSemanticColorScheme.h"
+
+/**
+ An immutable color scheme whose colors are the static colors of another color scheme resolved for
+ a user interface style, an accessibility contrast and an elevation.
+
+ Themers can apply a resolved color scheme's colors directly, without resolving dynamic colors
+ again on every trait change.
+ */
+__attribute__((objc_subclassing_restricted)) @interface MDCResolvedColorScheme
+    : NSObject<MDCColorScheming>
+
+@property(nonnull, readonly, copy, nonatomic) UIColor *primaryColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *primaryColorVariant;
+@property(nonnull, readonly, copy, nonatomic) UIColor *secondaryColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *errorColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *surfaceColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *backgroundColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *onPrimaryColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *onSecondaryColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *onSurfaceColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *onBackgroundColor;
+@property(nonnull, readonly, copy, nonatomic) UIColor *elevationOverlayColor;
+@property(readonly, assign, nonatomic) BOOL elevationOverlayEnabledForDarkMode;
+
+/** The elevation the surface color was resolved for. */
+@property(readonly, assign, nonatomic) CGFloat elevation;
+
+/**
+ Initializes a color scheme with the colors of @c colorScheme resolved for the user interface style
+ and accessibility contrast of @c traitCollection. Other traits are ignored.
+
+ When the user interface style is dark and @c colorScheme enables elevation overlays in Dark Mode,
+ the surface color is additionally resolved for @c elevation.
+
+ @param colorScheme The color scheme whose colors to resolve.
+ @param traitCollection The traits to resolve the colors for.
+ @param elevation The elevation of surfaces to resolve the surface color for.
+ */
+- (nonnull instancetype)initWithColorScheme:(nonnull id<MDCColorScheming>)colorScheme
+                            traitCollection:(nonnull UITraitCollection *)traitCollection
+                                  elevation:(CGFloat)elevation NS_DESIGNATED_INITIALIZER;
+
+- (nonnull instancetype)init NS_UNAVAILABLE;
+
+@end
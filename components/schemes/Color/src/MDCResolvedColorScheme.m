@@ -0,0 +1,78 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import "MDCResolvedColorScheme.h"
+
+#import "MaterialAvailability.h"
+#import "MaterialElevation.h"
+
+/** Returns a trait collection with only the traits that resolved color schemes depend on. */
+static UITraitCollection *ResolvingTraitCollection(UITraitCollection *traitCollection) {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    return [UITraitCollection traitCollectionWithTraitsFromCollections:@[
+      [UITraitCollection
+          traitCollectionWithUserInterfaceStyle:traitCollection.userInterfaceStyle],
+      [UITraitCollection
+          traitCollectionWithAccessibilityContrast:traitCollection.accessibilityContrast],
+    ]];
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+  return traitCollection;
+}
+
+/** Returns @c color resolved for @c traitCollection. */
+static UIColor *ResolvedColor(UIColor *color, UITraitCollection *traitCollection) {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    return [color resolvedColorWithTraitCollection:traitCollection];
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+  return color;
+}
+
+@implementation MDCResolvedColorScheme
+
+- (instancetype)initWithColorScheme:(id<MDCColorScheming>)colorScheme
+                    traitCollection:(UITraitCollection *)traitCollection
+                          elevation:(CGFloat)elevation {
+  self = [super init];
+  if (self) {
+    UITraitCollection *resolvingTraitCollection = ResolvingTraitCollection(traitCollection);
+    _primaryColor = ResolvedColor(colorScheme.primaryColor, resolvingTraitCollection);
+    _primaryColorVariant = ResolvedColor(colorScheme.primaryColorVariant, resolvingTraitCollection);
+    _secondaryColor = ResolvedColor(colorScheme.secondaryColor, resolvingTraitCollection);
+    _errorColor = ResolvedColor(colorScheme.errorColor, resolvingTraitCollection);
+    _backgroundColor = ResolvedColor(colorScheme.backgroundColor, resolvingTraitCollection);
+    _onPrimaryColor = ResolvedColor(colorScheme.onPrimaryColor, resolvingTraitCollection);
+    _onSecondaryColor = ResolvedColor(colorScheme.onSecondaryColor, resolvingTraitCollection);
+    _onSurfaceColor = ResolvedColor(colorScheme.onSurfaceColor, resolvingTraitCollection);
+    _onBackgroundColor = ResolvedColor(colorScheme.onBackgroundColor, resolvingTraitCollection);
+    _elevationOverlayColor =
+        ResolvedColor(colorScheme.elevationOverlayColor, resolvingTraitCollection);
+    _elevationOverlayEnabledForDarkMode = colorScheme.elevationOverlayEnabledForDarkMode;
+    _elevation = elevation;
+
+    if (_elevationOverlayEnabledForDarkMode) {
+      _surfaceColor = [colorScheme.surfaceColor
+          mdc_resolvedColorWithTraitCollection:resolvingTraitCollection
+                                     elevation:elevation];
+    } else {
+      _surfaceColor = ResolvedColor(colorScheme.surfaceColor, resolvingTraitCollection);
+    }
+  }
+  return self;
+}
+
+@end
@@ -15,6 +15,8 @@
 #import <Foundation/Foundation.h>
 #import <UIKit/UIKit.h>
 
+@class MDCResolvedColorScheme;
+
 /**
  A simple color scheme that provides semantic context for the colors it uses. There are no optional
  properties and all colors must be provided, supporting more reliable color theming.
@@ -131,6 +133,26 @@ typedef NS_ENUM(NSInteger, MDCColorSchemeDefaults) {
  */
 - (nonnull instancetype)initWithDefaults:(MDCColorSchemeDefaults)defaults;
 
+/**
+ Returns this color scheme's colors resolved for the user interface style and accessibility
+ contrast of @c traitCollection, and with the surface color resolved for @c elevation when elevation
+ overlays are enabled in Dark Mode.
+
+ The most recently used resolved color schemes are cached by user interface style, accessibility
+ contrast and elevation rounded to @c MDCElevationOverlayElevationQuantum, until a color of this
+ scheme changes. Themers can apply the returned static colors instead of resolving each dynamic
+ color on every trait change.
+
+ The cache has no lock, so only call this method, and only change the colors of a scheme it is
+ called on, on the main thread.
+
+ @param traitCollection The traits to resolve the colors for.
+ @param elevation The elevation of surfaces to resolve the surface color for.
+ */
+- (nonnull MDCResolvedColorScheme *)resolvedColorSchemeWithTraitCollection:
+                                        (nonnull UITraitCollection *)traitCollection
+                                                                 elevation:(CGFloat)elevation;
+
 /**
  Blending a color over a background color using Alpha compositing technique.
  More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
@@ -14,7 +14,19 @@
 
 #import "MDCSemanticColorScheme.h"
 
+#import "MDCResolvedColorScheme.h"
+#import "MaterialAvailability.h"
 #import "MaterialColor.h"
+#import "MaterialElevation.h"
+
+/** The number of resolved color schemes a color scheme keeps. */
+static const NSUInteger kResolvedColorSchemeCacheLimit = 16;
+
+/**
+ Resolved color schemes are only cached below this elevation, so the quantized elevation fits in
+ the cache key. No surface is this high.
+ */
+static const CGFloat kMaximumCachedElevation = 1 << 20;
 
 static UIColor *ColorFromRGB(uint32_t colorValue) {
   return [UIColor colorWithRed:(CGFloat)(((colorValue >> 16) & 0xFF) / 255.0)
@@ -23,22 +35,14 @@ static UIColor *ColorFromRGB(uint32_t colorValue) {
                          alpha:1];
 }
 
-/**
- Helper method to blend a color channel with a background color channel using alpha composition.
- More info about Alpha compositing: https://en.wikipedia.org/wiki/Alpha_compositing
-
- @params value is the value of color channel
- @params bValue is the value of background color channel
- @params alpha is the alpha of color channel
- @params bAlpha is the alpha of background color channel
- */
-
-static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, CGFloat bAlpha) {
-  return ((1 - alpha) * bValue * bAlpha + alpha * value) / (alpha + bAlpha * (1 - alpha));
+@implementation MDCSemanticColorScheme {
+  // Resolved color schemes keyed by their user interface style, accessibility contrast and
+  // quantized elevation. Cleared whenever a color changes.
+  NSMutableDictionary<NSNumber *, MDCResolvedColorScheme *> *_resolvedColorSchemes;
+  // The keys of _resolvedColorSchemes, from least to most recently used.
+  NSMutableOrderedSet<NSNumber *> *_resolvedColorSchemeKeys;
 }
 
-@implementation MDCSemanticColorScheme
-
 - (instancetype)initWithDefaults:(MDCColorSchemeDefaults)defaults {
   self = [super init];
   if (self) {
@@ -135,15 +139,122 @@ static CGFloat blendColorChannel(CGFloat value, CGFloat bValue, CGFloat alpha, C
 }
 
 + (UIColor *)blendColor:(UIColor *)color withBackgroundColor:(UIColor *)backgroundColor {
-  CGFloat red = 0.0, green = 0.0, blue = 0.0, alpha = 0.0;
-  [color getRed:&red green:&green blue:&blue alpha:&alpha];
-  CGFloat bRed = 0.0, bGreen = 0.0, bBlue = 0.0, bAlpha = 0.0;
-  [backgroundColor getRed:&bRed green:&bGreen blue:&bBlue alpha:&bAlpha];
-
-  return [UIColor colorWithRed:blendColorChannel(red, bRed, alpha, bAlpha)
-                         green:blendColorChannel(green, bGreen, alpha, bAlpha)
-                          blue:blendColorChannel(blue, bBlue, alpha, bAlpha)
-                         alpha:alpha + bAlpha * (1 - alpha)];
+  return [UIColor mdc_blendColor:color withBackgroundColor:backgroundColor];
+}
+
+- (MDCResolvedColorScheme *)resolvedColorSchemeWithTraitCollection:
+                                 (UITraitCollection *)traitCollection
+                                                          elevation:(CGFloat)elevation {
+  // MAX also maps NaN to 0.
+  elevation = round(MAX(elevation, 0) / MDCElevationOverlayElevationQuantum) *
+              MDCElevationOverlayElevationQuantum;
+  if (!(elevation < kMaximumCachedElevation)) {
+    return [[MDCResolvedColorScheme alloc] initWithColorScheme:self
+                                               traitCollection:traitCollection
+                                                     elevation:elevation];
+  }
+  NSInteger userInterfaceStyle = 0;
+  NSInteger accessibilityContrast = 0;
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    userInterfaceStyle = traitCollection.userInterfaceStyle;
+    accessibilityContrast = traitCollection.accessibilityContrast;
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+  // The style and contrast are small enumerations (contrast starts at -1), so they fit in the low
+  // bits below the quantized elevation.
+  int64_t quantizedElevation = (int64_t)(elevation / MDCElevationOverlayElevationQuantum);
+  NSNumber *key = @((quantizedElevation << 8) | ((userInterfaceStyle & 0xF) << 4) |
+                    ((accessibilityContrast + 1) & 0xF));
+
+  MDCResolvedColorScheme *resolvedColorScheme = _resolvedColorSchemes[key];
+  if (resolvedColorScheme) {
+    [_resolvedColorSchemeKeys removeObject:key];
+    [_resolvedColorSchemeKeys addObject:key];
+    return resolvedColorScheme;
+  }
+
+  resolvedColorScheme = [[MDCResolvedColorScheme alloc] initWithColorScheme:self
+                                                            traitCollection:traitCollection
+                                                                  elevation:elevation];
+  if (!_resolvedColorSchemes) {
+    _resolvedColorSchemes = [NSMutableDictionary dictionary];
+    _resolvedColorSchemeKeys = [NSMutableOrderedSet orderedSet];
+  }
+  if (_resolvedColorSchemeKeys.count >= kResolvedColorSchemeCacheLimit) {
+    [_resolvedColorSchemes removeObjectForKey:_resolvedColorSchemeKeys.firstObject];
+    [_resolvedColorSchemeKeys removeObjectAtIndex:0];
+  }
+  _resolvedColorSchemes[key] = resolvedColorScheme;
+  [_resolvedColorSchemeKeys addObject:key];
+  return resolvedColorScheme;
+}
+
+- (void)removeResolvedColorSchemes {
+  [_resolvedColorSchemes removeAllObjects];
+  [_resolvedColorSchemeKeys removeAllObjects];
+}
+
+#pragma mark - Properties
+
+- (void)setPrimaryColor:(UIColor *)primaryColor {
+  _primaryColor = [primaryColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setPrimaryColorVariant:(UIColor *)primaryColorVariant {
+  _primaryColorVariant = [primaryColorVariant copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setSecondaryColor:(UIColor *)secondaryColor {
+  _secondaryColor = [secondaryColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setErrorColor:(UIColor *)errorColor {
+  _errorColor = [errorColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setSurfaceColor:(UIColor *)surfaceColor {
+  _surfaceColor = [surfaceColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setBackgroundColor:(UIColor *)backgroundColor {
+  _backgroundColor = [backgroundColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setOnPrimaryColor:(UIColor *)onPrimaryColor {
+  _onPrimaryColor = [onPrimaryColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setOnSecondaryColor:(UIColor *)onSecondaryColor {
+  _onSecondaryColor = [onSecondaryColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setOnSurfaceColor:(UIColor *)onSurfaceColor {
+  _onSurfaceColor = [onSurfaceColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setOnBackgroundColor:(UIColor *)onBackgroundColor {
+  _onBackgroundColor = [onBackgroundColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setElevationOverlayColor:(UIColor *)elevationOverlayColor {
+  _elevationOverlayColor = [elevationOverlayColor copy];
+  [self removeResolvedColorSchemes];
+}
+
+- (void)setElevationOverlayEnabledForDarkMode:(BOOL)elevationOverlayEnabledForDarkMode {
+  _elevationOverlayEnabledForDarkMode = elevationOverlayEnabledForDarkMode;
+  [self removeResolvedColorSchemes];
 }
 
 #pragma mark - NSCopying
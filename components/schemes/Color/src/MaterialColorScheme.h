@@ -15,5 +15,6 @@
 #import "MDCLegacyColorScheme.h"
 #import "MDCLegacyTonalColorScheme.h"
 #import "MDCLegacyTonalPalette.h"
+#import "MDCResolvedColorScheme.h"
 
 #import "MDCSemanticColorScheme.h"
@@ -0,0 +1,195 @@
+// Copyright 2020-present the Material Components for iOS authors. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#import <XCTest/XCTest.h>
+
+#import "MaterialAvailability.h"
+#import "MaterialColorScheme.h"
+#import "MaterialElevation.h"
+
+@interface MDCResolvedColorSchemeTests : XCTestCase
+@property(nonatomic, strong) MDCSemanticColorScheme *colorScheme;
+@property(nonatomic, strong) UITraitCollection *traitCollection;
+@end
+
+@implementation MDCResolvedColorSchemeTests
+
+- (void)setUp {
+  [super setUp];
+
+  self.colorScheme =
+      [[MDCSemanticColorScheme alloc] initWithDefaults:MDCColorSchemeDefaultsMaterial201907];
+  self.traitCollection = [[UITraitCollection alloc] init];
+}
+
+- (void)tearDown {
+  self.traitCollection = nil;
+  self.colorScheme = nil;
+
+  [super tearDown];
+}
+
+- (void)testResolvedColorSchemeIsCached {
+  // When
+  MDCResolvedColorScheme *resolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:4];
+  MDCResolvedColorScheme *otherResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:4];
+
+  // Then
+  XCTAssertEqual(resolvedColorScheme, otherResolvedColorScheme);
+  XCTAssertEqual(resolvedColorScheme.elevation, 4);
+}
+
+- (void)testResolvedColorSchemeIsCachedPerElevation {
+  // When
+  MDCResolvedColorScheme *resolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:4];
+  MDCResolvedColorScheme *nearbyResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection
+                                                     elevation:4 + (CGFloat)1 / 256];
+  MDCResolvedColorScheme *otherResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:8];
+
+  // Then
+  XCTAssertEqual(resolvedColorScheme, nearbyResolvedColorScheme);
+  XCTAssertNotEqual(resolvedColorScheme, otherResolvedColorScheme);
+}
+
+- (void)testLeastRecentlyUsedResolvedColorSchemeIsEvicted {
+  // Given
+  NSMutableArray<MDCResolvedColorScheme *> *resolvedColorSchemes = [NSMutableArray array];
+  for (NSInteger elevation = 0; elevation < 16; ++elevation) {
+    [resolvedColorSchemes
+        addObject:[self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection
+                                                                 elevation:elevation]];
+  }
+  [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0];
+
+  // When
+  [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:16];
+
+  // Then
+  XCTAssertEqual(
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0],
+      resolvedColorSchemes[0]);
+  XCTAssertNotEqual(
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:1],
+      resolvedColorSchemes[1]);
+}
+
+- (void)testNonFiniteElevationsResolve {
+  // Given
+  MDCResolvedColorScheme *resolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0];
+
+  // When
+  MDCResolvedColorScheme *nanResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:NAN];
+  MDCResolvedColorScheme *infiniteResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection
+                                                     elevation:INFINITY];
+
+  // Then
+  XCTAssertEqual(nanResolvedColorScheme, resolvedColorScheme);
+  XCTAssertNotNil(infiniteResolvedColorScheme);
+  XCTAssertNotEqual(infiniteResolvedColorScheme, resolvedColorScheme);
+}
+
+- (void)testSettingColorDiscardsResolvedColorSchemes {
+  // Given
+  MDCResolvedColorScheme *resolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0];
+
+  // When
+  self.colorScheme.primaryColor = UIColor.redColor;
+  MDCResolvedColorScheme *otherResolvedColorScheme =
+      [self.colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0];
+
+  // Then
+  XCTAssertNotEqual(resolvedColorScheme, otherResolvedColorScheme);
+  XCTAssertEqualObjects(otherResolvedColorScheme.primaryColor, UIColor.redColor);
+}
+
+- (void)testResolvedColorSchemeCopiesStaticColors {
+  // Given
+  MDCSemanticColorScheme *colorScheme =
+      [[MDCSemanticColorScheme alloc] initWithDefaults:MDCColorSchemeDefaultsMaterial201804];
+
+  // When
+  MDCResolvedColorScheme *resolvedColorScheme =
+      [colorScheme resolvedColorSchemeWithTraitCollection:self.traitCollection elevation:0];
+
+  // Then
+  XCTAssertEqualObjects(resolvedColorScheme.primaryColor, colorScheme.primaryColor);
+  XCTAssertEqualObjects(resolvedColorScheme.surfaceColor, colorScheme.surfaceColor);
+  XCTAssertEqualObjects(resolvedColorScheme.onSurfaceColor, colorScheme.onSurfaceColor);
+  XCTAssertEqual(resolvedColorScheme.elevationOverlayEnabledForDarkMode,
+                 colorScheme.elevationOverlayEnabledForDarkMode);
+}
+
+- (void)testResolvedColorSchemeWhenUserInterfaceStyleIsDarkForiOS13 {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UITraitCollection *darkTraitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+    UITraitCollection *lightTraitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleLight];
+
+    // When
+    MDCResolvedColorScheme *darkColorScheme =
+        [self.colorScheme resolvedColorSchemeWithTraitCollection:darkTraitCollection elevation:0];
+    MDCResolvedColorScheme *lightColorScheme =
+        [self.colorScheme resolvedColorSchemeWithTraitCollection:lightTraitCollection elevation:0];
+
+    // Then
+    XCTAssertNotEqual(darkColorScheme, lightColorScheme);
+    XCTAssertEqualObjects(darkColorScheme.primaryColor,
+                          [self.colorScheme.primaryColor
+                              resolvedColorWithTraitCollection:darkTraitCollection]);
+    XCTAssertEqualObjects(lightColorScheme.primaryColor,
+                          [self.colorScheme.primaryColor
+                              resolvedColorWithTraitCollection:lightTraitCollection]);
+    XCTAssertEqualObjects(
+        [darkColorScheme.primaryColor resolvedColorWithTraitCollection:lightTraitCollection],
+        darkColorScheme.primaryColor);
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+}
+
+- (void)testResolvedSurfaceColorIsElevatedInDarkModeForiOS13 {
+#if MDC_AVAILABLE_SDK_IOS(13_0)
+  if (@available(iOS 13.0, *)) {
+    // Given
+    UITraitCollection *darkTraitCollection =
+        [UITraitCollection traitCollectionWithUserInterfaceStyle:UIUserInterfaceStyleDark];
+
+    // When
+    MDCResolvedColorScheme *resolvedColorScheme =
+        [self.colorScheme resolvedColorSchemeWithTraitCollection:darkTraitCollection elevation:8];
+
+    // Then
+    UIColor *expectedSurfaceColor =
+        [self.colorScheme.surfaceColor mdc_resolvedColorWithTraitCollection:darkTraitCollection
+                                                                  elevation:8];
+    XCTAssertEqualObjects(resolvedColorScheme.surfaceColor, expectedSurfaceColor);
+    XCTAssertEqualObjects(resolvedColorScheme.backgroundColor,
+                          [self.colorScheme.backgroundColor
+                              resolvedColorWithTraitCollection:darkTraitCollection]);
+  }
+#endif  // MDC_AVAILABLE_SDK_IOS(13_0)
+}
+
+@end